@@ -382,6 +382,9 @@ set_if_at_least_one_set(RETDEC_ENABLE_YARACPP
 		RETDEC_ENABLE_STACOFIN)
 
 # tests
+set_if_all_set(RETDEC_ENABLE_AR_EXTRACTOR_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_AR_EXTRACTOR)
 set_if_all_set(RETDEC_ENABLE_BIN2LLVMIR_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_BIN2LLVMIR)
@@ -412,6 +415,9 @@ set_if_all_set(RETDEC_ENABLE_LLVMIR2HLL_TESTS
 set_if_all_set(RETDEC_ENABLE_LOADER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_LOADER)
+set_if_all_set(RETDEC_ENABLE_PDBPARSER_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_PDBPARSER)
 set_if_all_set(RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_SERDES)
@@ -441,6 +447,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_ELFIO
 		RETDEC_ENABLE_FILEFORMAT)
 
 set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
+		RETDEC_ENABLE_AR_EXTRACTOR_TESTS
 		RETDEC_ENABLE_BIN2LLVMIR_TESTS
 		RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 		RETDEC_ENABLE_COMMON_TESTS
@@ -452,6 +459,7 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_LLVMIR_EMUL_TESTS
 		RETDEC_ENABLE_LLVMIR2HLL_TESTS
 		RETDEC_ENABLE_LOADER_TESTS
+		RETDEC_ENABLE_PDBPARSER_TESTS
 		RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_ENABLE_UNPACKER_TESTS
 		RETDEC_ENABLE_UTILS_TESTS)
@@ -471,7 +479,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_LLVM
 		RETDEC_ENABLE_LLVMIR2HLL
 		RETDEC_ENABLE_MACHO_EXTRACTOR
 		RETDEC_ENABLE_CPDETECT
-		RETDEC_ENABLE_DEBUGFORMAT)
+		RETDEC_ENABLE_DEBUGFORMAT
+		RETDEC_ENABLE_PDBPARSER)
 
 set_if_at_least_one_set(RETDEC_ENABLE_RAPIDJSON
 		RETDEC_ENABLE_AR_EXTRACTOR
@@ -7,6 +7,7 @@
 #ifndef RETDEC_AR_EXTRACTOR_ARCHIVE_WRAPPER_H
 #define RETDEC_AR_EXTRACTOR_ARCHIVE_WRAPPER_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,10 +28,14 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 	public:
 		ArchiveWrapper(const std::string &archivePath, bool &succes,
 			std::string &errorMessage);
+		ArchiveWrapper(const std::vector<std::uint8_t> &data, bool &succes,
+			std::string &errorMessage);
 
 		/// @brief Getters.
 		/// @{
 		std::size_t getNumberOfObjects() const;
+		bool getNames(std::vector<std::string> &result,
+			std::string &errorMessage) const;
 		/// @}
 
 		/// @brief Query methods.
@@ -55,6 +60,10 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 			const std::string &outputPath = "") const;
 		bool extractByIndex(const std::size_t index, std::string &errorMessage,
 			const std::string &outputPath = "") const;
+		bool extractByName(const std::string &name, std::string &errorMessage,
+			std::vector<std::uint8_t> &result) const;
+		bool extractByIndex(const std::size_t index, std::string &errorMessage,
+			std::vector<std::uint8_t> &result) const;
 		/// @}
 
 	private:
@@ -65,9 +74,12 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 
 		/// @brief Auxiliary methods.
 		/// @{
-		bool getNames(std::vector<std::string> &result,
-			std::string &errorMessage) const;
+		void init(bool &succes, std::string &errorMessage);
 		bool getCount(std::size_t &count, std::string &errorMessage) const;
+		bool findByName(const std::string &name, llvm::StringRef &data,
+			std::string &childName, std::string &errorMessage) const;
+		bool findByIndex(const std::size_t index, llvm::StringRef &data,
+			std::string &childName, std::string &errorMessage) const;
 		/// @}
 
 		std::size_t objectCount = 0; ///< Number of object files in archive.
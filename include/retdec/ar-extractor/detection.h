@@ -7,12 +7,15 @@
 #ifndef RETDEC_AR_EXTRACTOR_DETECTION_H
 #define RETDEC_AR_EXTRACTOR_DETECTION_H
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace retdec {
 namespace ar_extractor {
 
 bool isArchive(const std::string &path);
+bool isArchive(const std::vector<std::uint8_t> &data);
 
 bool isThinArchive(const std::string &path);
 
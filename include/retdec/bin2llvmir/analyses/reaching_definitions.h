@@ -3,9 +3,9 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* The analysis is computed for each function separately. When run on an entire
+* module, functions are analysed in parallel if the configuration allows more
+* than one thread -- the analysis only reads the IR.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -29,6 +29,7 @@ namespace bin2llvmir {
 class Definition;
 class Use;
 class BasicBlockEntry;
+class ParallelStatistics;
 class ReachingDefinitionsAnalysis;
 
 using Changed = bool;
@@ -41,6 +42,8 @@ using UseSet = std::unordered_set<Use*>;
 using DefVector = std::vector<Definition>;
 using UseVector = std::vector<Use>;
 
+using BasicBlockEntryMap = std::map<const llvm::BasicBlock*, BasicBlockEntry>;
+
 class Definition
 {
 	public:
@@ -114,6 +117,8 @@ class BasicBlockEntry
 		bool changed = false;
 
 	private:
+		/// Index of the basic block in its function. It is used only to name
+		/// unnamed basic blocks in debug dumps.
 		unsigned id;
 };
 
@@ -123,7 +128,8 @@ class ReachingDefinitionsAnalysis
 		bool runOnModule(
 				llvm::Module& M,
 				Abi* abi = nullptr,
-				bool trackFlagRegs = false);
+				bool trackFlagRegs = false,
+				ParallelStatistics* stats = nullptr);
 		bool runOnFunction(
 				llvm::Function& F,
 				Abi* abi = nullptr,
@@ -152,18 +158,21 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		void run(llvm::Function& F, BasicBlockEntryMap& bbs) const;
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
-		void initializeBasicBlocks(llvm::Module& M);
-		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		void initializeBasicBlocks(
+				llvm::Function& F,
+				BasicBlockEntryMap& bbs) const;
+		void initializeBasicBlocksPrev(BasicBlockEntryMap& bbs) const;
+		void initializeKillGenSets(BasicBlockEntryMap& bbs) const;
+		void propagate(
+				const llvm::Function& F,
+				BasicBlockEntryMap& bbs) const;
+		void initializeDefsAndUses(BasicBlockEntryMap& bbs) const;
+		void clearInternal(BasicBlockEntryMap& bbs) const;
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		std::map<const llvm::Function*, BasicBlockEntryMap> bbMap;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
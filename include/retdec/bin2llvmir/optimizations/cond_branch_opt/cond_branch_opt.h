@@ -14,6 +14,7 @@
 
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -50,6 +51,7 @@ class CondBranchOpt : public llvm::ModulePass
 		Config* _config = nullptr;
 		Abi* _abi = nullptr;
 		std::unordered_set<llvm::Value*> _toRemove;
+		ParallelStatistics _parallelStats;
 };
 
 } // namespace bin2llvmir
@@ -21,6 +21,7 @@
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -55,6 +56,7 @@ class ConstantsAnalysis : public llvm::ModulePass
 		DebugFormat* _dbgf = nullptr;
 
 		std::unordered_set<llvm::Value*> _toRemove;
+		ParallelStatistics _parallelStats;
 };
 
 } // namespace bin2llvmir
@@ -11,6 +11,7 @@
 #include <optional>
 #include <queue>
 #include <sstream>
+#include <unordered_map>
 
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Function.h>
@@ -29,6 +30,7 @@
 #include "retdec/bin2llvmir/providers/names.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_ranges.h"
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/symbolic_tree_match.h"
@@ -83,6 +85,7 @@ class Decoder : public llvm::ModulePass
 		void initConfigFunctions();
 		void initStaticCode();
 		void initVtables();
+		void initDisassemblyCache();
 
 	private:
 		void decode();
@@ -92,6 +95,11 @@ class Decoder : public llvm::ModulePass
 				const JumpTarget& jt,
 				ByteData bytes,
 				bool strict = false);
+		bool disasmDryRun(
+				ByteData& bytes,
+				uint64_t& addr,
+				CachedInstruction& insn);
+		void classifyInstruction(cs_insn* insn, CachedInstruction& ci);
 		cs_mode determineMode(cs_insn* insn, common::Address& target);
 		capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne
 				translate(
@@ -146,7 +154,7 @@ class Decoder : public llvm::ModulePass
 		void addBasicBlock(common::Address a, llvm::BasicBlock* b);
 
 		std::map<common::Address, llvm::BasicBlock*> _addr2bb;
-		std::map<llvm::BasicBlock*, common::Address> _bb2addr;
+		std::unordered_map<llvm::BasicBlock*, common::Address> _bb2addr;
 
 	// Function related methods.
 	//
@@ -165,7 +173,7 @@ class Decoder : public llvm::ModulePass
 		void addFunctionSize(llvm::Function* f, std::optional<std::size_t> sz);
 
 		std::map<common::Address, llvm::Function*> _addr2fnc;
-		std::map<llvm::Function*, common::Address> _fnc2addr;
+		std::unordered_map<llvm::Function*, common::Address> _fnc2addr;
 		// Function sizes from debug info/symbol table/config/etc.
 		// Used to prevent function splitting.
 		//
@@ -191,6 +199,7 @@ class Decoder : public llvm::ModulePass
 				const JumpTarget& jt,
 				ByteData bytes,
 				bool strict = false);
+		void classifyInstruction_x86(cs_insn* insn, CachedInstruction& ci);
 
 	// ARM specific.
 	//
@@ -216,6 +225,7 @@ class Decoder : public llvm::ModulePass
 				ByteData bytes,
 				bool strict = false);
 		void patternsPseudoCall_arm64(llvm::CallInst*& call, AsmInstruction& pAi);
+		void classifyInstruction_arm64(cs_insn* insn, CachedInstruction& ci);
 
 	// MIPS specific.
 	//
@@ -304,6 +314,8 @@ class Decoder : public llvm::ModulePass
 
 		RangesToDecode _ranges;
 		JumpTargets _jumpTargets;
+		/// Instructions disassembled before decoding, if enabled.
+		DisassemblyCache _disasmCache;
 
 		/// Name of all extern functions gathered from object files
 		std::set<std::string> _externs;
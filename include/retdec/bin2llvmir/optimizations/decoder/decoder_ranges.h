@@ -39,7 +39,11 @@ class RangesToDecode
 		const common::AddressRange* getAlternative(common::Address a) const;
 		const common::AddressRange* get(common::Address a) const;
 
+		const common::AddressRangeContainer& getPrimaryRanges() const;
+		const common::AddressRangeContainer& getAlternativeRanges() const;
+
 		void setArchitectureInstructionAlignment(unsigned a);
+		unsigned getArchitectureInstructionAlignment() const;
 
 	friend std::ostream& operator<<(std::ostream &os, const RangesToDecode& rs);
 
@@ -0,0 +1,127 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h
+* @brief Cache of instructions speculatively disassembled before decoding.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_DISASSEMBLY_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <capstone/capstone.h>
+
+#include "retdec/common/address.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Compact information about one pre-disassembled instruction.
+ * It holds only what the decoder needs to decide about the code without
+ * disassembling it again.
+ */
+class CachedInstruction
+{
+	public:
+		/**
+		 * Properties of the instruction.
+		 */
+		enum eFlag : std::uint16_t
+		{
+			CONTROL_FLOW = 1 << 0,
+			CALL = 1 << 1,
+			RETURN = 1 << 2,
+			BRANCH = 1 << 3,
+			COND_BRANCH = 1 << 4,
+			NOP = 1 << 5,
+			WRITES_PC = 1 << 6,
+			SYSCALL = 1 << 7,
+			// x86: int 0x80
+			INT_80 = 1 << 8,
+			// x86: mov eax, 1
+			STORE_ONE_TO_EAX = 1 << 9,
+		};
+
+	public:
+		bool is(eFlag f) const { return flags & f; }
+		bool hasTarget() const { return target != 0; }
+
+	public:
+		/// Instruction address.
+		std::uint64_t address = 0;
+		/// Immediate target of call/branch instruction, or zero.
+		std::uint64_t target = 0;
+		/// Capstone instruction ID.
+		unsigned int id = 0;
+		/// Combination of @c eFlag values.
+		std::uint16_t flags = 0;
+		/// Instruction size in bytes.
+		std::uint8_t size = 0;
+};
+
+/**
+ * Instructions disassembled in a linear sweep over the ranges to decode,
+ * before the actual decoding. Ranges are split into chunks which are
+ * disassembled in parallel, each with its own Capstone engine. Where an
+ * instruction crosses a chunk boundary, the beginning of the next chunk is
+ * disassembled again from the end of that instruction until both sweeps meet,
+ * so the cache contains exactly the instructions of a serial sweep over each
+ * range. Because an instruction decoded at some address does not depend on
+ * how the disassembly got there, the cache can answer any address it
+ * contains. Addresses that are not in the cache (e.g. sweep was misaligned on
+ * x86) must be disassembled by the caller as usual.
+ *
+ * Only compact records are kept, not Capstone instructions with their
+ * details, so the cache needs a few tens of bytes per instruction.
+ *
+ * Once built, the cache is immutable and can be queried from any thread.
+ */
+class DisassemblyCache
+{
+	public:
+		/**
+		 * Continuous bytes to disassemble.
+		 */
+		struct Region
+		{
+			common::Address start;
+			const std::uint8_t* bytes = nullptr;
+			std::size_t size = 0;
+		};
+
+		/**
+		 * Fills in @c CachedInstruction from the disassembled Capstone
+		 * instruction. @c address, @c id and @c size are already set.
+		 * It is called concurrently from several threads.
+		 */
+		using Classifier = std::function<void(cs_insn*, CachedInstruction&)>;
+
+	public:
+		void build(
+				cs_arch arch,
+				cs_mode mode,
+				const std::vector<Region>& regions,
+				unsigned alignment,
+				std::size_t threads,
+				const Classifier& classifier);
+		void clear();
+
+		const CachedInstruction* get(common::Address a) const;
+		bool empty() const;
+		std::size_t size() const;
+
+	private:
+		/// Size of chunks disassembled by one worker at a time.
+		static const std::size_t CHUNK_SIZE = 0x10000;
+
+		/// All the cached instructions, sorted by address.
+		std::vector<CachedInstruction> _insns;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
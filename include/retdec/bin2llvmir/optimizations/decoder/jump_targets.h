@@ -7,8 +7,10 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_JUMP_TARGETS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_JUMP_TARGETS_H
 
+#include <cstdint>
 #include <optional>
-#include <set>
+#include <unordered_set>
+#include <vector>
 
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
@@ -91,21 +93,25 @@ class JumpTarget
 };
 
 /**
- * Jump target container.
+ * Jump target container -- a priority queue ordered by
+ * @c JumpTarget::operator<(), i.e. @c top() is the jump target with the
+ * highest priority (lowest type). Jump targets equal to some queued jump
+ * target (same type, address and from address) are not queued again.
+ *
+ * The queue is a binary heap in a single vector, which is much cheaper to
+ * push to and pop from than a node-based container. Duplicates are detected
+ * by a hash set of the queued jump target keys.
  */
 class JumpTargets
 {
 	public:
-		auto begin();
-		auto end();
-
-		bool empty();
+		bool empty() const;
 		std::size_t size() const;
 		void clear();
-		const JumpTarget& top();
+		const JumpTarget& top() const;
 		void pop();
 
-		const JumpTarget* push(
+		std::optional<JumpTarget> push(
 				retdec::common::Address a,
 				JumpTarget::eType t,
 				cs_mode m,
@@ -114,8 +120,37 @@ class JumpTargets
 
 	friend std::ostream& operator<<(std::ostream &out, const JumpTargets& jts);
 
-	public:
-		std::set<JumpTarget> _data;
+	private:
+		/**
+		 * Identification of a jump target in the queue.
+		 */
+		struct Key
+		{
+			std::uint64_t address = 0;
+			std::uint64_t fromAddress = 0;
+			JumpTarget::eType type = JumpTarget::eType::UNKNOWN;
+
+			Key(const JumpTarget& jt);
+			bool operator==(const Key& o) const;
+		};
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& k) const;
+		};
+		/**
+		 * Heap comparator -- the jump target with the highest priority must
+		 * end up on the top.
+		 */
+		struct Lower
+		{
+			bool operator()(const JumpTarget& a, const JumpTarget& b) const;
+		};
+
+	private:
+		/// Binary heap of jump targets.
+		std::vector<JumpTarget> _data;
+		/// Keys of all the jump targets in @c _data.
+		std::unordered_set<Key, KeyHash> _queued;
 
 	public:
 		static Config* config;
@@ -24,6 +24,7 @@
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -108,6 +109,7 @@ class ParamReturn : public llvm::ModulePass
 
 		std::map<llvm::Value*, DataFlowEntry> _fnc2calls;
 		ReachingDefinitionsAnalysis _RDA;
+		ParallelStatistics _parallelStats;
 		Collector::Ptr _collector;
 };
 
@@ -7,6 +7,9 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 
+#include <cstdint>
+#include <vector>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
@@ -28,9 +31,12 @@ class ProviderInitialization : public llvm::ModulePass
 		virtual bool doFinalization(llvm::Module& m) override;
 
 		void setConfig(retdec::config::Config* c);
+		void setInputData(const std::vector<std::uint8_t>* data);
 
 	private:
 		retdec::config::Config* _config = nullptr;
+		/// Content of the input file if it is not read from the disk.
+		const std::vector<std::uint8_t>* _inputData = nullptr;
 };
 
 } // namespace bin2llvmir
@@ -20,6 +20,7 @@
 
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/utils/debug.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -221,6 +222,7 @@ class SimpleTypesAnalysis : public llvm::ModulePass
 		ValuePairList val2PtrVal;
 
 		ReachingDefinitionsAnalysis RDA;
+		ParallelStatistics parallelStats;
 		llvm::Module* module = nullptr;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		Config* config = nullptr;
@@ -17,6 +17,7 @@
 #include "retdec/bin2llvmir/providers/abi/abi.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -56,6 +57,7 @@ class StackAnalysis : public llvm::ModulePass
 		DebugFormat* _dbgf = nullptr;
 
 		std::unordered_set<llvm::Value*> _toRemove;
+		ParallelStatistics _parallelStats;
 };
 
 } // namespace bin2llvmir
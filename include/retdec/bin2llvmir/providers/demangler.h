@@ -8,6 +8,7 @@
 #define RETDEC_BIN2LLVMIR_PROVIDERS_DEMANGLER_H
 
 #include <map>
+#include <unordered_map>
 
 #include <llvm/IR/Module.h>
 
@@ -59,6 +60,10 @@ private:
 	std::unique_ptr<retdec::ctypes::Module> _ctypesModule;
 	std::shared_ptr<ctypesparser::TypeConfig> _typeConfig;
 	std::unique_ptr<demangler::Demangler> _demangler;
+	/// Results of demangling to ctypes, @c nullptr if it failed.
+	std::unordered_map<
+		std::string,
+		std::shared_ptr<retdec::ctypes::Function>> _ctypesFunctions;
 };
 
 /**
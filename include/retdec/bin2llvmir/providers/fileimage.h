@@ -32,6 +32,10 @@ class FileImage
 				llvm::Module* m,
 				const std::string& path,
 				Config* config);
+		FileImage(
+				llvm::Module* m,
+				const std::vector<std::uint8_t>& data,
+				Config* config);
 		FileImage(
 				llvm::Module* m,
 				const std::shared_ptr<retdec::fileformat::FileFormat>& ff,
@@ -122,6 +126,10 @@ class FileImageProvider
 				llvm::Module* m,
 				const std::string& path,
 				Config* config);
+		static FileImage* addFileImage(
+				llvm::Module* m,
+				const std::vector<std::uint8_t>& data,
+				Config* config);
 		static FileImage* addFileImage(
 				llvm::Module* m,
 				const std::shared_ptr<retdec::fileformat::FileFormat>& ff,
@@ -0,0 +1,123 @@
+/**
+ * @file include/retdec/bin2llvmir/utils/parallel.h
+ * @brief Function-parallel execution of independent per-function work.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ *
+ * LLVM IR of a single module (and its LLVMContext) must not be modified from
+ * several threads at once -- creating constants, types, metadata, or just
+ * adding/removing uses of a global is not thread-safe. Therefore, only work
+ * that reads IR and writes into the pass' own per-function data structures
+ * may be run through @c runOnFunctions(). IR modifications must stay serial.
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+#define RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+
+#include "retdec/utils/parallel.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Statistics of the per-function work that was run through
+ * @c runOnFunctions(). Every pass that runs such work keeps its own instance
+ * and reports it by @c log() at the end of its run.
+ */
+class ParallelStatistics
+{
+	public:
+		void record(
+				std::size_t functions,
+				std::size_t threads,
+				double wallTime,
+				double workTime);
+		double getSpeedup() const;
+		void print(std::ostream& out, const std::string& pass) const;
+		void log(const std::string& pass) const;
+
+	private:
+		/// Number of @c runOnFunctions() calls.
+		std::size_t _runs = 0;
+		/// Number of all the processed functions.
+		std::size_t _functions = 0;
+		/// Maximal number of used threads.
+		std::size_t _threads = 0;
+		/// Wall-clock time of the work [s].
+		double _wallTime = 0.0;
+		/// Sum of times of the individual functions [s], i.e. an estimate
+		/// of the time the work would take if it was run serially.
+		double _workTime = 0.0;
+};
+
+/**
+ * Get all the function definitions in the given module.
+ */
+inline std::vector<llvm::Function*> getFunctionDefinitions(llvm::Module& m)
+{
+	std::vector<llvm::Function*> fncs;
+	for (llvm::Function& f : m)
+	{
+		if (!f.isDeclaration())
+		{
+			fncs.push_back(&f);
+		}
+	}
+	return fncs;
+}
+
+/**
+ * Call @p f(F) for every function @c F in @p fncs, using at most @p threads
+ * threads (0 = all hardware threads). If @p stats is given, time spent in the
+ * work is recorded in it.
+ *
+ * @p f must only read the IR (see the file comment) and it must be safe to
+ * call it concurrently for different functions.
+ */
+template <typename Fnc>
+void runOnFunctions(
+		const std::vector<llvm::Function*>& fncs,
+		std::size_t threads,
+		Fnc&& f,
+		ParallelStatistics* stats = nullptr)
+{
+	using Clock = std::chrono::steady_clock;
+	using Seconds = std::chrono::duration<double>;
+
+	threads = utils::getThreadCount(threads);
+	std::vector<double> times(fncs.size(), 0.0);
+
+	auto start = Clock::now();
+	utils::parallelFor(fncs.size(), threads, [&](std::size_t i)
+	{
+		auto s = Clock::now();
+		f(*fncs[i]);
+		times[i] = Seconds(Clock::now() - s).count();
+	});
+	double wallTime = Seconds(Clock::now() - start).count();
+
+	double workTime = 0.0;
+	for (auto t : times)
+	{
+		workTime += t;
+	}
+
+	if (stats)
+	{
+		stats->record(fncs.size(), threads, wallTime, workTime);
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
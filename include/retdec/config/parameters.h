@@ -31,6 +31,7 @@ class Parameters
 		bool isKeepAllFunctions() const;
 		bool isSelectedDecodeOnly() const;
 		bool isDetectStaticCode() const;
+		bool isPreDisassemble() const;
 		bool isTimeout() const;
 		bool isMaxMemoryLimitHalfRam() const;
 		bool isBackendNoOpts() const;
@@ -64,6 +65,7 @@ class Parameters
 		void setMaxMemoryLimit(uint64_t limit);
 		void setIsMaxMemoryLimitHalfRam(bool f);
 		void setTimeout(uint64_t seconds);
+		void setThreads(uint64_t threads);
 		void setEntryPoint(const retdec::common::Address& a);
 		void setMainAddress(const retdec::common::Address& a);
 		void setSectionVMA(const retdec::common::Address& a);
@@ -71,7 +73,10 @@ class Parameters
 		void setBackendEnabledOpts(const std::string& o);
 		void setBackendCallInfoObtainer(const std::string& val);
 		void setBackendVarRenamer(const std::string& val);
+		void setBackendAliasAnalysis(const std::string& val);
+		void setBackendCfgFormat(const std::string& val);
 		void setIsDetectStaticCode(bool b);
+		void setIsPreDisassemble(bool b);
 		void setIsBackendNoOpts(bool b);
 		void setIsBackendEmitCfg(bool b);
 		void setIsBackendEmitCg(bool b);
@@ -99,6 +104,7 @@ class Parameters
 		const std::string& getErrFile() const;
 		uint64_t getMaxMemoryLimit() const;
 		uint64_t getTimeout() const;
+		uint64_t getThreads() const;
 		retdec::common::Address getEntryPoint() const;
 		retdec::common::Address getMainAddress() const;
 		retdec::common::Address getSectionVMA() const;
@@ -106,6 +112,8 @@ class Parameters
 		const std::string& getBackendEnabledOpts() const;
 		const std::string& getBackendCallInfoObtainer() const;
 		const std::string& getBackendVarRenamer() const;
+		const std::string& getBackendAliasAnalysis() const;
+		const std::string& getBackendCfgFormat() const;
 		/// @}
 
 		void fixRelativePaths(const std::string& configPath);
@@ -165,12 +173,21 @@ class Parameters
 		uint64_t _maxMemoryLimit = 0;
 		bool _maxMemoryLimitHalfRam = true;
 		uint64_t _timeout = 0;
+		/// Maximal number of threads used by the parallelized parts of
+		/// the decompilation. Zero means all available hardware threads.
+		uint64_t _threads = 1;
 
 		bool _detectStaticCode = true;
+		/// Disassemble all ranges to decode up front (using @c _threads
+		/// threads) and let the decoder use the disassembled instructions.
+		bool _preDisassemble = false;
 		std::string _backendDisabledOpts;
 		std::string _backendEnabledOpts;
 		std::string _backendCallInfoObtainer = "optim";
 		std::string _backendVarRenamer = "readable";
+		std::string _backendAliasAnalysis = "simple";
+		/// Format of the emitted CFGs (@c dot or @c json-lines).
+		std::string _backendCfgFormat = "dot";
 		bool _backendNoOpts = false;
 		bool _backendEmitCfg = false;
 		bool _backendEmitCg = false;
@@ -0,0 +1,81 @@
+/**
+ * @file include/retdec/demangler/demangle_cache.h
+ * @brief Cache of demangled names.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DEMANGLER_DEMANGLE_CACHE_H
+#define RETDEC_DEMANGLER_DEMANGLE_CACHE_H
+
+#include <cstddef>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "retdec/demangler/demangler_base.h"
+
+namespace retdec {
+namespace demangler {
+
+/**
+ * @brief Cache of names demangled to strings by a single demangler.
+ *
+ * Every @c Demangler owns its cache, so the cached names live only as long as
+ * the demangler. Equal demangled names are stored only once. All methods can
+ * be called concurrently.
+ */
+class DemangleCache
+{
+public:
+	explicit DemangleCache(const std::string &compiler);
+
+	bool get(
+		const std::string &mangled,
+		std::string &demangled,
+		Demangler::Status &status) const;
+
+	void add(
+		const std::string &mangled,
+		const std::string &demangled,
+		Demangler::Status status);
+
+	void demangleAll(
+		const std::vector<std::string> &names,
+		std::size_t threads = 0);
+
+	std::size_t size() const;
+
+	void clear();
+
+private:
+	/**
+	 * Result of demangling of a single name.
+	 */
+	struct Entry
+	{
+		const std::string *demangled; ///< Interned demangled name.
+		Demangler::Status status;     ///< Status of the demangler.
+	};
+
+private:
+	void addLocked(
+		const std::string &mangled,
+		const std::string &demangled,
+		Demangler::Status status);
+
+private:
+	/// Name of compiler mangling scheme of the cached names.
+	std::string _compiler;
+	mutable std::shared_mutex _mutex;
+	/// Demangled names, each one is stored only once.
+	std::unordered_set<std::string> _demangled;
+	/// Results for mangled names.
+	std::unordered_map<std::string, Entry> _entries;
+};
+
+}
+}
+
+#endif //RETDEC_DEMANGLER_DEMANGLE_CACHE_H
@@ -24,6 +24,8 @@ class Type;
 
 namespace demangler {
 
+class DemangleCache;
+
 /**
  * Abstract base class for all demanglers
  */
@@ -43,10 +45,12 @@ public:
 public:
 	explicit Demangler(const std::string &compiler);
 
-	virtual ~Demangler() = default;
+	virtual ~Demangler();
 
 	virtual std::string demangleToString(const std::string &mangled) = 0;
 
+	std::string demangleToStringCached(const std::string &mangled);
+
 	virtual std::shared_ptr<ctypes::Function> demangleFunctionToCtypes(
 		const std::string &mangled,
 		std::unique_ptr<ctypes::Module> &module,
@@ -56,9 +60,17 @@ public:
 
 	Status status();
 
+	const std::string &compiler() const;
+
+	DemangleCache &cache();
+
 protected:
 	std::string _compiler;
 	Status _status;
+
+private:
+	/// Names demangled by @c demangleToStringCached().
+	std::unique_ptr<DemangleCache> _cache;
 };
 
 }
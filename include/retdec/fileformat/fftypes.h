@@ -71,7 +71,8 @@ enum LoadFlags
 	NONE              = 0,
 	NO_FILE_HASHES    = 1,
 	NO_VERBOSE_HASHES = 2,
-	DETECT_STRINGS    = 4
+	DETECT_STRINGS    = 4,
+	PARALLEL_LOAD     = 8 ///< use all hardware threads for independent parts of loading
 };
 
 } // namespace fileformat
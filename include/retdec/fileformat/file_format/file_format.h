@@ -8,10 +8,13 @@
 #define RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 
 #include <fstream>
+#include <functional>
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -91,6 +94,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::optional<bool> signatureVerified;                            ///< indicates whether the signature is present and also verified
 		retdec::common::RangeContainer<std::uint64_t> nonDecodableRanges;  ///< Address ranges which should not be decoded for instructions.
 		std::vector<std::pair<std::string, std::string>> anomalies;       ///< file format anomalies
+		std::vector<std::pair<std::string, double>> loadTimes;            ///< durations of table loaders in seconds
+		std::mutex loadMutex;                                             ///< guards data shared by table loaders
 
 		/// @name Clear methods
 		/// @{
@@ -102,6 +107,12 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		void computeSectionTableHashes();
 		/// @}
 
+		/// @name Protected loading methods
+		/// @{
+		void runLoaders(const std::vector<std::pair<std::string, std::function<void()>>> &loaders);
+		void addNonDecodableRange(retdec::common::Range<std::uint64_t> range);
+		/// @}
+
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
@@ -122,8 +133,6 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 				retdec::common::Address entryPoint = retdec::common::Address::Undefined,
 				retdec::common::Address sectionVMA = retdec::common::Address::Undefined);
 		void loadStrings();
-		void loadStrings(StringType type, std::size_t charSize);
-		void loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg);
 		void loadImpHash();
 		void loadExpHash();
 		void loadResourceIconHash();
@@ -267,6 +276,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const std::vector<ElfNoteSecSeg>& getElfNoteSecSegs() const;
 		const std::set<std::uint64_t>& getUnknownRelocations() const;
 		const std::vector<std::pair<std::string,std::string>> &getAnomalies() const;
+		const std::vector<std::pair<std::string, double>> &getLoadTimes() const;
 		/// @}
 
 		/// @name Address interpretation methods
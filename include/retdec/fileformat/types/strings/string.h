@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_H
 #define RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace retdec {
@@ -24,11 +26,24 @@ class String
 		StringType type;
 		std::uint64_t fileOffset;
 		std::string sectionName;
-		std::string content;
+		mutable std::string content;
+		/// @name Not yet materialized content
+		/// @{
+		mutable const std::uint8_t *data = nullptr; ///< first printable byte
+		std::size_t length = 0;                     ///< number of characters
+		std::size_t charSize = 1;                   ///< distance of characters
+		/// @}
 	public:
 		template <typename SectionNameT, typename ContentT>
 		String(StringType type, std::uint64_t fileOffset, SectionNameT&& sectionName, ContentT&& content)
 			: type(type), fileOffset(fileOffset), sectionName(std::forward<SectionNameT>(sectionName)), content(std::forward<ContentT>(content)) {}
+		/**
+		 * Creates string whose content is read from @a data when it is
+		 * needed for the first time. The data must outlive the string.
+		 */
+		template <typename SectionNameT>
+		String(StringType type, std::uint64_t fileOffset, SectionNameT&& sectionName, const std::uint8_t *data, std::size_t length, std::size_t charSize)
+			: type(type), fileOffset(fileOffset), sectionName(std::forward<SectionNameT>(sectionName)), data(data), length(length), charSize(charSize) {}
 		String(const String&) = default;
 		String(String&&) noexcept = default;
 		~String() = default;
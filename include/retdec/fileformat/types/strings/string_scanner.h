@@ -0,0 +1,42 @@
+/**
+ * @file include/retdec/fileformat/types/strings/string_scanner.h
+ * @brief Detection of printable strings in raw bytes.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+#define RETDEC_FILEFORMAT_TYPES_STRINGS_STRING_SCANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string.h"
+
+namespace retdec {
+namespace fileformat {
+
+/**
+ * String found by @c scanStrings(). It only refers to the scanned data.
+ */
+struct StringRecord
+{
+	StringType type;      ///< type of the string
+	std::uint64_t offset; ///< offset of the first character in the scanned data
+	std::uint64_t length; ///< number of characters
+};
+
+std::size_t getStringCharSize(StringType type);
+
+void scanStrings(
+		const std::uint8_t *data,
+		std::size_t size,
+		CharacterEndianness endian,
+		std::size_t minLength,
+		std::vector<StringRecord> &result);
+
+} // namespace fileformat
+} // namespace retdec
+
+#endif
@@ -30,6 +30,7 @@ class byte_array_buffer : public std::streambuf
 		int_type uflow();
 		int_type pbackfail(int_type ch);
 		std::streamsize showmanyc();
+		std::streamsize xsgetn(char_type* s, std::streamsize count);
 
 		std::streampos seekoff(
 				std::streamoff off,
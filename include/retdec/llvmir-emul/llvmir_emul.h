@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include <llvm/CodeGen/IntrinsicLowering.h>
 #include <llvm/ExecutionEngine/GenericValue.h>
@@ -99,21 +100,25 @@ class GlobalExecutionContext
 	public:
 		llvm::Module* _module = nullptr;
 
-		std::map<uint64_t, llvm::GenericValue> memory;
+		std::unordered_map<uint64_t, llvm::GenericValue> memory;
 		std::list<uint64_t> memoryLoads;
 		std::list<uint64_t> memoryStores;
 
-		std::map<llvm::GlobalVariable*, llvm::GenericValue> globals;
+		std::unordered_map<llvm::GlobalVariable*, llvm::GenericValue> globals;
 		std::list<llvm::GlobalVariable*> globalsLoads;
 		std::list<llvm::GlobalVariable*> globalsStores;
 
+		/// Generic values of constants (except constant expressions) are
+		/// computed only once.
+		std::unordered_map<const llvm::Constant*, llvm::GenericValue> constants;
+
 		/// LLVM values of all emulated objects.
 		/// In the original LLVM's interpret implementation, this was in local
 		/// context.
 		/// However, we want to provide this information to the user of this
 		/// library after emulation is done, so we need to preserve it for all
 		/// emulated objects and not to thorw it away after local frame is left.
-		std::map<llvm::Value*, llvm::GenericValue> values;
+		std::unordered_map<llvm::Value*, llvm::GenericValue> values;
 };
 
 class LocalExecutionContext
@@ -161,6 +166,7 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 	// Emulation query methods.
 	//
 	public:
+		void setTracing(bool trace);
 		const std::list<llvm::Instruction*>& getVisitedInstructions() const;
 		const std::list<llvm::BasicBlock*>& getVisitedBasicBlocks() const;
 		bool wasInstructionVisited(llvm::Instruction* i) const;
@@ -261,6 +267,8 @@ class LlvmIrEmulator : public llvm::InstVisitor<LlvmIrEmulator>
 		std::vector<LocalExecutionContext> _ecStack;
 		GlobalExecutionContext _globalEc;
 
+		/// Record visited instructions and basic blocks.
+		bool _trace = true;
 		/// All visited instruction in order of their visitation.
 		/// No cycling checks are performed at the moment -- one instruction
 		/// might be visited multiple times.
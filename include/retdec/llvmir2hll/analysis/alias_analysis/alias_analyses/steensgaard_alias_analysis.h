@@ -0,0 +1,241 @@
+/**
+* @file include/retdec/llvmir2hll/analysis/alias_analysis/alias_analyses/steensgaard_alias_analysis.h
+* @brief A unification-based (Steensgaard-style) alias analysis.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_ANALYSIS_ALIAS_ANALYSIS_ALIAS_ANALYSES_STEENSGAARD_ALIAS_ANALYSIS_H
+#define RETDEC_LLVMIR2HLL_ANALYSIS_ALIAS_ANALYSIS_ALIAS_ANALYSES_STEENSGAARD_ALIAS_ANALYSIS_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class BinaryOpExpr;
+class Expression;
+class Function;
+class Module;
+class Variable;
+
+/**
+* @brief A unification-based (Steensgaard-style) alias analysis.
+*
+* Every variable is represented by a node of a union-find structure. Every
+* class of nodes has at most one pointee class, which represents the memory
+* locations to which the members of the class may point. Assignments unify the
+* pointees of both sides, so the whole module is analyzed in a single pass in
+* almost linear time. The analysis is flow-insensitive and field-insensitive.
+*
+* Memory that is accessible from outside of the module (global variables,
+* arguments of calls by pointers, parameters of functions that are not called
+* directly) is represented by a single escaped class. A pointer whose pointee
+* is the escaped class may point to any variable that has its address taken.
+* Declared (external) functions are assumed not to store pointers passed to
+* them. String literals and functions are represented by a single class of
+* memory that does not belong to any variable.
+*
+* pointsTo() returns a variable only if it is the only variable in the pointee
+* class, the class represents no other memory, and the variable is never
+* accessed through a pointer at an offset (e.g. by pointer arithmetic or as a
+* member of a structure).
+*
+* When init() is called again with the same module, only functions that have
+* changed since the previous call are re-analyzed. Constraints obtained from
+* statements that have been removed in the meantime are kept, which is sound
+* because unification only enlarges the computed sets.
+*
+* Use create() to create instances. Instances of this class have
+* reference object semantics.
+*/
+class SteensgaardAliasAnalysis: public AliasAnalysis, private OrderedAllVisitor {
+public:
+	static ShPtr<AliasAnalysis> create();
+
+	virtual void init(ShPtr<Module> module) override;
+	virtual std::string getId() const override;
+	virtual const VarSet &mayPointTo(ShPtr<Variable> var) const override;
+	virtual ShPtr<Variable> pointsTo(ShPtr<Variable> var) const override;
+	virtual bool mayBePointed(ShPtr<Variable> var) const override;
+	virtual bool resultsChangedByLastInit() const override;
+
+private:
+	/// A node of the union-find structure.
+	using Node = std::size_t;
+
+	/// Mapping of a variable into its node.
+	using VarNodeMap = std::unordered_map<ShPtr<Variable>, Node>;
+
+	/// Mapping of a function into a node.
+	using FuncNodeMap = std::map<ShPtr<Function>, Node>;
+
+	/// Mapping of a name into a function.
+	using NameFuncMap = std::unordered_map<std::string, ShPtr<Function>>;
+
+	/// Mapping of a function into its fingerprint.
+	using FuncFingerprintMap = std::map<ShPtr<Function>, std::size_t>;
+
+	/// Mapping of a class of nodes into the variables in it.
+	using NodeVarSetMap = std::unordered_map<Node, VarSet>;
+
+	/// Represents "no node".
+	static constexpr Node NoNode = static_cast<Node>(-1);
+
+private:
+	SteensgaardAliasAnalysis();
+
+	void reset();
+	void analyzeGlobalVars();
+	void analyzeFunc(ShPtr<Function> func);
+	void makeFuncsCalledFromOutsideEscape();
+	void computeClassVars();
+	void flattenClasses();
+
+	Node createNode();
+	Node find(Node node);
+	Node getClass(Node node) const;
+	Node getPointeeClass(ShPtr<Variable> var) const;
+	void unify(Node node1, Node node2);
+	Node getPointee(Node node);
+	void joinPointees(Node node1, Node node2);
+	Node mergeValues(Node node1, Node node2);
+
+	Node getVarNode(ShPtr<Variable> var);
+	Node getRetNode(ShPtr<Function> func);
+	Node getValueNode(ShPtr<Expression> expr);
+	Node getLocationNode(ShPtr<Expression> expr);
+	Node createNodePointingTo(Node node);
+	void addAddressedVar(ShPtr<Expression> expr);
+	void makeInexact(Node node);
+	void makePointeeInexact(Node node);
+	ShPtr<Function> getFuncForVar(ShPtr<Variable> var) const;
+	void makeFuncEscape(ShPtr<Function> func);
+	void visitArithmOpExpr(ShPtr<BinaryOpExpr> expr);
+	void visitNonPointerOpExpr(ShPtr<BinaryOpExpr> expr);
+
+	/// @name Visitor Interface
+	/// @{
+	using OrderedAllVisitor::visit;
+	virtual void visit(ShPtr<AssignStmt> stmt) override;
+	virtual void visit(ShPtr<VarDefStmt> stmt) override;
+	virtual void visit(ShPtr<ReturnStmt> stmt) override;
+	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
+	virtual void visit(ShPtr<AddOpExpr> expr) override;
+	virtual void visit(ShPtr<AddressOpExpr> expr) override;
+	virtual void visit(ShPtr<AndOpExpr> expr) override;
+	virtual void visit(ShPtr<ArrayIndexOpExpr> expr) override;
+	virtual void visit(ShPtr<AssignOpExpr> expr) override;
+	virtual void visit(ShPtr<BitAndOpExpr> expr) override;
+	virtual void visit(ShPtr<BitOrOpExpr> expr) override;
+	virtual void visit(ShPtr<BitShlOpExpr> expr) override;
+	virtual void visit(ShPtr<BitShrOpExpr> expr) override;
+	virtual void visit(ShPtr<BitXorOpExpr> expr) override;
+	virtual void visit(ShPtr<CallExpr> expr) override;
+	virtual void visit(ShPtr<CommaOpExpr> expr) override;
+	virtual void visit(ShPtr<DerefOpExpr> expr) override;
+	virtual void visit(ShPtr<DivOpExpr> expr) override;
+	virtual void visit(ShPtr<EqOpExpr> expr) override;
+	virtual void visit(ShPtr<GtEqOpExpr> expr) override;
+	virtual void visit(ShPtr<GtOpExpr> expr) override;
+	virtual void visit(ShPtr<LtEqOpExpr> expr) override;
+	virtual void visit(ShPtr<LtOpExpr> expr) override;
+	virtual void visit(ShPtr<ModOpExpr> expr) override;
+	virtual void visit(ShPtr<MulOpExpr> expr) override;
+	virtual void visit(ShPtr<NegOpExpr> expr) override;
+	virtual void visit(ShPtr<NeqOpExpr> expr) override;
+	virtual void visit(ShPtr<NotOpExpr> expr) override;
+	virtual void visit(ShPtr<OrOpExpr> expr) override;
+	virtual void visit(ShPtr<StructIndexOpExpr> expr) override;
+	virtual void visit(ShPtr<SubOpExpr> expr) override;
+	virtual void visit(ShPtr<TernaryOpExpr> expr) override;
+	virtual void visit(ShPtr<Variable> var) override;
+	virtual void visit(ShPtr<BitCastExpr> expr) override;
+	virtual void visit(ShPtr<ExtCastExpr> expr) override;
+	virtual void visit(ShPtr<FPToIntCastExpr> expr) override;
+	virtual void visit(ShPtr<IntToFPCastExpr> expr) override;
+	virtual void visit(ShPtr<IntToPtrCastExpr> expr) override;
+	virtual void visit(ShPtr<PtrToIntCastExpr> expr) override;
+	virtual void visit(ShPtr<TruncCastExpr> expr) override;
+	virtual void visit(ShPtr<ConstArray> constant) override;
+	virtual void visit(ShPtr<ConstBool> constant) override;
+	virtual void visit(ShPtr<ConstFloat> constant) override;
+	virtual void visit(ShPtr<ConstInt> constant) override;
+	virtual void visit(ShPtr<ConstNullPointer> constant) override;
+	virtual void visit(ShPtr<ConstString> constant) override;
+	virtual void visit(ShPtr<ConstStruct> constant) override;
+	virtual void visit(ShPtr<ConstSymbol> constant) override;
+	/// @}
+
+private:
+	/// Parents of nodes in the union-find structure.
+	std::vector<Node> parents;
+
+	/// Ranks of nodes in the union-find structure.
+	std::vector<std::size_t> ranks;
+
+	/// Pointees of nodes (valid only for representatives of classes).
+	std::vector<Node> pointees;
+
+	/// Do classes represent memory that is not a single whole variable, e.g.
+	/// a part of a variable (valid only for representatives of classes)?
+	std::vector<bool> inexact;
+
+	/// The class of memory accessible from outside of the module.
+	Node escapedNode;
+
+	/// The class of memory that does not belong to any variable.
+	Node nonVarMemoryNode;
+
+	/// Nodes of variables.
+	VarNodeMap varNodes;
+
+	/// Nodes of values returned from functions.
+	FuncNodeMap retNodes;
+
+	/// Functions in the module by their names.
+	NameFuncMap funcsByName;
+
+	/// Functions called directly from the module.
+	FuncSet directlyCalledFuncs;
+
+	/// Functions whose address is taken.
+	FuncSet addressTakenFuncs;
+
+	/// Fingerprints of functions from the last analysis of them.
+	FuncFingerprintMap funcFingerprints;
+
+	/// Have the initializers of global variables been analyzed?
+	bool globalVarsAnalyzed;
+
+	/// Fingerprint of global variables from their last analysis.
+	std::size_t globalVarsFingerprint;
+
+	/// All variables in the module whose address is taken.
+	VarSet allAddressedVars;
+
+	/// Variables in every class of nodes (computed after the analysis).
+	NodeVarSetMap classVars;
+
+	/// Has the last call to init() changed the results?
+	bool resultsChanged;
+
+	/// Currently traversed function.
+	ShPtr<Function> func;
+
+	/// Node of the last visited expression.
+	Node lastNode;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -35,6 +35,7 @@ public:
 
 	virtual void init(ShPtr<Module> module);
 	virtual bool isInitialized() const;
+	virtual bool resultsChangedByLastInit() const;
 
 	/**
 	* @brief Returns the set of variables to which @a var may point to.
@@ -9,11 +9,13 @@
 
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 
 #include "retdec/llvmir2hll/support/caching.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvmir2hll/support/valid_state.h"
+#include "retdec/llvmir2hll/support/var_bit_set.h"
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
 #include "retdec/utils/non_copyable.h"
 
@@ -184,6 +186,18 @@ private:
 	/// Set of variables whose address is taken.
 	VarSet addressTakenVars;
 
+	/// Indexes of variables that are directly written or must be written
+	/// into (see ValueAnalysis::getSurelyWrittenVarBits()).
+	VarBitSet surelyWrittenVarBits;
+
+	/// Indexes of variables that are directly written, may be written, or
+	/// must be written into (see ValueAnalysis::getWrittenVarBits()).
+	VarBitSet writtenVarBits;
+
+	/// Numbering of variables in which the above indexes are valid (zero if
+	/// they have not been computed yet).
+	std::size_t varBitsNumbering;
+
 	/// Are there any dereferences?
 	bool containsDerefs;
 
@@ -229,6 +243,15 @@ public:
 	bool mayBePointed(ShPtr<Variable> var) const;
 	/// @}
 
+	/// @name Dense Numbering Of Variables
+	/// @{
+	VarBitSet getVarBitSet(const VarSet &vars, ShPtr<Function> func);
+	const VarBitSet &getWrittenVarBits(ShPtr<ValueData> data,
+		ShPtr<Function> func);
+	const VarBitSet &getSurelyWrittenVarBits(ShPtr<ValueData> data,
+		ShPtr<Function> func);
+	/// @}
+
 	static ShPtr<ValueAnalysis> create(ShPtr<AliasAnalysis> aliasAnalysis,
 		bool enableCaching = false);
 
@@ -238,6 +261,14 @@ private:
 
 	void computeAndStoreIndirectlyUsedVars(ShPtr<DerefOpExpr> expr);
 
+	/// @name Dense Numbering Of Variables
+	/// @{
+	void numberVarsOf(ShPtr<Function> func);
+	void restartVarNumbering();
+	std::size_t getVarIndex(const Variable *var);
+	void computeVarBits(ShPtr<ValueData> data);
+	/// @}
+
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
@@ -317,6 +348,18 @@ private:
 
 	/// Are we removing values from the cache?
 	bool removingFromCache;
+
+	/// Function whose variables are currently numbered (it is only compared,
+	/// never dereferenced).
+	const Function *varIndexesFunc;
+
+	/// Dense indexes of variables of varIndexesFunc (in the order of their
+	/// first use).
+	std::unordered_map<const Variable *, std::size_t> varIndexes;
+
+	/// Current numbering of variables (it changes whenever varIndexes is
+	/// restarted).
+	std::size_t varNumbering;
 };
 
 } // namespace llvmir2hll
@@ -10,6 +10,7 @@
 
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversal.h"
 #include "retdec/llvmir2hll/support/types.h"
+#include "retdec/llvmir2hll/support/var_bit_set.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -34,8 +35,9 @@ private:
 	/// Statements at which we should end the traversal.
 	const StmtSet &ends;
 
-	/// Variables for whose definition/modification we're looking for.
-	const VarSet &vars;
+	/// Indexes of variables for whose definition/modification we're looking
+	/// for (see ValueAnalysis::getVarBitSet()).
+	VarBitSet vars;
 
 	/// Analysis of values.
 	ShPtr<ValueAnalysis> va;
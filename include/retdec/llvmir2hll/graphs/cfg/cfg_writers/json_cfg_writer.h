@@ -0,0 +1,56 @@
+/**
+* @file include/retdec/llvmir2hll/graphs/cfg/cfg_writers/json_cfg_writer.h
+* @brief A CFG writer in the JSON format.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_WRITERS_JSON_CFG_WRITER_H
+#define RETDEC_LLVMIR2HLL_GRAPHS_CFG_CFG_WRITERS_JSON_CFG_WRITER_H
+
+#include <ostream>
+#include <string>
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class CFG;
+
+/**
+* @brief A CFG writer in the JSON format.
+*
+* The CFG is emitted as a single JSON object on a single line (without the
+* trailing newline), so CFGs of several functions can be emitted into a single
+* stream in the JSON Lines format. The object has the following structure:
+* @code
+* {
+*     "function": "name of the function",
+*     "entry": index of the entry node,
+*     "exit": index of the exit node,
+*     "nodes": [{"label": "...", "stmts": ["...", ...]}, ...],
+*     "edges": [{"src": index, "dst": index, "cond": "..."}, ...]
+* }
+* @endcode
+* Nodes are identified by their indexes in @c nodes. The label of a node and
+* the condition of an edge are present only if they are non-empty.
+*
+* Use create() to create instances. Instances of this class have
+* reference object semantics.
+*/
+class JsonCFGWriter: public CFGWriter {
+public:
+	static ShPtr<CFGWriter> create(ShPtr<CFG> cfg, std::ostream &out);
+
+	virtual std::string getId() const override;
+	virtual bool emitCFG() override;
+
+private:
+	JsonCFGWriter(ShPtr<CFG> cfg, std::ostream &out);
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
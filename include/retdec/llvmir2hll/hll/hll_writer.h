@@ -72,8 +72,8 @@ protected:
 	/// @{
 	void increaseIndentLevel();
 	void decreaseIndentLevel();
-	std::string getCurrentIndent() const;
-	std::string getSingleLevelIndent() const;
+	const std::string &getCurrentIndent() const;
+	const std::string &getSingleLevelIndent() const;
 	std::string getIndentForGotoLabel() const;
 	/// @}
 
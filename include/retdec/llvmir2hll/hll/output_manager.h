@@ -9,6 +9,8 @@
 
 #include <string>
 
+#include <llvm/ADT/StringRef.h>
+
 #include "retdec/llvmir2hll/support/types.h"
 
 namespace retdec {
@@ -24,6 +26,11 @@ class OutputManager
 		virtual ~OutputManager();
 		virtual void finalize();
 
+		/// Marks the end of a self-contained part of the output (e.g. a
+		/// function definition). Everything generated so far may be written
+		/// into the underlying stream.
+		virtual void flush();
+
 	// Configuration methods.
 	//
 	public:
@@ -35,37 +42,41 @@ class OutputManager
 
 	// Tokens.
 	//
+	// Tokens are passed as references to strings owned by the caller (string
+	// literals, names of variables, etc.), so no temporary string is created
+	// for them. Output managers must not keep the references after the call.
+	//
 	public:
 		// new line
 		virtual void newLine() = 0;
 		// any whitespace
-		virtual void space(const std::string& space = " ") = 0;
+		virtual void space(llvm::StringRef space = " ") = 0;
 		// e.g. (){}[];
 		virtual void punctuation(char p) = 0;
 		// e.g. == - + * -> .
-		virtual void operatorX(const std::string& op) = 0;
+		virtual void operatorX(llvm::StringRef op) = 0;
 		// identifiers
-		virtual void globalVariableId(const std::string& id) = 0;
-		virtual void localVariableId(const std::string& id) = 0;
-		virtual void memberId(const std::string& id) = 0;
-		virtual void labelId(const std::string& id) = 0;
-		virtual void functionId(const std::string& id) = 0;
-		virtual void parameterId(const std::string& id) = 0;
+		virtual void globalVariableId(llvm::StringRef id) = 0;
+		virtual void localVariableId(llvm::StringRef id) = 0;
+		virtual void memberId(llvm::StringRef id) = 0;
+		virtual void labelId(llvm::StringRef id) = 0;
+		virtual void functionId(llvm::StringRef id) = 0;
+		virtual void parameterId(llvm::StringRef id) = 0;
 		// other
-		virtual void keyword(const std::string& k) = 0;
-		virtual void dataType(const std::string& t) = 0;
-		virtual void preprocessor(const std::string& p) = 0;
-		virtual void include(const std::string& i) = 0;
+		virtual void keyword(llvm::StringRef k) = 0;
+		virtual void dataType(llvm::StringRef t) = 0;
+		virtual void preprocessor(llvm::StringRef p) = 0;
+		virtual void include(llvm::StringRef i) = 0;
 		// constants
-		virtual void constantBool(const std::string& c) = 0;
-		virtual void constantInt(const std::string& c) = 0;
-		virtual void constantFloat(const std::string& c) = 0;
-		virtual void constantString(const std::string& c) = 0;
-		virtual void constantSymbol(const std::string& c) = 0;
-		virtual void constantPointer(const std::string& c) = 0;
+		virtual void constantBool(llvm::StringRef c) = 0;
+		virtual void constantInt(llvm::StringRef c) = 0;
+		virtual void constantFloat(llvm::StringRef c) = 0;
+		virtual void constantString(llvm::StringRef c) = 0;
+		virtual void constantSymbol(llvm::StringRef c) = 0;
+		virtual void constantPointer(llvm::StringRef c) = 0;
 		// comment_prefix comment
 		virtual void comment(
-			const std::string& comment) = 0;
+			llvm::StringRef comment) = 0;
 
 	// Special methods.
 	//
@@ -90,27 +101,27 @@ class OutputManager
 	public:
 		// [space]op[space]
 		virtual void operatorX(
-			const std::string& op,
+			llvm::StringRef op,
 			bool spaceBefore,
 			bool spaceAfter);
 		// indent// comment
 		virtual void comment(
-			const std::string& comment,
-			const std::string& indent);
+			llvm::StringRef comment,
+			llvm::StringRef indent);
 		// [indent]// comment\n
 		virtual void commentLine(
-			const std::string& comment,
-			const std::string& indent = "");
+			llvm::StringRef comment,
+			llvm::StringRef indent = "");
 		// [indent]#include <include>[ // comment]
 		virtual void includeLine(
-			const std::string& header,
-			const std::string& indent = "",
-			const std::string& comment = "");
+			llvm::StringRef header,
+			llvm::StringRef indent = "",
+			llvm::StringRef comment = "");
 		// [indent]typedef t1 t2;
 		virtual void typedefLine(
-			const std::string& indent,
-			const std::string& t1,
-			const std::string& t2);
+			llvm::StringRef indent,
+			llvm::StringRef t1,
+			llvm::StringRef t2);
 
 	// Data.
 	//
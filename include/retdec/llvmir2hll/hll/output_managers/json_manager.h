@@ -23,35 +23,45 @@ namespace llvmir2hll {
 
 class OutputManager;
 
+/**
+ * Generates tokens as JSON.
+ *
+ * By default, the whole output is a single JSON object. If @c lines is set,
+ * the output is in the JSON Lines (NDJSON) format -- every part of the output
+ * ended by @c flush() (e.g. a function definition) is a separate JSON object
+ * on its own line. Each of these objects has the same structure as the single
+ * object generated in the default mode.
+ */
 template <typename Writer>
 class JsonOutputManager : public OutputManager
 {
 	public:
-		JsonOutputManager(llvm::raw_ostream& out);
+		JsonOutputManager(llvm::raw_ostream& out, bool lines = false);
 		virtual void finalize() override;
+		virtual void flush() override;
 
 	public:
 		virtual void newLine() override;
-		virtual void space(const std::string& space = " ") override;
+		virtual void space(llvm::StringRef space = " ") override;
 		virtual void punctuation(char p) override;
-		virtual void operatorX(const std::string& op) override;
-		virtual void globalVariableId(const std::string& id) override;
-		virtual void localVariableId(const std::string& id) override;
-		virtual void memberId(const std::string& id) override;
-		virtual void labelId(const std::string& id) override;
-		virtual void functionId(const std::string& id) override;
-		virtual void parameterId(const std::string& id) override;
-		virtual void keyword(const std::string& k) override;
-		virtual void dataType(const std::string& t) override;
-		virtual void preprocessor(const std::string& p) override;
-		virtual void include(const std::string& i) override;
-		virtual void constantBool(const std::string& c) override;
-		virtual void constantInt(const std::string& c) override;
-		virtual void constantFloat(const std::string& c) override;
-		virtual void constantString(const std::string& c) override;
-		virtual void constantSymbol(const std::string& c) override;
-		virtual void constantPointer(const std::string& c) override;
-		virtual void comment(const std::string& comment) override;
+		virtual void operatorX(llvm::StringRef op) override;
+		virtual void globalVariableId(llvm::StringRef id) override;
+		virtual void localVariableId(llvm::StringRef id) override;
+		virtual void memberId(llvm::StringRef id) override;
+		virtual void labelId(llvm::StringRef id) override;
+		virtual void functionId(llvm::StringRef id) override;
+		virtual void parameterId(llvm::StringRef id) override;
+		virtual void keyword(llvm::StringRef k) override;
+		virtual void dataType(llvm::StringRef t) override;
+		virtual void preprocessor(llvm::StringRef p) override;
+		virtual void include(llvm::StringRef i) override;
+		virtual void constantBool(llvm::StringRef c) override;
+		virtual void constantInt(llvm::StringRef c) override;
+		virtual void constantFloat(llvm::StringRef c) override;
+		virtual void constantString(llvm::StringRef c) override;
+		virtual void constantSymbol(llvm::StringRef c) override;
+		virtual void constantPointer(llvm::StringRef c) override;
+		virtual void comment(llvm::StringRef comment) override;
 
 	public:
 		virtual void commentModifier() override;
@@ -59,11 +69,20 @@ class JsonOutputManager : public OutputManager
 		virtual void addressPop() override;
 
 	private:
-		void jsonToken(const std::string& k, const std::string& v);
+		void jsonToken(llvm::StringRef k, llvm::StringRef v);
 		void generateAddressEntry(Address a);
+		void startRecord();
+		void endRecord();
+		void writeBuffer();
 
 	private:
 		llvm::raw_ostream& _out;
+		/// Generate one JSON object per line (NDJSON).
+		bool _lines = false;
+		/// No token was generated into the current JSON object.
+		bool _recordEmpty = true;
+		/// Number of JSON objects already written in the lines mode.
+		std::size_t _recordsWritten = 0;
 
 		rapidjson::StringBuffer sb;
 		Writer writer;
@@ -18,29 +18,30 @@ class PlainOutputManager : public OutputManager
 {
 	public:
 		PlainOutputManager(llvm::raw_ostream& out);
+		virtual void finalize() override;
 
 	public:
 		virtual void newLine() override;
-		virtual void space(const std::string& space = " ") override;
+		virtual void space(llvm::StringRef space = " ") override;
 		virtual void punctuation(char p) override;
-		virtual void operatorX(const std::string& op) override;
-		virtual void globalVariableId(const std::string& id) override;
-		virtual void localVariableId(const std::string& id) override;
-		virtual void memberId(const std::string& id) override;
-		virtual void labelId(const std::string& id) override;
-		virtual void functionId(const std::string& id) override;
-		virtual void parameterId(const std::string& id) override;
-		virtual void keyword(const std::string& k) override;
-		virtual void dataType(const std::string& t) override;
-		virtual void preprocessor(const std::string& p) override;
-		virtual void include(const std::string& i) override;
-		virtual void constantBool(const std::string& c) override;
-		virtual void constantInt(const std::string& c) override;
-		virtual void constantFloat(const std::string& c) override;
-		virtual void constantString(const std::string& c) override;
-		virtual void constantSymbol(const std::string& c) override;
-		virtual void constantPointer(const std::string& c) override;
-		virtual void comment(const std::string& comment) override;
+		virtual void operatorX(llvm::StringRef op) override;
+		virtual void globalVariableId(llvm::StringRef id) override;
+		virtual void localVariableId(llvm::StringRef id) override;
+		virtual void memberId(llvm::StringRef id) override;
+		virtual void labelId(llvm::StringRef id) override;
+		virtual void functionId(llvm::StringRef id) override;
+		virtual void parameterId(llvm::StringRef id) override;
+		virtual void keyword(llvm::StringRef k) override;
+		virtual void dataType(llvm::StringRef t) override;
+		virtual void preprocessor(llvm::StringRef p) override;
+		virtual void include(llvm::StringRef i) override;
+		virtual void constantBool(llvm::StringRef c) override;
+		virtual void constantInt(llvm::StringRef c) override;
+		virtual void constantFloat(llvm::StringRef c) override;
+		virtual void constantString(llvm::StringRef c) override;
+		virtual void constantSymbol(llvm::StringRef c) override;
+		virtual void constantPointer(llvm::StringRef c) override;
+		virtual void comment(llvm::StringRef comment) override;
 
 	public:
 		virtual void commentModifier() override;
@@ -34,6 +34,12 @@ class Type;
 
 /**
 * @brief A converter from LLVM type to type in BIR.
+*
+* LLVM types are unique within an LLVM context and every converted type is
+* stored, so each LLVM type is converted into a single type in BIR. Together
+* with the caches of primitive types (see, e.g., IntType::create()), this makes
+* equal types converted by a single converter identical, which is utilized by
+* the @c isEqualTo() functions of types.
 */
 class LLVMTypeConverter final: private retdec::utils::NonCopyable {
 public:
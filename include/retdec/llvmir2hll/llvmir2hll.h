@@ -131,6 +131,7 @@ private:
 	void validateResultingModule();
 	void findPatterns();
 	void emitCFGs();
+	void emitCFGsIntoSingleFile(const std::string &cfgWriterId);
 	void emitCG();
 	void emitTargetHLLCode();
 	void finalize();
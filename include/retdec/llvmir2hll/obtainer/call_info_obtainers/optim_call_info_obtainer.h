@@ -171,8 +171,6 @@ private:
 
 	static bool areDifferent(ShPtr<OptimFuncInfo> fi1,
 		ShPtr<OptimFuncInfo> fi2);
-	static bool hasChanged(const FuncInfoMap &oldInfo,
-		const FuncInfoMap &newInfo);
 
 private:
 	/// Mapping of a function into its info.
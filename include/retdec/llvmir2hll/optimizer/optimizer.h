@@ -10,6 +10,7 @@
 #include <string>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
 #include "retdec/utils/non_copyable.h"
 
@@ -51,6 +52,9 @@ public:
 
 	ShPtr<Module> optimize();
 
+	virtual bool canSkipUnchangedFuncs() const;
+	void setFuncsToSkip(const FuncSet &funcs);
+
 	/**
 	* @brief Creates an instance of OptimizerType with the given arguments and
 	*        optimizes the given module by it.
@@ -74,9 +78,15 @@ protected:
 	virtual void doOptimization();
 	virtual void doFinalization();
 
+	bool shouldBeSkipped(ShPtr<Function> func) const;
+
 protected:
 	/// The module that is being optimized.
 	ShPtr<Module> module;
+
+private:
+	/// Functions that should not be optimized.
+	FuncSet funcsToSkip;
 };
 
 } // namespace llvmir2hll
@@ -7,6 +7,10 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 
+#include <cstddef>
+#include <map>
+#include <string>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
@@ -17,6 +21,7 @@ namespace llvmir2hll {
 
 class ArithmExprEvaluator;
 class CallInfoObtainer;
+class Function;
 class HLLWriter;
 class Module;
 class ValueAnalysis;
@@ -39,12 +44,35 @@ public:
 private:
 	void printOptimization(const std::string &optName) const;
 	bool optShouldBeRun(const std::string &optName) const;
-	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer);
+	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer,
+		ShPtr<Module> m);
 	bool shouldSecondCopyPropagationBeRun() const;
+	FuncSet getFuncsUnchangedSinceLastRun(const std::string &optId,
+		ShPtr<Module> m) const;
+	void recordRunOfOptimizer(const std::string &optId, ShPtr<Module> m,
+		std::size_t numOfSkippedFuncs, double runTime);
+	void printSkippedFuncsStatistics() const;
 
 	template<typename Optimization, typename... Args>
 	void run(ShPtr<Module> m, Args &&... args);
 
+private:
+	/// Mapping of functions into their fingerprints.
+	using FuncFingerprints = std::map<ShPtr<Function>, std::size_t>;
+
+	/// Information about the last run of an optimization that can skip
+	/// unchanged functions.
+	struct OptRunInfo {
+		/// Fingerprints of functions after the run.
+		FuncFingerprints funcFingerprints;
+
+		/// Fingerprint of global variables after the run.
+		std::size_t globalVarsFingerprint = 0;
+
+		/// Average time needed to optimize a single function (in seconds).
+		double timePerFunc = 0;
+	};
+
 private:
 	/// No other optimization than these will be run.
 	const StringSet enabledOpts;
@@ -72,6 +100,20 @@ private:
 
 	/// List of our optimizations that were run.
 	StringSet backendRunOpts;
+
+	/// Last runs of optimizations that can skip unchanged functions.
+	std::map<std::string, OptRunInfo> lastOptRuns;
+
+	/// Number of functions passed to optimizations that can skip unchanged
+	/// functions.
+	std::size_t numOfFuncOptimizations;
+
+	/// Number of functions skipped by optimizations because they were
+	/// unchanged.
+	std::size_t numOfSkippedFuncOptimizations;
+
+	/// Estimated time saved by skipping unchanged functions (in seconds).
+	double savedTime;
 };
 
 } // namespace llvmir2hll
@@ -67,6 +67,7 @@ public:
 		ShPtr<CallInfoObtainer> cio);
 
 	virtual std::string getId() const override { return "CopyPropagation"; }
+	virtual bool canSkipUnchangedFuncs() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
@@ -44,6 +44,7 @@ public:
 	DeadLocalAssignOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va);
 
 	virtual std::string getId() const override { return "DeadLocalAssign"; }
+	virtual bool canSkipUnchangedFuncs() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
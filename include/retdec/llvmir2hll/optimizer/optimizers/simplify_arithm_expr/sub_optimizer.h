@@ -28,6 +28,7 @@ public:
 	*/
 	virtual std::string getId() const = 0;
 	virtual bool tryOptimize(ShPtr<Expression> expr);
+	ShPtr<Expression> getOptimizedExpr() const;
 
 protected:
 	SubOptimizer(ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
@@ -41,7 +42,11 @@ protected:
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
 
 private:
+	/// @c true if the expression was optimized, @c false otherwise.
 	bool codeChanged;
+
+	/// The expression that has replaced the optimized expression.
+	ShPtr<Expression> optimizedExpr;
 };
 
 } // namespace llvmir2hll
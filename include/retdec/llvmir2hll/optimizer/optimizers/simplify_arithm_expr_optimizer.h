@@ -32,6 +32,7 @@ public:
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
 
 	virtual std::string getId() const override { return "SimplifyArithmExpr"; }
+	virtual bool canSkipUnchangedFuncs() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
@@ -68,10 +69,6 @@ private:
 private:
 	/// Vector of sub-optimizations.
 	SubOptimVec subOptims;
-
-	/// @c true if the module was optimized in a sub/optimization, @c false
-	/// otherwise.
-	bool codeChanged;
 };
 
 } // namespace llvmir2hll
@@ -0,0 +1,127 @@
+/**
+* @file include/retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h
+* @brief A compact map used to store the semantics tables.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_FLAT_MAP_H
+#define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_FLAT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief A compact hash map with open addressing.
+*
+* All the entries are stored in a single vector and the hash table only
+* contains their indexes, so filling the map with thousands of entries does
+* not allocate a node for each of them. The semantics tables use
+* <tt>std::string_view</tt> keys and values pointing to string literals, so
+* the strings are not copied either.
+*
+* The map is filled once (upon the initialization of a semantics table) and
+* only searched afterwards. Entries cannot be removed.
+*
+* @tparam Key Type of keys.
+* @tparam Value Type of values.
+* @tparam Hash Hashing functor for @a Key.
+*/
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatMap {
+public:
+	/**
+	* @brief Returns a reference to the value of the given key, inserting a
+	*        default-constructed value if there is no such key.
+	*
+	* The reference is valid only until the next insertion.
+	*/
+	Value &operator[](const Key &key) {
+		if (auto i = findIndex(key); i != NotFound) {
+			return entries[i].second;
+		}
+
+		if (2 * (entries.size() + 1) > slots.size()) {
+			rehash(slots.empty() ? 16 : 2 * slots.size());
+		}
+		entries.emplace_back(key, Value());
+		insertIndex(entries.size() - 1);
+		return entries.back().second;
+	}
+
+	/**
+	* @brief Returns a pointer to the value of the given key, or @c nullptr if
+	*        there is no such key.
+	*/
+	const Value *find(const Key &key) const {
+		auto i = findIndex(key);
+		return i != NotFound ? &entries[i].second : nullptr;
+	}
+
+	/**
+	* @brief Returns the number of entries in the map.
+	*/
+	std::size_t size() const {
+		return entries.size();
+	}
+
+	/**
+	* @brief Returns @c true if the map has no entries.
+	*/
+	bool empty() const {
+		return entries.empty();
+	}
+
+private:
+	/// Marks an empty slot and a missing entry.
+	static constexpr std::uint32_t NotFound = UINT32_MAX;
+
+	std::uint32_t findIndex(const Key &key) const {
+		if (slots.empty()) {
+			return NotFound;
+		}
+
+		auto mask = slots.size() - 1;
+		for (auto s = Hash()(key) & mask; slots[s] != NotFound; s = (s + 1) & mask) {
+			if (entries[slots[s]].first == key) {
+				return slots[s];
+			}
+		}
+		return NotFound;
+	}
+
+	void insertIndex(std::size_t index) {
+		auto mask = slots.size() - 1;
+		auto s = Hash()(entries[index].first) & mask;
+		while (slots[s] != NotFound) {
+			s = (s + 1) & mask;
+		}
+		slots[s] = static_cast<std::uint32_t>(index);
+	}
+
+	void rehash(std::size_t slotCount) {
+		slots.assign(slotCount, NotFound);
+		for (std::size_t i = 0, e = entries.size(); i != e; ++i) {
+			insertIndex(i);
+		}
+	}
+
+private:
+	/// Entries in the order of their insertion.
+	std::vector<std::pair<Key, Value>> entries;
+
+	/// Indexes of entries (the size is always a power of two).
+	std::vector<std::uint32_t> slots;
+};
+
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
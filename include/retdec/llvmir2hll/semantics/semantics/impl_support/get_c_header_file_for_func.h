@@ -9,8 +9,10 @@
 
 #include <cstddef>
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h"
 #include "retdec/utils/array.h"
 
 /**
@@ -31,9 +33,12 @@ namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
+/// Mapping of function names into the names of their header files.
+using FuncCHeaderMap = FlatMap<std::string_view, std::string_view>;
+
 std::optional<std::string> getCHeaderFileForFuncFromMap(
 		const std::string &funcName,
-		const StringStringUMap &map);
+		const FuncCHeaderMap &map);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -10,7 +10,9 @@
 #include <cstddef>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h"
 
 /**
 * @brief Sets a name of the given parameter for the given function.
@@ -23,20 +25,20 @@ namespace llvmir2hll {
 namespace semantics {
 
 /// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
+using FuncParamPosPair = std::pair<std::string_view, unsigned>;
 
 /**
 * @brief A hashing functor for FuncParamPosPair.
 */
 struct FuncParamPosPairHasher {
 	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
+		return std::hash<std::string_view>()(p.first) + p.second;
 	}
 };
 
 /// Mapping of a function name and parameter position into the name of this
 /// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
+using FuncParamNamesMap = FlatMap<FuncParamPosPair, std::string_view,
 	FuncParamPosPairHasher>;
 
 std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
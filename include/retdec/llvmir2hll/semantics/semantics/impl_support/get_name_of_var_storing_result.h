@@ -8,15 +8,20 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_VAR_STORING_RESULT_H
 
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
+/// Mapping of function names into the names of variables storing their results.
+using FuncVarNameMap = FlatMap<std::string_view, std::string_view>;
+
 std::optional<std::string> getNameOfVarStoringResultFromMap(
-	const std::string &funcName, const StringStringUMap &map);
+	const std::string &funcName, const FuncVarNameMap &map);
 
 } // namespace semantics
 } // namespace llvmir2hll
@@ -9,8 +9,9 @@
 
 #include <map>
 #include <optional>
-#include <unordered_map>
+#include <string_view>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h"
 #include "retdec/llvmir2hll/support/types.h"
 
 /**
@@ -68,7 +69,7 @@ namespace semantics {
 using ParamSymbolsMap = std::map<unsigned, IntStringMap>;
 
 /// Mapping of a function name into ParamSymbolsMap.
-using FuncParamsMap = std::unordered_map<std::string, ParamSymbolsMap>;
+using FuncParamsMap = FlatMap<std::string_view, ParamSymbolsMap>;
 
 std::optional<IntStringMap> getSymbolicNamesForParamFromMap(
 	const std::string &funcName,
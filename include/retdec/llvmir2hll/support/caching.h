@@ -89,6 +89,22 @@ public:
 		cache.erase(key);
 	}
 
+	/**
+	* @brief Removes all the cached values for which @a pred returns @c true.
+	*
+	* Their keys are removed as well.
+	*/
+	template<typename Predicate>
+	void removeFromCacheIf(Predicate pred) {
+		for (auto i = cache.begin(); i != cache.end(); ) {
+			if (pred(i->second)) {
+				i = cache.erase(i);
+			} else {
+				++i;
+			}
+		}
+	}
+
 	/**
 	* @brief Returns @c true if caching is enabled, @c false otherwise.
 	*/
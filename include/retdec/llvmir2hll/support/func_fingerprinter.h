@@ -0,0 +1,121 @@
+/**
+* @file include/retdec/llvmir2hll/support/func_fingerprinter.h
+* @brief Computation of fingerprints of functions.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_FUNC_FINGERPRINTER_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_FUNC_FINGERPRINTER_H
+
+#include <cstddef>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Module;
+class Value;
+
+/**
+* @brief Computation of fingerprints of functions.
+*
+* A fingerprint is a hash of the identities, kinds, and order of all the
+* statements and expressions in a function, together with the data that can
+* be changed in place (names and types of variables, values of constants,
+* targets of goto statements). If a function is changed in any way, its
+* fingerprint changes as well (up to hash collisions). It is used to find out
+* whether a function has been changed between two points in time without
+* keeping a copy of the function.
+*
+* This class implements the "static helper" (or "library") design pattern (it
+* has just static functions and no instances can be created).
+*/
+class FuncFingerprinter: private OrderedAllVisitor,
+		private retdec::utils::NonCopyable {
+public:
+	static std::size_t getFingerprint(ShPtr<Function> func);
+	static std::size_t getGlobalVarsFingerprint(ShPtr<Module> module);
+
+private:
+	FuncFingerprinter();
+
+	void addToFingerprint(std::size_t hash);
+	void addValueToFingerprint(ShPtr<Value> value);
+
+	/// @name Visitor Interface
+	/// @{
+	using OrderedAllVisitor::visit;
+	virtual void visit(ShPtr<GlobalVarDef> varDef) override;
+	virtual void visit(ShPtr<Function> func) override;
+	virtual void visit(ShPtr<AssignStmt> stmt) override;
+	virtual void visit(ShPtr<BreakStmt> stmt) override;
+	virtual void visit(ShPtr<CallStmt> stmt) override;
+	virtual void visit(ShPtr<ContinueStmt> stmt) override;
+	virtual void visit(ShPtr<EmptyStmt> stmt) override;
+	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
+	virtual void visit(ShPtr<UForLoopStmt> stmt) override;
+	virtual void visit(ShPtr<GotoStmt> stmt) override;
+	virtual void visit(ShPtr<IfStmt> stmt) override;
+	virtual void visit(ShPtr<ReturnStmt> stmt) override;
+	virtual void visit(ShPtr<SwitchStmt> stmt) override;
+	virtual void visit(ShPtr<UnreachableStmt> stmt) override;
+	virtual void visit(ShPtr<VarDefStmt> stmt) override;
+	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
+	virtual void visit(ShPtr<AddOpExpr> expr) override;
+	virtual void visit(ShPtr<AddressOpExpr> expr) override;
+	virtual void visit(ShPtr<AndOpExpr> expr) override;
+	virtual void visit(ShPtr<ArrayIndexOpExpr> expr) override;
+	virtual void visit(ShPtr<AssignOpExpr> expr) override;
+	virtual void visit(ShPtr<BitAndOpExpr> expr) override;
+	virtual void visit(ShPtr<BitOrOpExpr> expr) override;
+	virtual void visit(ShPtr<BitShlOpExpr> expr) override;
+	virtual void visit(ShPtr<BitShrOpExpr> expr) override;
+	virtual void visit(ShPtr<BitXorOpExpr> expr) override;
+	virtual void visit(ShPtr<CallExpr> expr) override;
+	virtual void visit(ShPtr<CommaOpExpr> expr) override;
+	virtual void visit(ShPtr<DerefOpExpr> expr) override;
+	virtual void visit(ShPtr<DivOpExpr> expr) override;
+	virtual void visit(ShPtr<EqOpExpr> expr) override;
+	virtual void visit(ShPtr<GtEqOpExpr> expr) override;
+	virtual void visit(ShPtr<GtOpExpr> expr) override;
+	virtual void visit(ShPtr<LtEqOpExpr> expr) override;
+	virtual void visit(ShPtr<LtOpExpr> expr) override;
+	virtual void visit(ShPtr<ModOpExpr> expr) override;
+	virtual void visit(ShPtr<MulOpExpr> expr) override;
+	virtual void visit(ShPtr<NegOpExpr> expr) override;
+	virtual void visit(ShPtr<NeqOpExpr> expr) override;
+	virtual void visit(ShPtr<NotOpExpr> expr) override;
+	virtual void visit(ShPtr<OrOpExpr> expr) override;
+	virtual void visit(ShPtr<StructIndexOpExpr> expr) override;
+	virtual void visit(ShPtr<SubOpExpr> expr) override;
+	virtual void visit(ShPtr<TernaryOpExpr> expr) override;
+	virtual void visit(ShPtr<Variable> var) override;
+	virtual void visit(ShPtr<BitCastExpr> expr) override;
+	virtual void visit(ShPtr<ExtCastExpr> expr) override;
+	virtual void visit(ShPtr<FPToIntCastExpr> expr) override;
+	virtual void visit(ShPtr<IntToFPCastExpr> expr) override;
+	virtual void visit(ShPtr<IntToPtrCastExpr> expr) override;
+	virtual void visit(ShPtr<PtrToIntCastExpr> expr) override;
+	virtual void visit(ShPtr<TruncCastExpr> expr) override;
+	virtual void visit(ShPtr<ConstArray> constant) override;
+	virtual void visit(ShPtr<ConstBool> constant) override;
+	virtual void visit(ShPtr<ConstFloat> constant) override;
+	virtual void visit(ShPtr<ConstInt> constant) override;
+	virtual void visit(ShPtr<ConstNullPointer> constant) override;
+	virtual void visit(ShPtr<ConstString> constant) override;
+	virtual void visit(ShPtr<ConstStruct> constant) override;
+	virtual void visit(ShPtr<ConstSymbol> constant) override;
+	/// @}
+
+private:
+	/// The fingerprint computed so far.
+	std::size_t fingerprint;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -0,0 +1,62 @@
+/**
+* @file include/retdec/llvmir2hll/support/var_bit_set.h
+* @brief A set of densely numbered variables.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_VAR_BIT_SET_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_VAR_BIT_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief A set of variables represented by their dense indexes.
+*
+* Every variable is represented by a single bit whose position is the index of
+* the variable (see ValueAnalysis::getVarBitSet()). The first 64 indexes are
+* stored inline, so sets of variables from small functions do not allocate any
+* memory. Unions, intersections, and membership tests are word operations.
+*
+* Instances of this class have value object semantics.
+*/
+class VarBitSet {
+public:
+	VarBitSet();
+
+	bool operator==(const VarBitSet &other) const;
+	bool operator!=(const VarBitSet &other) const;
+	VarBitSet &operator|=(const VarBitSet &other);
+	VarBitSet &operator&=(const VarBitSet &other);
+
+	void insert(std::size_t index);
+	void clear();
+
+	bool contains(std::size_t index) const;
+	bool intersects(const VarBitSet &other) const;
+	bool empty() const;
+	std::size_t size() const;
+
+private:
+	/// Number of indexes stored in a single word.
+	static constexpr std::size_t BitsPerWord = 64;
+
+private:
+	std::uint64_t getWord(std::size_t i) const;
+
+private:
+	/// Indexes smaller than BitsPerWord.
+	std::uint64_t firstWord;
+
+	/// Indexes greater or equal to BitsPerWord.
+	std::vector<std::uint64_t> otherWords;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -7,8 +7,11 @@
 #ifndef RETDEC_LLVMIR2HLL_VAR_RENAMER_VAR_RENAMER_H
 #define RETDEC_LLVMIR2HLL_VAR_RENAMER_VAR_RENAMER_H
 
+#include <cstddef>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
 #include "retdec/llvmir2hll/var_name_gen/var_name_gen.h"
@@ -38,6 +41,12 @@ namespace llvmir2hll {
 *  (3) Other variables are assigned a name by using the passed variable name
 *      generator.
 *
+* When more than one thread is passed to renameVars() and the renamer names
+* variables in every function independently of other functions (see
+* canRenameFuncsIndependently()), functions are renamed in parallel. The
+* assigned names are the same as when renaming the functions one after
+* another.
+*
 * Notes:
 *  - use assignName() to assign a new to a variable (it not only checks that
 *    that the assigned name would not result in a name clash but also update data
@@ -53,7 +62,7 @@ public:
 	*/
 	virtual std::string getId() const = 0;
 
-	void renameVars(ShPtr<Module> module);
+	void renameVars(ShPtr<Module> module, std::size_t threads = 1);
 
 protected:
 	VarRenamer(ShPtr<VarNameGen> varNameGen, bool useDebugNames = true);
@@ -69,6 +78,7 @@ protected:
 		ShPtr<Function> func = nullptr) const;
 	ShPtr<Function> getFuncByName(const std::string &name) const;
 
+	virtual bool canRenameFuncsIndependently() const;
 	virtual void doVarsRenaming();
 
 	/// @name Renaming Using Debug Names
@@ -99,11 +109,14 @@ protected:
 	/// @}
 
 protected:
-	/// Mapping of a function into a set of strings.
-	using FuncStringSetMap = std::map<ShPtr<Function>, StringSet>;
+	/// Set of assigned names.
+	using NameSet = std::unordered_set<std::string>;
+
+	/// Mapping of a function into a set of assigned names.
+	using FuncNameSetMap = std::map<ShPtr<Function>, NameSet>;
 
 	/// Mapping of a function's name into the function.
-	using FuncByNameMap = std::map<std::string, ShPtr<Function>>;
+	using FuncByNameMap = std::unordered_map<std::string, ShPtr<Function>>;
 
 protected:
 	/// Used generator of variable names.
@@ -129,20 +142,25 @@ protected:
 	VarSet renamedVars;
 
 	/// Assigned names of global variables.
-	StringSet globalVarsNames;
+	NameSet globalVarsNames;
 
 	/// Assigned names to local variables of all functions in the module,
 	/// including function parameters.
 	///
 	/// To get the set of names assigned to the current function @c func,
 	/// use @c localVarsNames[func].
-	FuncStringSetMap localVarsNames;
+	FuncNameSetMap localVarsNames;
 
 	/// The currently visited function.
 	ShPtr<Function> currFunc;
 
+	/// Maximal number of threads used to rename variables in functions.
+	std::size_t threads;
+
 private:
 	void storeFuncsByName();
+	bool renameVarsInFuncsInParallel();
+	bool funcsUseOnlyOwnVars(const FuncVector &funcs) const;
 	std::string ensureNameUniqueness(ShPtr<Variable> var,
 		const std::string &name, ShPtr<Function> func = nullptr);
 	std::string generateUniqueName(ShPtr<Variable> var,
@@ -41,6 +41,7 @@ public:
 private:
 	AddressVarRenamer(ShPtr<VarNameGen> varNameGen, bool useDebugNames);
 
+	virtual bool canRenameFuncsIndependently() const override;
 	virtual void renameGlobalVar(ShPtr<Variable> var) override;
 	virtual void renameVarsInFunc(ShPtr<Function> func) override;
 	virtual void renameFuncParam(ShPtr<Variable> var,
@@ -58,6 +58,7 @@ public:
 	virtual std::string getId() const override;
 
 private:
+	virtual bool canRenameFuncsIndependently() const override;
 	virtual void renameGlobalVar(ShPtr<Variable> var) override;
 	virtual void renameVarsInFunc(ShPtr<Function> func) override;
 	virtual void renameFuncParam(ShPtr<Variable> var,
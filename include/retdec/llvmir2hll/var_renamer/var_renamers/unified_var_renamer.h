@@ -34,6 +34,7 @@ public:
 private:
 	UnifiedVarRenamer(ShPtr<VarNameGen> varNameGen, bool useDebugNames);
 
+	virtual bool canRenameFuncsIndependently() const override;
 	virtual void renameGlobalVar(ShPtr<Variable> var) override;
 	virtual void renameVarsInFunc(ShPtr<Function> func) override;
 	virtual void renameFuncParam(ShPtr<Variable> var,
@@ -7,6 +7,8 @@
 #ifndef RETDEC_LOADER_IMAGE_FACTORY_H
 #define RETDEC_LOADER_IMAGE_FACTORY_H
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -18,6 +20,10 @@ namespace loader {
 std::unique_ptr<Image> createImage(
 		const std::string& filePath,
 		bool isRaw = false);
+std::unique_ptr<Image> createImage(
+		const std::uint8_t* data,
+		std::size_t size,
+		bool isRaw = false);
 std::unique_ptr<Image> createImage(
 		const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat);
 
@@ -8,10 +8,12 @@
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
 #include <memory>
+#include <mutex>
 
 #include "retdec/utils/byte_value_storage.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
+#include "retdec/loader/loader/pointer_map.h"
 #include "retdec/loader/loader/segment.h"
 #include "retdec/loader/utils/name_generator.h"
 
@@ -59,6 +61,7 @@ public:
 	bool hasReadOnlyDataOnAddress(std::uint64_t address) const;
 	bool hasSegmentOnAddress(std::uint64_t address) const;
 	bool isPointer(std::uint64_t address, std::uint64_t* pointer = nullptr) const;
+	const PointerMap& getPointerMap() const;
 
 	Segment* getSegment(std::size_t index);
 	Segment* getSegment(const std::string& name);
@@ -84,6 +87,8 @@ protected:
 	void setStatusMessage(const std::string& message);
 
 private:
+	void invalidatePointerMap();
+
 	const Segment* _getSegment(std::size_t index) const;
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
@@ -94,6 +99,10 @@ private:
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
+	/// Lazily built by getPointerMap().
+	mutable std::unique_ptr<PointerMap> _pointerMap;
+	/// Guards building of @c _pointerMap from concurrent const queries.
+	mutable std::mutex _pointerMapMutex;
 };
 
 } // namespace loader
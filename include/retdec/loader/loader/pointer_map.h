@@ -0,0 +1,104 @@
+/**
+ * @file include/retdec/loader/loader/pointer_map.h
+ * @brief Declaration of pointer map class.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_LOADER_RETDEC_LOADER_POINTER_MAP_H
+#define RETDEC_LOADER_RETDEC_LOADER_POINTER_MAP_H
+
+#include <cstdint>
+#include <vector>
+
+namespace retdec {
+namespace loader {
+
+class Image;
+
+/**
+ * Classification of all the words in data segments of an image -- for every
+ * word, it is known if it is a pointer into some (code or data) segment.
+ *
+ * Words are considered from the start of each data segment with a step of
+ * the image's word size. Queries for other addresses are not answered by the
+ * map, and the caller must fall back to the generic (slow) check.
+ *
+ * The map reflects the image at the time of building. @c Image throws it
+ * away when its content or segments change. Words are read from the image's
+ * segments when they are queried, the map itself keeps only their offsets.
+ */
+class PointerMap
+{
+public:
+	/**
+	 * Kind of a word value.
+	 */
+	enum class Kind : std::uint8_t
+	{
+		None, ///< Not a pointer, or the word can not be read.
+		Data, ///< Pointer into a non-code segment.
+		Code  ///< Pointer into a code segment.
+	};
+
+public:
+	PointerMap(const Image& image);
+
+	bool isCovered(std::uint64_t address) const;
+	bool getKind(std::uint64_t address, Kind& kind) const;
+	bool isPointer(std::uint64_t address, bool& isPtr, std::uint64_t* pointer = nullptr) const;
+	bool getWord(std::uint64_t address, std::uint64_t& word) const;
+
+	Kind classify(std::uint64_t value) const;
+
+private:
+	/**
+	 * Address interval in which all the addresses belong to the same segment.
+	 */
+	struct Interval
+	{
+		std::uint64_t start;
+		std::uint64_t end;
+		std::size_t segment;
+		Kind kind;
+	};
+
+	/**
+	 * Words of a single mapped segment.
+	 */
+	struct Region
+	{
+		std::size_t segment = 0;
+		std::uint64_t start = 0;
+		std::uint64_t size = 0;
+		/// Size of the raw data at the start of the segment.
+		std::uint64_t dataSize = 0;
+		/// Kinds of the words that overlap @c data.
+		std::vector<Kind> kinds;
+		/// Kind of the zero-filled words after @c data.
+		Kind zeroKind = Kind::None;
+	};
+
+private:
+	void buildIntervals(const Image& image);
+	void buildRegion(const Image& image, std::size_t segment);
+	const Interval* findInterval(std::uint64_t address) const;
+	const Region* findRegion(std::uint64_t address, std::uint64_t& index) const;
+	std::uint64_t readWord(const std::uint8_t* data, std::uint64_t dataSize, std::uint64_t offset) const;
+
+private:
+	const Image* _image = nullptr;
+	std::size_t _wordSize = 0;
+	bool _bigEndian = false;
+	/// Disjoint intervals covered by segments, sorted by address.
+	std::vector<Interval> _intervals;
+	/// Lowest and highest address that is a pointer.
+	std::uint64_t _lowest = 0;
+	std::uint64_t _highest = 0;
+	/// Mapped segments' regions, indexed by segment index.
+	std::vector<Region> _regions;
+};
+
+} // namespace loader
+} // namespace retdec
+
+#endif
@@ -7,6 +7,10 @@
 #ifndef RETDEC_MACHO_EXTRACTOR_BREAK_FAT_H
 #define RETDEC_MACHO_EXTRACTOR_BREAK_FAT_H
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <llvm/Object/MachO.h>
 #include <llvm/Object/MachOUniversal.h>
 #include <llvm/Support/ErrorOr.h>
@@ -31,9 +35,17 @@ class BreakMachOUniversal
 		bool getByArchFamily(
 				std::uint32_t cpuType,
 				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getBestArchive(
+				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getArchiveForFamily(
+				const std::string &familyName,
+				llvm::object::MachOUniversalBinary::object_iterator &res);
 		bool extract(
 				llvm::object::MachOUniversalBinary::object_iterator &object,
 				const std::string &outPath);
+		bool extract(
+				llvm::object::MachOUniversalBinary::object_iterator &object,
+				std::vector<std::uint8_t> &result);
 		bool getObjectNamesForArchive(
 				std::uintptr_t archOffset ,
 				std::size_t archSize,
@@ -69,6 +81,11 @@ class BreakMachOUniversal
 		bool extractArchiveForArchitecture(
 				const std::string &machoArchName,
 				const std::string &outPath);
+		bool extractBestArchive(
+				std::vector<std::uint8_t> &result);
+		bool extractArchiveForFamily(
+				const std::string &familyName,
+				std::vector<std::uint8_t> &result);
 		/// @}
 };
 
@@ -7,6 +7,10 @@
 #ifndef RETDEC_PDBPARSER_PDB_FILE_H
 #define RETDEC_PDBPARSER_PDB_FILE_H
 
+#include <memory>
+
+#include <llvm/Support/MemoryBuffer.h>
+
 #include "retdec/pdbparser/pdb_info.h"
 #include "retdec/pdbparser/pdb_symbols.h"
 #include "retdec/pdbparser/pdb_types.h"
@@ -51,6 +55,7 @@ enum PDBFileState
 #define PDB_STREAM_PDB      1 // PDB stream info
 #define PDB_STREAM_TPI      2 // type info
 #define PDB_STREAM_DBI      3 // debug info
+#define PDB_STREAM_IPI      4 // id info
 
 // =================================================================
 // PDB 2.00 STRUCTURES
@@ -133,10 +138,10 @@ class PDBFile
 {
 	public:
 		PDBFile(void) :
-				pdb_loaded(false), pdb_initialized(false), pdb_filename(nullptr), pdb_version(0), page_size(0), pdb_file_size(
+				pdb_loaded(false), pdb_initialized(false), symbols_loaded(false), pdb_filename(nullptr), pdb_version(0), page_size(0), pdb_file_size(
 				        0), pdb_file_data(
 				nullptr), num_streams(0), pdb_fpo_num(0), pdb_newfpo_num(0), pdb_sec_num(0), pdb_header(nullptr), pdb_root_dir(
-				nullptr), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(nullptr)
+				nullptr), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(nullptr), pdb_ipi_records(nullptr)
 		{
 		}
 		;
@@ -152,13 +157,7 @@ class PDBFile
 		{
 			return pdb_version;
 		}
-		PDBStream * get_stream(unsigned int num)
-		{
-			if (num < num_streams)
-				return &streams[num];
-			else
-				return nullptr;
-		}
+		PDBStream * get_stream(unsigned int num);
 		const char * get_module_name(unsigned int num)
 		{
 			if (num < modules.size())
@@ -168,14 +167,26 @@ class PDBFile
 		}
 		PDBTypes * get_types_container(void)
 		{
+			load_types();
 			return pdb_types;
 		}
+		PDBTypeDef * get_type(int index)
+		{
+			create_types();
+			if (pdb_types != nullptr)
+				return pdb_types->get_type_by_index(index);
+			else
+				return nullptr;
+		}
+		PDBTypeRecords * get_ipi_records(void);
 		PDBSymbols * get_symbols_container(void)
 		{
+			load_symbols();
 			return pdb_symbols;
 		}
 		PDBFunctionAddressMap * get_functions(void)
 		{
+			load_symbols();
 			if (pdb_symbols != nullptr)
 				return &pdb_symbols->get_functions();
 			else
@@ -183,11 +194,22 @@ class PDBFile
 		}
 		PDBGlobalVarAddressMap * get_global_variables(void)
 		{
+			load_symbols();
 			if (pdb_symbols != nullptr)
 				return &pdb_symbols->get_global_variables();
 			else
 				return nullptr;
 		}
+		bool find_public_symbol(const std::string &name, PDBPublicSymbol &pub)
+		{
+			create_symbols();
+			return pdb_symbols != nullptr && pdb_symbols->find_public_symbol(name, pub);
+		}
+		bool find_global_variable(const std::string &name, PDBGlobalVariable &var)
+		{
+			create_symbols();
+			return pdb_symbols != nullptr && pdb_symbols->find_global_variable(name, var);
+		}
 
 		// Printing methods
 		void print_pdb_file_info(void);
@@ -203,15 +225,21 @@ class PDBFile
 		PDBFileState load_pdb_v700(void);
 		void parse_modules(void);
 		void parse_sections(uint64_t image_base);
+		void create_types(void);
+		void create_symbols(void);
+		void load_types(void);
+		void load_symbols(void);
 
 		// Variables
 		bool pdb_loaded;
 		bool pdb_initialized;
+		bool symbols_loaded;  // all symbols are parsed
 		const char * pdb_filename;
 		unsigned int pdb_version;
 		unsigned int page_size;
 		unsigned int pdb_file_size;
 		char * pdb_file_data;
+		std::unique_ptr<llvm::WritableMemoryBuffer> pdb_file_buffer;  // memory mapped PDB file
 		unsigned int num_streams;
 		int pdb_fpo_num;
 		int pdb_newfpo_num;
@@ -226,6 +254,7 @@ class PDBFile
 		// Child objects
 		PDBTypes * pdb_types;
 		PDBSymbols * pdb_symbols;
+		PDBTypeRecords * pdb_ipi_records;
 
 		// Data containers
 		PDBStreamsVec streams;
@@ -506,6 +506,14 @@ typedef enum _LEAF_ENUM_e
 	LF_MANAGED = 0x00001514,
 	LF_TYPESERVER2 = 0x00001515,
 
+	LF_FUNC_ID = 0x00001601,  // IPI stream records
+	LF_MFUNC_ID = 0x00001602,
+	LF_BUILDINFO = 0x00001603,
+	LF_SUBSTR_LIST = 0x00001604,
+	LF_STRING_ID = 0x00001605,
+	LF_UDT_SRC_LINE = 0x00001606,
+	LF_UDT_MOD_SRC_LINE = 0x00001607,
+
 	LF_NUMERIC = 0x00008000,
 	LF_CHAR = 0x00008000,
 	LF_SHORT = 0x00008001,
@@ -7,6 +7,9 @@
 #ifndef RETDEC_PDBPARSER_PDB_SYMBOLS_H
 #define RETDEC_PDBPARSER_PDB_SYMBOLS_H
 
+#include <string_view>
+#include <unordered_map>
+
 #include "retdec/pdbparser/pdb_info.h"
 #include "retdec/pdbparser/pdb_types.h"
 #include "retdec/pdbparser/pdb_utils.h"
@@ -114,6 +117,23 @@ typedef struct _PDBGlobalVariable
 // PDB global variable map (key is segment+offset (in int32 : SSOOOOOO))
 typedef std::map<uint64_t, PDBGlobalVariable> PDBGlobalVarAddressMap;
 
+// =================================================================
+// PUBLIC SYMBOL STRUCTURES
+// =================================================================
+
+// PDB public symbol
+typedef struct _PDBPublicSymbol
+{
+		char * name;  // Name (decorated)
+		uint64_t address;  // Virtual address (image base + section address + offset)
+		int offset;  // Offset
+		int section;  // Segment
+		bool is_function;  // Symbol is function
+} PDBPublicSymbol;
+
+// PDB symbol index (key is symbol name, value is offset of symbol in SYM stream)
+typedef std::unordered_map<std::string_view, unsigned int> PDBSymbolNameIndex;
+
 // =================================================================
 // MAIN CLASS PDBSymbols
 // =================================================================
@@ -128,7 +148,7 @@ class PDBSymbols
 //		pdb_gsi_data(gsi->data),
 //		pdb_psi_size(psi->size),
 //		pdb_psi_data(psi->data),
-				pdb_sym_size(sym->size), pdb_sym_data(sym->data), modules(m), sections(s), types(tps), parsed(false)
+				pdb_sym_size(sym->size), pdb_sym_data(sym->data), modules(m), sections(s), types(tps), parsed(false), indexed(false)
 		{
 		}
 		;
@@ -149,6 +169,10 @@ class PDBSymbols
 		}
 		;
 
+		// Lookup methods - they do not need parse_symbols()
+		bool find_public_symbol(const std::string &name, PDBPublicSymbol &pub);
+		bool find_global_variable(const std::string &name, PDBGlobalVariable &var);
+
 		/**
 		 * Get virtual address from section index and offset of symbol
 		 */
@@ -183,6 +207,7 @@ class PDBSymbols
 	private:
 		// Internal functions
 		static void dump_symbol(PSYM Sym);
+		void index_symbols(void);
 
 		// Variables
 //	unsigned int		pdb_gsi_size;	// size of GSI stream
@@ -195,10 +220,13 @@ class PDBSymbols
 		PDBSectionsVec & sections;  // sections
 		PDBTypes * types;  // types
 		bool parsed;  // modules are parsed
+		bool indexed;  // public and global symbols are indexed
 
 		// Data containers
 		PDBFunctionAddressMap functions;  // Map of functions (key is address)
 		PDBGlobalVarAddressMap global_variables;  // Map of global variables (key is address)
+		PDBSymbolNameIndex public_symbols;  // Index of public symbols (key is name)
+		PDBSymbolNameIndex global_symbols;  // Index of global variables (key is name)
 };
 
 }  // namespace pdbparser
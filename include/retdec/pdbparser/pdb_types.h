@@ -576,6 +576,48 @@ class PDBTypeClass : public PDBTypeDef
 		//TODO methods, attributes, etc...
 };
 
+// =================================================================
+// CLASS PDBTypeRecords
+// =================================================================
+
+// Records of a stream with TPI layout (TPI or IPI stream)
+// Offsets of records are found by the first request for a record,
+// records themselves are not parsed.
+class PDBTypeRecords
+{
+	public:
+		// Constructor
+		PDBTypeRecords(PDBStream *s);
+
+		// Getting methods
+		unsigned int get_min_index(void)
+		{
+			return min_index;
+		}
+		;
+		unsigned int get_max_index(void)
+		{
+			return max_index;
+		}
+		;
+		unsigned int get_records_count(void);
+		lfRecord * get_record(unsigned int index, unsigned int *size = nullptr);
+
+	private:
+		// Internal functions
+		void index_records(void);
+
+		// Variables
+		unsigned int stream_size;  // size of stream
+		char * stream_data;  // data from stream
+		unsigned int min_index;  // index of the first record
+		unsigned int max_index;  // index behind the last record
+		bool indexed;  // offsets of records are found
+
+		// Data containers
+		std::vector<unsigned int> offsets;  // Offsets of records (key is index - min_index)
+};
+
 // =================================================================
 // MAIN CLASS PDBTypes
 // =================================================================
@@ -586,7 +628,7 @@ class PDBTypes
 		// Constructor and destructor
 		PDBTypes(PDBStream *s) :
 				pdb_tpi_size(s->size), pdb_tpi_data(s->data), parsed(false), tpi_header(
-				        reinterpret_cast<HDR *>(s->data))
+				        reinterpret_cast<HDR *>(s->data)), records(s)
 		{
 		}
 		;
@@ -599,7 +641,7 @@ class PDBTypes
 		PDBTypeDef * get_type_by_index(int index)
 		{
 			if (!parsed)
-				return nullptr;
+				return load_type(index);
 			else
 				return types[index];
 		}
@@ -620,6 +662,10 @@ class PDBTypes
 	public:
 		// Internal functions
 		PHDR TPILoadTypeInfo(void);
+		void init_base_types(void);
+		PDBTypeDef * load_type(int index);
+		void parse_type(int index, lfRecord *record, int size);
+		void get_referenced_types(int index, lfRecord *record, int size, std::vector<int> &refs);
 
 		// Variables
 		unsigned int pdb_tpi_size;  // size of TPI stream
@@ -629,6 +675,9 @@ class PDBTypes
 		// Data structure pointers
 		HDR * tpi_header;
 
+		// Offsets of type records
+		PDBTypeRecords records;
+
 		// Data containers
 		PDBTypeDefIndexMap types;  // Map of type definitions (key is type index)
 		PDBTypeDefIndexMap types_fully_defined;  // Map of fully defined types (key is type index)
@@ -7,6 +7,10 @@
 #ifndef RETDEC_RETDEC_RETDEC_H
 #define RETDEC_RETDEC_RETDEC_H
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <capstone/capstone.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
@@ -51,6 +55,18 @@ bool decompile(
 		std::string* outString = nullptr
 );
 
+/**
+ * Run a decompilation of \p inputData according to a \p config configuration.
+ * \p inputData is used instead of reading the input file set in \p config,
+ * so the input does not have to exist on the disk.
+ * See the other overload for \p outString.
+ */
+bool decompile(
+		retdec::config::Config& config,
+		const std::vector<std::uint8_t>& inputData,
+		std::string* outString = nullptr
+);
+
 } // namespace retdec
 
 #endif
@@ -45,7 +45,7 @@ private:
 	BitParserN& operator =(const BitParserN&);
 };
 
-class BitParser8 : public BitParserN<uint32_t>
+class BitParser8 final : public BitParserN<uint32_t>
 {
 public:
 	BitParser8() = default;
@@ -71,7 +71,7 @@ public:
 	}
 };
 
-class BitParserLe32 : public BitParserN<uint32_t>
+class BitParserLe32 final : public BitParserN<uint32_t>
 {
 public:
 	BitParserLe32() = default;
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "retdec/unpacker/decompression/output_buffer.h"
 #include "retdec/unpacker/decompression/nrv/bit_parsers.h"
 #include "retdec/unpacker/decompression/nrv/nrv_data.h"
 
@@ -27,6 +28,8 @@ public:
 
 private:
 	Nrv2bData& operator =(const Nrv2bData&);
+
+	template <typename T> bool decompress(T& bitParser, OutputBuffer& output);
 };
 
 } // namespace unpacker
@@ -27,6 +27,24 @@ public:
 	}
 
 protected:
+	/**
+	 * Calls @a func with the bit parser of its final type, so the decompression
+	 * loop instantiated for it gets the bits without virtual calls.
+	 *
+	 * @param func Function to call with the bit parser.
+	 *
+	 * @return The result of @a func.
+	 */
+	template <typename Func> bool withBitParser(Func func)
+	{
+		if (auto bitParser = dynamic_cast<BitParser8*>(_bitParser))
+			return func(*bitParser);
+		else if (auto bitParser = dynamic_cast<BitParserLe32*>(_bitParser))
+			return func(*bitParser);
+		else
+			return func(*_bitParser);
+	}
+
 	uint32_t _readPos, _writePos;
 	BitParser* _bitParser;
 
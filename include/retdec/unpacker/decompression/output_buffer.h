@@ -0,0 +1,119 @@
+/**
+ * @file include/retdec/unpacker/decompression/output_buffer.h
+ * @brief Declaration of class for decompressed output data.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UNPACKER_DECOMPRESSION_OUTPUT_BUFFER_H
+#define RETDEC_UNPACKER_DECOMPRESSION_OUTPUT_BUFFER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "retdec/utils/dynamic_buffer.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+
+/**
+ * @brief Output of the decompression.
+ *
+ * Decompressors write into a plain vector preallocated to the capacity of
+ * the destination buffer instead of checking every byte in the @c DynamicBuffer.
+ * The data are stored into the destination buffer when the object is destroyed,
+ * so every return path of a decompressor leaves the same data in it as if they
+ * were written there directly. Reading and writing of single bytes behaves
+ * the same as @c DynamicBuffer::read() and @c DynamicBuffer::write().
+ */
+class OutputBuffer
+{
+public:
+	OutputBuffer() = delete;
+	OutputBuffer(DynamicBuffer& buffer) : _buffer(buffer), _data(buffer.getBuffer()), _capacity(buffer.getCapacity())
+	{
+		_data.reserve(_capacity);
+	}
+	OutputBuffer(const OutputBuffer&) = delete;
+
+	~OutputBuffer()
+	{
+		auto endianness = _buffer.getEndianness();
+		_buffer = DynamicBuffer(std::move(_data), endianness);
+		_buffer.setCapacity(_capacity);
+	}
+
+	uint32_t getCapacity() const { return _capacity; }
+
+	uint8_t read(uint32_t pos) const
+	{
+		return pos < _data.size() && pos < _capacity ? _data[pos] : 0;
+	}
+
+	void write(uint8_t byte, uint32_t pos)
+	{
+		if (pos >= _capacity)
+			return;
+
+		if (pos >= _data.size())
+			_data.resize(pos + 1);
+
+		_data[pos] = byte;
+	}
+
+	/**
+	 * Copies bytes from the already written data to the given position, byte
+	 * after byte, so the source and the destination may overlap. Copying stops
+	 * at the capacity.
+	 *
+	 * @param srcPos Position of the first byte to copy.
+	 * @param pos Position where to write the first byte.
+	 * @param count Number of bytes to copy.
+	 *
+	 * @return Number of copied bytes.
+	 */
+	uint32_t copy(uint32_t srcPos, uint32_t pos, uint32_t count)
+	{
+		if (pos >= _capacity)
+			return 0;
+
+		count = std::min(count, _capacity - pos);
+
+		// Match appended to the end of the written data
+		if (srcPos < pos && pos == _data.size())
+		{
+			_data.resize(pos + count);
+			uint8_t* data = _data.data();
+			if (pos - srcPos >= count)
+				std::memcpy(data + pos, data + srcPos, count);
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+					data[pos + i] = data[srcPos + i];
+			}
+		}
+		else
+		{
+			for (uint32_t i = 0; i < count; ++i)
+				write(read(srcPos + i), pos + i);
+		}
+
+		return count;
+	}
+
+private:
+	OutputBuffer& operator =(const OutputBuffer&);
+
+	DynamicBuffer& _buffer; ///< Destination buffer.
+	std::vector<uint8_t> _data; ///< Decompressed data.
+	uint32_t _capacity; ///< Capacity of the destination buffer.
+};
+
+} // namespace unpacker
+} // namespace retdec
+
+#endif
@@ -7,11 +7,16 @@
 #ifndef RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 #define RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 
+#include <cstddef>
+#include <cstdint>
+
 namespace retdec {
 namespace unpackertool {
 
 int _main(int argc, char** argv);
 
+bool isUnpackable(const std::uint8_t* data, std::size_t size);
+
 } // namespace unpackertool
 } // namespace retdec
 
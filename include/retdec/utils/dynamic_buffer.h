@@ -49,6 +49,11 @@ public:
 			retdec::utils::Endianness endianness
 					= retdec::utils::Endianness::LITTLE
 	);
+	DynamicBuffer(
+			std::vector<uint8_t>&& data,
+			retdec::utils::Endianness endianness
+					= retdec::utils::Endianness::LITTLE
+	);
 	DynamicBuffer(const DynamicBuffer& dynamicBuffer);
 	DynamicBuffer(
 			const DynamicBuffer& dynamicBuffer,
@@ -0,0 +1,106 @@
+/**
+* @file include/retdec/utils/parallel.h
+* @brief Simple helpers for running independent work items in parallel.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_PARALLEL_H
+#define RETDEC_UTILS_PARALLEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace retdec {
+namespace utils {
+
+std::size_t getThreadCount(std::size_t requested);
+
+/**
+* @brief Calls @p f(i) for every @c i in <tt>[0, n)</tt> using at most
+*        @p threads threads.
+*
+* Work items are handed to the threads dynamically, so items of very different
+* costs are balanced automatically. The calling thread participates in the
+* work. If @p threads is @c 0, the number of hardware threads is used. If only
+* one thread is to be used (or there is at most one item), all items are
+* processed serially in the calling thread, in order.
+*
+* If @p f throws, the remaining items are not started and the first caught
+* exception is rethrown in the calling thread after all threads finished.
+*
+* @p f must be safe to call concurrently for different items.
+*/
+template <typename Function>
+void parallelFor(std::size_t n, std::size_t threads, Function&& f)
+{
+	threads = getThreadCount(threads);
+	if (threads > n)
+	{
+		threads = n;
+	}
+
+	if (threads <= 1)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			f(i);
+		}
+		return;
+	}
+
+	std::atomic<std::size_t> next(0);
+	std::atomic<bool> failed(false);
+	std::exception_ptr error;
+	std::mutex errorMutex;
+
+	auto worker = [&]() {
+		while (!failed)
+		{
+			std::size_t i = next++;
+			if (i >= n)
+			{
+				break;
+			}
+
+			try
+			{
+				f(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+				failed = true;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for (std::size_t t = 1; t < threads; ++t)
+	{
+		workers.emplace_back(worker);
+	}
+	worker();
+	for (auto& w : workers)
+	{
+		w.join();
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+} // namespace utils
+} // namespace retdec
+
+#endif
@@ -95,6 +95,9 @@ std::string addSlashes(const std::string &str,
 std::string replaceCharsWithStrings(const std::string &str, char what,
 	const std::string &withWhat);
 
+std::string quotePosixShellArgument(const std::string &arg);
+std::string quoteWindowsShellArgument(const std::string &arg);
+
 /**
 * @brief Returns @c true if @a str starts with the prefix @a withWhat, @c false
 *        otherwise.
@@ -126,7 +126,7 @@ class YaraDetector
 				bool storeAllRules = false
 		);
 		bool analyze(
-				std::vector<std::uint8_t> &bytes,
+				const std::vector<std::uint8_t> &bytes,
 				bool storeAllRules = false
 		);
 		const std::vector<YaraRule>& getDetectedRules() const;
@@ -109,6 +109,39 @@ ArchiveWrapper::ArchiveWrapper(
 	bool &succes,
 	std::string &errorMessage)
 	: buffer(MemoryBuffer::getFile(llvm::Twine(archivePath)))
+{
+	init(succes, errorMessage);
+}
+
+/**
+ * Constructor.
+ *
+ * Archive is read directly from @p data which must outlive the wrapper.
+ *
+ * @param data content of input archive
+ * @param succes result of object construction
+ * @param errorMessage possible error message if @p success is set to false
+ */
+ArchiveWrapper::ArchiveWrapper(
+	const std::vector<std::uint8_t> &data,
+	bool &succes,
+	std::string &errorMessage)
+	: buffer(MemoryBuffer::getMemBuffer(
+		llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size()),
+		"", false))
+{
+	init(succes, errorMessage);
+}
+
+/**
+ * Parse archive in buffer.
+ *
+ * @param succes result of parsing
+ * @param errorMessage possible error message if @p success is set to false
+ */
+void ArchiveWrapper::init(
+	bool &succes,
+	std::string &errorMessage)
 {
 	succes = false;
 	if (!buffer) {
@@ -312,6 +345,111 @@ bool ArchiveWrapper::extractByName(
 	const std::string &name,
 	std::string &errorMessage,
 	const std::string &outputPath) const
+{
+	llvm::StringRef data;
+	std::string childName;
+	if (!findByName(name, data, childName, errorMessage)) {
+		return false;
+	}
+
+	auto path = outputPath.empty() ? childName : outputPath;
+	return writeFile(path, data, errorMessage);
+}
+
+/**
+ * Extract object file by its name into memory.
+ *
+ * If multiple files with the same name are present, only first one is
+ * extracted.
+ *
+ * @param name target name
+ * @param errorMessage possible error message if @c false is returned
+ * @param result content of the object file
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByName(
+	const std::string &name,
+	std::string &errorMessage,
+	std::vector<std::uint8_t> &result) const
+{
+	llvm::StringRef data;
+	std::string childName;
+	if (!findByName(name, data, childName, errorMessage)) {
+		return false;
+	}
+
+	result.assign(data.bytes_begin(), data.bytes_end());
+	return true;
+}
+
+/**
+ * Extract object file by its index.
+ *
+ * If output path is not given, object name and current directory is used. If
+ * name cannot be retrieved, name 'invalid_name' is used.
+ *
+ * @param index target index
+ * @param errorMessage possible error message if @c false is returned
+ * @param outputPath optional output path
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByIndex(
+	const std::size_t index,
+	std::string &errorMessage,
+	const std::string &outputPath) const
+{
+	llvm::StringRef data;
+	std::string childName;
+	if (!findByIndex(index, data, childName, errorMessage)) {
+		return false;
+	}
+
+	// No path given - use object name.
+	auto path = outputPath.empty() ? childName : outputPath;
+	return writeFile(path, data, errorMessage);
+}
+
+/**
+ * Extract object file by its index into memory.
+ *
+ * @param index target index
+ * @param errorMessage possible error message if @c false is returned
+ * @param result content of the object file
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByIndex(
+	const std::size_t index,
+	std::string &errorMessage,
+	std::vector<std::uint8_t> &result) const
+{
+	llvm::StringRef data;
+	std::string childName;
+	if (!findByIndex(index, data, childName, errorMessage)) {
+		return false;
+	}
+
+	result.assign(data.bytes_begin(), data.bytes_end());
+	return true;
+}
+
+/**
+ * Find object file by its name.
+ *
+ * @param name target name
+ * @param data content of the object file, it points into the archive buffer
+ * @param childName fixed name of the object file
+ * @param errorMessage possible error message if @c false is returned
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::findByName(
+	const std::string &name,
+	llvm::StringRef &data,
+	std::string &childName,
+	std::string &errorMessage) const
 {
 	Error error = Error::success();
 	for (const auto &child : archive->children(error)) {
@@ -330,16 +468,15 @@ bool ArchiveWrapper::extractByName(
 			continue;
 		}
 
-		// Get buffer and try to write to a file.
 		auto bufferOrErr = child.getBuffer();
 		if (!bufferOrErr) {
 			errorMessage = "Could not get file buffer";
 			return false;
 		}
-		else {
-			auto path = outputPath.empty() ? name : outputPath;
-			return writeFile(path, *bufferOrErr, errorMessage);
-		}
+
+		data = *bufferOrErr;
+		childName = name;
+		return true;
 	}
 
 	if (checkError(error, errorMessage)) {
@@ -351,21 +488,22 @@ bool ArchiveWrapper::extractByName(
 }
 
 /**
- * Extract object file by its index.
+ * Find object file by its index.
  *
- * If output path is not given, object name and current directory is used. If
- * name cannot be retrieved, name 'invalid_name' is used.
+ * If name cannot be retrieved, name 'invalid_name' is used.
  *
  * @param index target index
+ * @param data content of the object file, it points into the archive buffer
+ * @param childName fixed name of the object file
  * @param errorMessage possible error message if @c false is returned
- * @param outputPath optional output path
  *
  * @return @c true if no errors occurred, @c false otherwise
  */
-bool ArchiveWrapper::extractByIndex(
+bool ArchiveWrapper::findByIndex(
 	const std::size_t index,
-	std::string &errorMessage,
-	const std::string &outputPath) const
+	llvm::StringRef &data,
+	std::string &childName,
+	std::string &errorMessage) const
 {
 	Error error = Error::success();
 	std::size_t counter = 0;
@@ -379,24 +517,16 @@ bool ArchiveWrapper::extractByIndex(
 			continue;
 		}
 
-		// Get buffer and try to write to a file.
 		auto bufferOrErr = child.getBuffer();
 		if (!bufferOrErr) {
 			errorMessage = "Could not get file buffer";
 			return false;
 		}
-		else {
-			std::string path;
-			if (outputPath.empty()) {
-				// No path given - use object name.
-				auto nameOrErr = child.getName();
-				path = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
-			}
-			else {
-				path = outputPath;
-			}
-			return writeFile(path, *bufferOrErr, errorMessage);
-		}
+
+		auto nameOrErr = child.getName();
+		data = *bufferOrErr;
+		childName = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
+		return true;
 	}
 
 	if (checkError(error, errorMessage)) {
@@ -111,6 +111,24 @@ bool isArchive(
 	return false;
 }
 
+/**
+ * Check if data are an archive (normal or thin).
+ *
+ * @param data input data
+ *
+ * @return @c true if data are an archive, @c false otherwise
+ */
+bool isArchive(
+	const std::vector<std::uint8_t> &data)
+{
+	if (data.size() < arMagicSize) {
+		return false;
+	}
+
+	std::string start(data.begin(), data.begin() + arMagicSize);
+	return start == archMagic || start == thinMagic;
+}
+
 /**
  * Check if file is a thin archive.
  *
@@ -19,7 +19,9 @@
 #include "retdec/utils/time.h"
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -35,18 +37,44 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
+/**
+ * Compute RDA for all the functions in @a M.
+ * If @a stats is given, the function-parallel work is recorded in it.
+ */
 bool ReachingDefinitionsAnalysis::runOnModule(
 		Module& M,
 		Abi* abi,
-		bool trackFlagRegs)
+		bool trackFlagRegs,
+		ParallelStatistics* stats)
 {
 	_trackFlagRegs = trackFlagRegs;
 	_abi = abi;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
 
 	clear();
-	initializeBasicBlocks(M);
-	run();
+
+	// Functions are independent -> their entries are created up front and then
+	// each function is analysed on its own, possibly in parallel.
+	//
+	auto fncs = getFunctionDefinitions(M);
+	for (Function* F : fncs)
+	{
+		bbMap.emplace(F, BasicBlockEntryMap());
+	}
+
+	std::size_t threads = 1;
+	Config* c = nullptr;
+	if (ConfigProvider::getConfig(&M, c))
+	{
+		threads = c->getConfig().parameters.getThreads();
+	}
+
+	runOnFunctions(fncs, threads, [this](Function& F)
+	{
+		run(F, bbMap.find(&F)->second);
+	}, stats);
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
@@ -62,38 +90,38 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(F.getParent());
 
 	clear();
-	initializeBasicBlocks(F);
-	run();
-
-	_run = true;
-	return false;
-}
-
-void ReachingDefinitionsAnalysis::run()
-{
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	run(F, bbMap[&F]);
 
 	LOG << *this << "\n";
 
-	clearInternal();
+	_run = true;
+	return false;
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
+/**
+ * Compute RDA for the given function.
+ * It only reads the IR and modifies only the function's entries in @a bbs.
+ * Therefore, it can be run for several functions at the same time.
+ */
+void ReachingDefinitionsAnalysis::run(
+		llvm::Function& F,
+		BasicBlockEntryMap& bbs) const
 {
-	for (Function& F : M)
-	{
-		initializeBasicBlocks(F);
-	}
+	initializeBasicBlocks(F, bbs);
+	initializeBasicBlocksPrev(bbs);
+	initializeKillGenSets(bbs);
+	propagate(F, bbs);
+	initializeDefsAndUses(bbs);
+	clearInternal(bbs);
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
+void ReachingDefinitionsAnalysis::initializeBasicBlocks(
+		llvm::Function& F,
+		BasicBlockEntryMap& bbs) const
 {
 	for (BasicBlock& B : F)
 	{
-		BasicBlockEntry bbe(&B, bbMap.size());
+		BasicBlockEntry bbe(&B, bbs.size());
 
 		int insnPos = -1;
 		for (Instruction& I : B)
@@ -200,7 +228,7 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 			}
 		}
 
-		bbMap[&F][&B] = bbe;
+		bbs[&B] = bbe;
 	}
 }
 
@@ -219,10 +247,10 @@ bool ReachingDefinitionsAnalysis::wasRun() const
  * Clear internal structures used to compute RDA, but not needed to use it once
  * it is computed.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::clearInternal(
+		BasicBlockEntryMap& bbs) const
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry& bb = pair.second;
 		bb.defsOut.clear();
@@ -231,10 +259,10 @@ void ReachingDefinitionsAnalysis::clearInternal()
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
+void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev(
+		BasicBlockEntryMap& bbs) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		auto B = pair.first;
 		auto &entry = pair.second;
@@ -242,60 +270,57 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
 		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
 		{
 			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
+			auto p = bbs.find(pred);
 
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+			assert(p != bbs.end() && "we should have all BBs stored in bbMap");
 
 			entry.prevBBs.insert( &p->second );
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
+void ReachingDefinitionsAnalysis::initializeKillGenSets(
+		BasicBlockEntryMap& bbs) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		pair.second.initializeKillDefSets();
 	}
 }
 
-void ReachingDefinitionsAnalysis::propagate()
+void ReachingDefinitionsAnalysis::propagate(
+		const llvm::Function& F,
+		BasicBlockEntryMap& bbs) const
 {
-	for (auto &pair1 : bbMap)
+	std::vector<BasicBlockEntry*> workList;
+	workList.reserve(bbs.size());
+	ReversePostOrderTraversal<const Function*> RPOT(&F); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
 	{
-		const Function* fnc = pair1.first;
+		const BasicBlock* bb = *I;
+		auto fIt = bbs.find(bb);
+		assert(fIt != bbs.end());
+		workList.push_back(&(fIt->second));
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
+		fIt->second.changed = true;
+	}
 
-			fIt->second.changed = true;
-		}
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
 
-		bool changed = true;
-		while (changed)
+		for (auto* bbe : workList)
 		{
-			changed = false;
-
-			for (auto* bbe : workList)
-			{
-				changed |= bbe->initDefsOut();
-			}
+			changed |= bbe->initDefsOut();
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
+void ReachingDefinitionsAnalysis::initializeDefsAndUses(
+		BasicBlockEntryMap& bbs) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry &bb = pair.second;
 
@@ -64,7 +64,8 @@ bool CondBranchOpt::run()
 	bool changed = false;
 
 	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi, true);
+	RDA.runOnModule(*_module, _abi, true, &_parallelStats);
+	_parallelStats.log(getPassName().str());
 
 	SymbolicTree::setTrackThroughAllocaLoads(false);
 	SymbolicTree::setTrackOnlyFlagRegisters(true);
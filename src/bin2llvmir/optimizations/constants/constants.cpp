@@ -75,7 +75,8 @@ bool ConstantsAnalysis::runOnModuleCustom(
 bool ConstantsAnalysis::run()
 {
 	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	RDA.runOnModule(*_module, _abi, false, &_parallelStats);
+	_parallelStats.log(getPassName().str());
 
 	for (Function& f : *_module)
 	for (inst_iterator I = inst_begin(&f), E = inst_end(&f); I != E;)
@@ -38,10 +38,10 @@ bool insnWrittesPcArm64(csh& ce, cs_insn* insn)
 	return (branch_instructions.count(insn->id) != 0);
 }
 
-bool looksLikeArm64FunctionStart(cs_insn* insn)
+bool looksLikeArm64FunctionStart(unsigned int id)
 {
 	// Create stack frame 'stp x29, x30, [sp, -48]!'
-	return insn->id == ARM64_INS_STP;
+	return id == ARM64_INS_STP;
 }
 
 std::size_t Decoder::decodeJumpTargetDryRun_arm64(
@@ -55,27 +55,26 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm64(
 		return true;
 	}
 
-	csh ce = _c2l->getCapstoneEngine();
-
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
+	CachedInstruction insn;
 	// bytes.first  -> Code
 	// bytes.second -> Code size
 	// addr         -> Address of first instruction
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	while (disasmDryRun(bytes, addr, insn))
 	{
 
-		if (strict && first && !looksLikeArm64FunctionStart(_dryCsInsn))
+		if (strict && first && !looksLikeArm64FunctionStart(insn.id))
 		{
 			return true;
 		}
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& insn.is(CachedInstruction::NOP))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn.size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -83,8 +82,8 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm64(
 			return nops;
 		}
 
-		if (_c2l->isControlFlowInstruction(*_dryCsInsn)
-				|| insnWrittesPcArm64(ce, _dryCsInsn))
+		if (insn.is(CachedInstruction::CONTROL_FLOW)
+				|| insn.is(CachedInstruction::WRITES_PC))
 		{
 			return false;
 		}
@@ -107,5 +106,22 @@ std::size_t Decoder::decodeJumpTargetDryRun_arm64(
 	return true;
 }
 
+void Decoder::classifyInstruction_arm64(cs_insn* insn, CachedInstruction& ci)
+{
+	csh ce = _c2l->getCapstoneEngine();
+	if (insnWrittesPcArm64(ce, insn))
+	{
+		ci.flags |= CachedInstruction::WRITES_PC;
+	}
+
+	auto& detail = insn->detail->arm64;
+	if (ci.is(CachedInstruction::CONTROL_FLOW)
+			&& detail.op_count > 0
+			&& detail.operands[detail.op_count - 1].type == ARM64_OP_IMM)
+	{
+		ci.target = detail.operands[detail.op_count - 1].imm;
+	}
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
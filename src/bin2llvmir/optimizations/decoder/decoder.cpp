@@ -108,6 +108,7 @@ bool Decoder::run()
 	initEnvironment();
 	initRanges();
 	initJumpTargets();
+	initDisassemblyCache();
 
 	LOG << _ranges << std::endl;
 	LOG << _jumpTargets << std::endl;
@@ -402,6 +403,74 @@ std::size_t Decoder::decodeJumpTargetDryRun(
 	return false;
 }
 
+/**
+ * Disassemble the next instruction in a dry run.
+ * Instruction from the pre-disassembly cache is used if there is one,
+ * Capstone is used otherwise.
+ * @return @c True if instruction was disassembled, @c false otherwise.
+ *         On success, @p bytes and @p addr are moved after the instruction.
+ */
+bool Decoder::disasmDryRun(
+		ByteData& bytes,
+		uint64_t& addr,
+		CachedInstruction& insn)
+{
+	auto* ci = _disasmCache.get(addr);
+	if (ci && ci->size <= bytes.second)
+	{
+		insn = *ci;
+		bytes.first += ci->size;
+		bytes.second -= ci->size;
+		addr += ci->size;
+		return true;
+	}
+
+	csh ce = _c2l->getCapstoneEngine();
+	if (!cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	{
+		return false;
+	}
+
+	insn = CachedInstruction();
+	insn.address = _dryCsInsn->address;
+	insn.id = _dryCsInsn->id;
+	insn.size = _dryCsInsn->size;
+	classifyInstruction(_dryCsInsn, insn);
+	return true;
+}
+
+/**
+ * Fill in properties of the given disassembled instruction.
+ * This is called concurrently from pre-disassembly threads -> it must not
+ * modify decoder's state.
+ */
+void Decoder::classifyInstruction(cs_insn* insn, CachedInstruction& ci)
+{
+	auto set = [&ci](bool b, CachedInstruction::eFlag f)
+	{
+		if (b)
+		{
+			ci.flags |= f;
+		}
+	};
+
+	set(_c2l->isControlFlowInstruction(*insn), CachedInstruction::CONTROL_FLOW);
+	set(_c2l->isCallInstruction(*insn), CachedInstruction::CALL);
+	set(_c2l->isReturnInstruction(*insn), CachedInstruction::RETURN);
+	set(_c2l->isBranchInstruction(*insn), CachedInstruction::BRANCH);
+	set(_c2l->isCondBranchInstruction(*insn), CachedInstruction::COND_BRANCH);
+	set(_abi->isNopInstruction(insn), CachedInstruction::NOP);
+
+	if (_config->getConfig().architecture.isX86())
+	{
+		classifyInstruction_x86(insn, ci);
+	}
+	else if (_config->getConfig().architecture.isArm64())
+	{
+		classifyInstruction_arm64(insn, ci);
+	}
+}
+
 cs_mode Decoder::determineMode(cs_insn* insn, common::Address& target)
 {
 	if (_config->getConfig().architecture.isArm32OrThumb())
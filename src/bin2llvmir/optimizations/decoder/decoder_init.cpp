@@ -346,7 +346,7 @@ void Decoder::initAllowedRangesWithConfig()
 		_ranges.addPrimary(p);
 		LOG << "\t" << "[+] selected range @ " << p << std::endl;
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				p.getStart(),
 				JumpTarget::eType::SELECTED_RANGE_START,
 				_c2l->getBasicMode(),
@@ -393,7 +393,7 @@ void Decoder::initAllowedRangesWithConfig()
 				sz = tmpSz.getValue();
 			}
 
-			if (auto* jt = _jumpTargets.push(
+			if (auto jt = _jumpTargets.push(
 					start,
 					JumpTarget::eType::SELECTED_RANGE_START,
 					df.isThumb() ? CS_MODE_THUMB : _c2l->getBasicMode(),
@@ -502,7 +502,7 @@ void Decoder::initAllowedRangesWithConfig()
 				LOG << "\t" << "[+] selected range from symbol: "
 						<< start << std::endl;
 
-				if (auto* jt = _jumpTargets.push(
+				if (auto jt = _jumpTargets.push(
 						start,
 						JumpTarget::eType::SELECTED_RANGE_START,
 						s->isThumbSymbol() ? CS_MODE_THUMB :_c2l->getBasicMode(),
@@ -573,7 +573,7 @@ void Decoder::initJumpTargetsConfig()
 				? std::optional<std::size_t>(tmpSz)
 				: std::nullopt;
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				f.getStart(),
 				JumpTarget::eType::CONFIG,
 				f.isThumb() ? CS_MODE_THUMB : _c2l->getBasicMode(),
@@ -598,7 +598,7 @@ void Decoder::initJumpTargetsEntryPoint()
 	LOG << "\n" << "initJumpTargetsEntryPoint():" << std::endl;
 
 	auto ep = _config->getConfig().parameters.getEntryPoint();
-	if (auto* jt = _jumpTargets.push(
+	if (auto jt = _jumpTargets.push(
 			ep,
 			JumpTarget::eType::ENTRY_POINT,
 			_c2l->getBasicMode(),
@@ -639,7 +639,7 @@ void Decoder::initJumpTargetsExterns()
 				continue;
 			}
 
-			if (auto* jt = _jumpTargets.push(
+			if (auto jt = _jumpTargets.push(
 					a,
 					JumpTarget::eType::IMPORT,
 					_c2l->getBasicMode(),
@@ -725,7 +725,7 @@ void Decoder::initJumpTargetsImports()
 			continue;
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				a,
 				JumpTarget::eType::IMPORT,
 				_c2l->getBasicMode(),
@@ -760,7 +760,7 @@ void Decoder::initJumpTargetsImports()
 			continue;
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				a,
 				JumpTarget::eType::IMPORT,
 				_c2l->getBasicMode(),
@@ -819,7 +819,7 @@ void Decoder::initJumpTargetsExports()
 			continue;
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				addr,
 				JumpTarget::eType::EXPORT,
 				_c2l->getBasicMode(),
@@ -863,7 +863,7 @@ void Decoder::initJumpTargetsSymbols()
 			sz = tmpSz;
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				addr,
 				JumpTarget::eType::SYMBOL,
 				s->isThumbSymbol() ? CS_MODE_THUMB :_c2l->getBasicMode(),
@@ -910,7 +910,7 @@ void Decoder::initJumpTargetsDebug()
 			sz = tmpSz.getValue();
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				addr,
 				JumpTarget::eType::DEBUG,
 				f.isThumb() ? CS_MODE_THUMB : _c2l->getBasicMode(),
@@ -958,7 +958,7 @@ void Decoder::initStaticCode()
 			}
 		}
 
-		if (auto* jt = _jumpTargets.push(
+		if (auto jt = _jumpTargets.push(
 				sf->getAddress(),
 				JumpTarget::eType::STATIC_CODE,
 				sf->isThumb() ? CS_MODE_THUMB : _c2l->getBasicMode(),
@@ -1008,7 +1008,7 @@ void Decoder::initVtables()
 		auto& vt = *p;
 		for (auto& item : vt.items)
 		{
-			if (auto* jt = _jumpTargets.push(
+			if (auto jt = _jumpTargets.push(
 					item.getTargetFunctionAddress(),
 					JumpTarget::eType::VTABLE,
 					item.isThumb() ? CS_MODE_THUMB : _c2l->getBasicMode(),
@@ -1029,6 +1029,64 @@ void Decoder::initVtables()
 	}
 }
 
+/**
+ * Disassemble all the ranges to decode up front, in parallel, and cache the
+ * instructions. Dry runs then use the cached instructions instead of
+ * disassembling the same bytes again and again.
+ *
+ * Only architectures with a single decoding mode whose dry runs are linear
+ * (x86, ARM64, PowerPC) use the cache. ARM (mode switching) and MIPS (delay
+ * slots) disassemble everything as before.
+ */
+void Decoder::initDisassemblyCache()
+{
+	auto& params = _config->getConfig().parameters;
+	auto& arch = _config->getConfig().architecture;
+	if (!params.isPreDisassemble()
+			|| !(arch.isX86() || arch.isArm64() || arch.isPpc()))
+	{
+		return;
+	}
+
+	LOG << "\n" << "initDisassemblyCache():" << std::endl;
+
+	AddressRangeContainer ranges = _ranges.getPrimaryRanges();
+	for (auto& r : _ranges.getAlternativeRanges())
+	{
+		ranges.insert(r.getStart(), r.getEnd());
+	}
+
+	std::vector<DisassemblyCache::Region> regions;
+	for (auto& r : ranges)
+	{
+		ByteData bytes = _image->getImage()->getRawSegmentData(r.getStart());
+		if (bytes.first == nullptr)
+		{
+			continue;
+		}
+
+		DisassemblyCache::Region reg;
+		reg.start = r.getStart();
+		reg.bytes = bytes.first;
+		reg.size = std::min(bytes.second, std::size_t(r.getSize()));
+		regions.push_back(reg);
+	}
+
+	_disasmCache.build(
+			_c2l->getArchitecture(),
+			static_cast<cs_mode>(_c2l->getBasicMode() + _c2l->getExtraMode()),
+			regions,
+			_ranges.getArchitectureInstructionAlignment(),
+			params.getThreads(),
+			[this](cs_insn* insn, CachedInstruction& ci)
+			{
+				classifyInstruction(insn, ci);
+			});
+
+	LOG << "\t" << "pre-disassembled instructions: " << _disasmCache.size()
+			<< std::endl;
+}
+
 void Decoder::initConfigFunctions()
 {
 	for (auto& p : _fnc2addr)
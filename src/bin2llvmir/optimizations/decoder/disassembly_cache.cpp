@@ -0,0 +1,313 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/disassembly_cache.cpp
+* @brief Cache of instructions speculatively disassembled before decoding.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <memory>
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+#include "retdec/capstone2llvmir/exceptions.h"
+#include "retdec/utils/parallel.h"
+
+using namespace retdec::common;
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+/**
+ * Part of some region that is disassembled by a single worker.
+ * Instructions starting in <start, end) are disassembled, but the last one
+ * may reach beyond @c end, up to the end of the region.
+ */
+struct Chunk
+{
+	std::uint64_t start = 0;
+	std::uint64_t end = 0;
+	const std::uint8_t* bytes = nullptr;
+	// Number of bytes from @c start to the end of the region.
+	std::size_t size = 0;
+	// The chunk is not the first one in its region.
+	bool continued = false;
+};
+
+/**
+ * Instructions disassembled from a single chunk.
+ */
+struct ChunkInstructions
+{
+	std::vector<CachedInstruction> insns;
+	// Address where the sweep would continue after the chunk.
+	std::uint64_t next = 0;
+};
+
+std::vector<Chunk> splitToChunks(
+		const std::vector<DisassemblyCache::Region>& regions,
+		std::size_t chunkSize)
+{
+	std::vector<Chunk> chunks;
+	for (auto& r : regions)
+	{
+		for (std::size_t off = 0; off < r.size; off += chunkSize)
+		{
+			Chunk c;
+			c.start = r.start + off;
+			c.end = r.start + std::min(off + chunkSize, r.size);
+			c.bytes = r.bytes + off;
+			c.size = r.size - off;
+			c.continued = off > 0;
+			chunks.push_back(c);
+		}
+	}
+	return chunks;
+}
+
+/**
+ * Capstone engine used by a single thread to sweep over the code.
+ */
+class Sweeper
+{
+	public:
+		Sweeper(
+				cs_arch arch,
+				cs_mode mode,
+				unsigned alignment,
+				const DisassemblyCache::Classifier& classifier)
+				: _step(alignment ? alignment : 1)
+				, _classifier(classifier)
+		{
+			if (cs_open(arch, mode, &_ce) != CS_ERR_OK)
+			{
+				throw capstone2llvmir::CapstoneError(cs_errno(_ce));
+			}
+			if (cs_option(_ce, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+			{
+				auto err = cs_errno(_ce);
+				cs_close(&_ce);
+				throw capstone2llvmir::CapstoneError(err);
+			}
+			_insn = cs_malloc(_ce);
+		}
+		~Sweeper()
+		{
+			cs_free(_insn, 1);
+			cs_close(&_ce);
+		}
+		Sweeper(const Sweeper&) = delete;
+		Sweeper& operator=(const Sweeper&) = delete;
+
+		/**
+		 * Disassemble the instruction at @a addr and append it to @a insns.
+		 * Then move @a bytes, @a size and @a addr after the instruction, or
+		 * to the next possible instruction start if there is no instruction.
+		 * @return @c False if the end of the region was reached.
+		 */
+		bool next(
+				const std::uint8_t*& bytes,
+				std::size_t& size,
+				std::uint64_t& addr,
+				std::vector<CachedInstruction>& insns)
+		{
+			std::uint64_t a = addr;
+			if (cs_disasm_iter(_ce, &bytes, &size, &addr, _insn))
+			{
+				CachedInstruction ci;
+				ci.address = a;
+				ci.id = _insn->id;
+				ci.size = _insn->size;
+				_classifier(_insn, ci);
+				insns.push_back(ci);
+				return size > 0;
+			}
+			// Capstone does not move on failure -> skip to the next possible
+			// instruction start.
+			else if (size > _step)
+			{
+				bytes += _step;
+				size -= _step;
+				addr += _step;
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+	private:
+		csh _ce = 0;
+		cs_insn* _insn = nullptr;
+		std::size_t _step = 1;
+		const DisassemblyCache::Classifier& _classifier;
+};
+
+ChunkInstructions disassembleChunk(
+		cs_arch arch,
+		cs_mode mode,
+		const Chunk& chunk,
+		unsigned alignment,
+		const DisassemblyCache::Classifier& classifier)
+{
+	Sweeper sweeper(arch, mode, alignment, classifier);
+
+	ChunkInstructions res;
+
+	const std::uint8_t* bytes = chunk.bytes;
+	std::size_t size = chunk.size;
+	std::uint64_t addr = chunk.start;
+	while (addr < chunk.end)
+	{
+		if (!sweeper.next(bytes, size, addr, res.insns))
+		{
+			addr = chunk.start + chunk.size;
+			break;
+		}
+	}
+	res.next = addr;
+
+	return res;
+}
+
+} // anonymous namespace
+
+/**
+ * Disassemble all the given regions and cache the disassembled instructions.
+ * Any previous content of the cache is discarded.
+ * @param arch       Capstone architecture.
+ * @param mode       Capstone mode (basic + extra).
+ * @param regions    Regions to disassemble. They must not overlap and must be
+ *                   sorted by their start addresses.
+ * @param alignment  Instruction alignment, used to skip undecodable bytes.
+ * @param threads    Maximal number of threads to use (0 = hardware threads).
+ * @param classifier Function that fills in the instruction properties.
+ */
+void DisassemblyCache::build(
+		cs_arch arch,
+		cs_mode mode,
+		const std::vector<Region>& regions,
+		unsigned alignment,
+		std::size_t threads,
+		const Classifier& classifier)
+{
+	clear();
+
+	auto chunks = splitToChunks(regions, CHUNK_SIZE);
+	std::vector<ChunkInstructions> results(chunks.size());
+
+	utils::parallelFor(chunks.size(), threads, [&](std::size_t i) {
+		results[i] = disassembleChunk(
+				arch,
+				mode,
+				chunks[i],
+				alignment,
+				classifier);
+	});
+
+	std::size_t total = 0;
+	for (auto& r : results)
+	{
+		total += r.insns.size();
+	}
+	_insns.reserve(total);
+
+	// Chunks are sorted and each of them contains only instructions starting
+	// inside of it -> concatenation is sorted.
+	std::unique_ptr<Sweeper> sweeper;
+	std::uint64_t next = 0;
+	for (std::size_t i = 0; i < chunks.size(); ++i)
+	{
+		auto& c = chunks[i];
+		auto& r = results[i];
+		auto first = r.insns.begin();
+
+		// The serial sweep would not start at the beginning of this chunk ->
+		// continue it until it meets the chunk's sweep, or leaves the chunk.
+		if (c.continued && next != c.start)
+		{
+			if (sweeper == nullptr)
+			{
+				sweeper = std::make_unique<Sweeper>(
+						arch,
+						mode,
+						alignment,
+						classifier);
+			}
+
+			const std::uint8_t* bytes = c.bytes + (next - c.start);
+			std::size_t size = c.size - (next - c.start);
+			while (next < c.end)
+			{
+				first = std::lower_bound(
+						first,
+						r.insns.end(),
+						next,
+						[](const CachedInstruction& ci, std::uint64_t addr)
+						{
+							return ci.address < addr;
+						});
+				if (first != r.insns.end() && first->address == next)
+				{
+					break;
+				}
+				if (!sweeper->next(bytes, size, next, _insns))
+				{
+					next = c.start + c.size;
+				}
+			}
+
+			if (next >= c.end)
+			{
+				r = ChunkInstructions();
+				continue;
+			}
+		}
+
+		_insns.insert(_insns.end(), first, r.insns.end());
+		next = r.next;
+		r = ChunkInstructions();
+	}
+}
+
+void DisassemblyCache::clear()
+{
+	_insns.clear();
+	_insns.shrink_to_fit();
+}
+
+/**
+ * @return Instruction disassembled at the given address, or @c nullptr if
+ * there is no such instruction in the cache.
+ */
+const CachedInstruction* DisassemblyCache::get(common::Address a) const
+{
+	if (a.isUndefined())
+	{
+		return nullptr;
+	}
+
+	auto it = std::lower_bound(
+			_insns.begin(),
+			_insns.end(),
+			a.getValue(),
+			[](const CachedInstruction& ci, std::uint64_t addr)
+			{
+				return ci.address < addr;
+			});
+	return it != _insns.end() && it->address == a.getValue() ? &(*it) : nullptr;
+}
+
+bool DisassemblyCache::empty() const
+{
+	return _insns.empty();
+}
+
+std::size_t DisassemblyCache::size() const
+{
+	return _insns.size();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
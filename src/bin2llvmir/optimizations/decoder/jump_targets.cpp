@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
@@ -180,7 +182,47 @@ std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
 
 Config* JumpTargets::config = nullptr;
 
-const JumpTarget* JumpTargets::push(
+JumpTargets::Key::Key(const JumpTarget& jt) :
+		address(jt.getAddress()),
+		fromAddress(jt.getFromAddress()),
+		type(jt.getType())
+{
+
+}
+
+bool JumpTargets::Key::operator==(const Key& o) const
+{
+	return address == o.address
+			&& fromAddress == o.fromAddress
+			&& type == o.type;
+}
+
+std::size_t JumpTargets::KeyHash::operator()(const Key& k) const
+{
+	std::size_t h = std::hash<std::uint64_t>()(k.address);
+	h ^= std::hash<std::uint64_t>()(k.fromAddress)
+			+ 0x9e3779b9 + (h << 6) + (h >> 2);
+	h ^= static_cast<std::size_t>(k.type)
+			+ 0x9e3779b9 + (h << 6) + (h >> 2);
+	return h;
+}
+
+bool JumpTargets::Lower::operator()(
+		const JumpTarget& a,
+		const JumpTarget& b) const
+{
+	// std::*_heap() keep the greatest element on the top.
+	return b < a;
+}
+
+/**
+ * Queue a new jump target.
+ * @return Queued jump target, or an empty value if the jump target was not
+ *         queued -- i.e. it is not aligned, its address is undefined, or an
+ *         equal jump target is already queued. In the last case, the existing
+ *         jump target is returned.
+ */
+std::optional<JumpTarget> JumpTargets::push(
 		retdec::common::Address a,
 		JumpTarget::eType t,
 		cs_mode m,
@@ -213,11 +255,27 @@ const JumpTarget* JumpTargets::push(
 		else
 		{
 			LOG << "\t\t" << "[+] JT @ " << a << std::endl;
-			return &(*_data.emplace(a, t, m, f, sz).first);
+
+			JumpTarget jt(a, t, m, f, sz);
+			if (!_queued.insert(Key(jt)).second)
+			{
+				// Rare -> linear search is fine.
+				for (auto& q : _data)
+				{
+					if (Key(q) == Key(jt))
+					{
+						return q;
+					}
+				}
+			}
+
+			_data.push_back(jt);
+			std::push_heap(_data.begin(), _data.end(), Lower());
+			return jt;
 		}
 	}
 
-	return nullptr;
+	return std::nullopt;
 }
 
 std::size_t JumpTargets::size() const
@@ -228,37 +286,33 @@ std::size_t JumpTargets::size() const
 void JumpTargets::clear()
 {
 	_data.clear();
+	_queued.clear();
 }
 
-bool JumpTargets::empty()
+bool JumpTargets::empty() const
 {
 	return _data.empty();
 }
 
-const JumpTarget& JumpTargets::top()
+const JumpTarget& JumpTargets::top() const
 {
-	return *_data.begin();
+	return _data.front();
 }
 
 void JumpTargets::pop()
 {
-	_data.erase(top());
-}
-
-auto JumpTargets::begin()
-{
-	return _data.begin();
-}
-
-auto JumpTargets::end()
-{
-	return _data.end();
+	_queued.erase(Key(top()));
+	std::pop_heap(_data.begin(), _data.end(), Lower());
+	_data.pop_back();
 }
 
 std::ostream& operator<<(std::ostream &out, const JumpTargets& jts)
 {
+	auto sorted = jts._data;
+	std::sort(sorted.begin(), sorted.end());
+
 	out << "Jump targets:" << std::endl;
-	for (auto& jt : jts._data)
+	for (auto& jt : sorted)
 	{
 		out << "\t" << jt << std::endl;
 	}
@@ -25,24 +25,22 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 		return true;
 	}
 
-	csh ce = _c2l->getCapstoneEngine();
-
 	uint64_t addr = jt.getAddress();
 	std::size_t nops = 0;
 	bool first = true;
 	bool storeOneToEax = false;
 	bool lastSyscall = false;
 	std::size_t decodedSz = 0;
-	while (cs_disasm_iter(ce, &bytes.first, &bytes.second, &addr, _dryCsInsn))
+	CachedInstruction insn;
+	while (disasmDryRun(bytes, addr, insn))
 	{
-		decodedSz += _dryCsInsn->size;
-		auto& detail = _dryCsInsn->detail->x86;
+		decodedSz += insn.size;
 
 		if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& (first || nops > 0)
-				&& _abi->isNopInstruction(_dryCsInsn))
+				&& insn.is(CachedInstruction::NOP))
 		{
-			nops += _dryCsInsn->size;
+			nops += insn.size;
 		}
 		else if (jt.getType() == JumpTarget::eType::LEFTOVER
 				&& nops > 0)
@@ -50,26 +48,18 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 			return nops;
 		}
 
-		if (_c2l->isReturnInstruction(*_dryCsInsn)
-				|| _c2l->isBranchInstruction(*_dryCsInsn))
+		if (insn.is(CachedInstruction::RETURN)
+				|| insn.is(CachedInstruction::BRANCH))
 		{
 			return false;
 		}
 
 		// TODO: not very strict - not checking that eax is not overwritten.
-		if (_dryCsInsn->id == X86_INS_MOV
-				&& detail.op_count == 2
-				&& detail.operands[0].type == X86_OP_REG
-				&& detail.operands[0].reg == X86_REG_EAX
-				&& detail.operands[1].type == X86_OP_IMM
-				&& detail.operands[1].imm == 1)
+		if (insn.is(CachedInstruction::STORE_ONE_TO_EAX))
 		{
 			storeOneToEax = true;
 		}
-		if (_dryCsInsn->id == X86_INS_INT
-				&& detail.op_count == 1
-				&& detail.operands[0].type == X86_OP_IMM
-				&& detail.operands[0].imm == 0x80)
+		if (insn.is(CachedInstruction::INT_80))
 		{
 			if (storeOneToEax)
 			{
@@ -77,7 +67,7 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 			}
 			lastSyscall = true;
 		}
-		else if (_dryCsInsn->id == X86_INS_SYSCALL)
+		else if (insn.is(CachedInstruction::SYSCALL))
 		{
 			lastSyscall = true;
 		}
@@ -109,5 +99,41 @@ std::size_t Decoder::decodeJumpTargetDryRun_x86(
 	return true;
 }
 
+void Decoder::classifyInstruction_x86(cs_insn* insn, CachedInstruction& ci)
+{
+	auto& detail = insn->detail->x86;
+
+	if (insn->id == X86_INS_MOV
+			&& detail.op_count == 2
+			&& detail.operands[0].type == X86_OP_REG
+			&& detail.operands[0].reg == X86_REG_EAX
+			&& detail.operands[1].type == X86_OP_IMM
+			&& detail.operands[1].imm == 1)
+	{
+		ci.flags |= CachedInstruction::STORE_ONE_TO_EAX;
+	}
+
+	if (insn->id == X86_INS_INT
+			&& detail.op_count == 1
+			&& detail.operands[0].type == X86_OP_IMM
+			&& detail.operands[0].imm == 0x80)
+	{
+		ci.flags |= CachedInstruction::INT_80;
+	}
+	else if (insn->id == X86_INS_SYSCALL)
+	{
+		ci.flags |= CachedInstruction::SYSCALL;
+	}
+
+	if ((ci.is(CachedInstruction::CALL)
+			|| ci.is(CachedInstruction::BRANCH)
+			|| ci.is(CachedInstruction::COND_BRANCH))
+			&& detail.op_count == 1
+			&& detail.operands[0].type == X86_OP_IMM)
+	{
+		ci.target = detail.operands[0].imm;
+	}
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
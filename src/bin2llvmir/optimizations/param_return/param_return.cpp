@@ -93,7 +93,8 @@ bool ParamReturn::run()
 		return false;
 	}
 
-	_RDA.runOnModule(*_module, _abi);
+	_RDA.runOnModule(*_module, _abi, false, &_parallelStats);
+	_parallelStats.log(getPassName().str());
 
 	collectAllCalls();
 //	dumpInfo();
@@ -21,6 +21,7 @@
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/names.h"
 #include "retdec/cpdetect/cpdetect.h"
+#include "retdec/demangler/demangle_cache.h"
 #include "retdec/utils/string.h"
 #include "retdec/yaracpp/yara_detector.h"
 
@@ -168,6 +169,15 @@ void ProviderInitialization::setConfig(retdec::config::Config* c)
 	_config = c;
 }
 
+/**
+ * Use @a data as the content of the input file instead of reading the input
+ * file from the disk. The @a data must outlive the pass.
+ */
+void ProviderInitialization::setInputData(const std::vector<std::uint8_t>* data)
+{
+	_inputData = data;
+}
+
 /**
  * @return Always @c false -- this pass does not modify module.
  */
@@ -199,10 +209,12 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	// Fileimage.
 	//
-	auto* f = FileImageProvider::addFileImage(
-			&m,
-			c->getConfig().parameters.getInputFile(),
-			c);
+	auto* f = _inputData
+			? FileImageProvider::addFileImage(&m, *_inputData, c)
+			: FileImageProvider::addFileImage(
+					&m,
+					c->getConfig().parameters.getInputFile(),
+					c);
 	if (f == nullptr)
 	{
 		throw std::runtime_error("ProviderInitialization: f == nullptr");
@@ -361,7 +373,14 @@ bool ProviderInitialization::runOnModule(Module& m)
 	{
 		yara.addRuleFile(crypto);
 	}
-	yara.analyze(c->getConfig().parameters.getInputFile());
+	if (_inputData)
+	{
+		yara.analyze(*_inputData);
+	}
+	else
+	{
+		yara.analyze(c->getConfig().parameters.getInputFile());
+	}
 	for(const auto &rule : yara.getDetectedRules())
 	{
 		common::Pattern p = saveCryptoRule(
@@ -392,6 +411,25 @@ bool ProviderInitialization::runOnModule(Module& m)
 		throw std::runtime_error("ProviderInitialization: d == nullptr");
 	}
 
+	// Symbol names are demangled again and again by many passes. If more
+	// threads are allowed, demangle them all at once.
+	//
+	if (c->getConfig().parameters.getThreads() != 1)
+	{
+		std::vector<std::string> names;
+		for (const auto* symTab : f->getFileFormat()->getSymbolTables())
+		{
+			for (std::size_t i = 0; i < symTab->getNumberOfSymbols(); ++i)
+			{
+				names.push_back(symTab->getSymbol(i)->getName());
+			}
+		}
+		d->getDemangler()->cache().demangleAll(
+				names,
+				c->getConfig().parameters.getThreads()
+		);
+	}
+
 	auto* debug = DebugFormatProvider::addDebugFormat(
 			&m,
 			f->getImage(),
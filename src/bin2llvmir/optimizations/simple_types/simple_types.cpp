@@ -88,7 +88,8 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	{
 		first = false;
 
-		RDA.runOnModule(M, AbiProvider::getAbi(&M));
+		RDA.runOnModule(M, AbiProvider::getAbi(&M), false, &parallelStats);
+		parallelStats.log(getPassName().str());
 		buildEqSets(M);
 		buildEquations();
 		eqSets.propagate(module);
@@ -70,7 +70,8 @@ bool StackAnalysis::run()
 	}
 
 	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	RDA.runOnModule(*_module, _abi, false, &_parallelStats);
+	_parallelStats.log(getPassName().str());
 
 	for (auto& f : *_module)
 	{
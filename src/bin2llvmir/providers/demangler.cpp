@@ -36,18 +36,25 @@ Demangler::Demangler(
 
 std::string Demangler::demangleToString(const std::string &mangled)
 {
-	return _demangler->demangleToString(mangled);
+	return _demangler->demangleToStringCached(mangled);
 }
 
 Demangler::FunctionPair Demangler::getPairFunction(const std::string &mangled)
 {
-	auto ctypesFunction = _demangler->demangleFunctionToCtypes(
-		mangled,
-		_ctypesModule,
-		_typeConfig->typeWidths(),
-		_typeConfig->typeSignedness(),
-		_typeConfig->defaultBitWidth()
-	);
+	// Functions are cached per demangler because they belong to its module.
+	auto it = _ctypesFunctions.find(mangled);
+	if (it == _ctypesFunctions.end()) {
+		auto ctypesFunction = _demangler->demangleFunctionToCtypes(
+			mangled,
+			_ctypesModule,
+			_typeConfig->typeWidths(),
+			_typeConfig->typeSignedness(),
+			_typeConfig->defaultBitWidth()
+		);
+		it = _ctypesFunctions.emplace(mangled, ctypesFunction).first;
+	}
+
+	auto ctypesFunction = it->second;
 	if (ctypesFunction == nullptr) {
 		return {};
 	}
@@ -36,6 +36,22 @@ FileImage::FileImage(
 
 }
 
+FileImage::FileImage(
+		llvm::Module* m,
+		const std::vector<std::uint8_t>& data,
+		Config* config)
+		:
+		FileImage(
+				m,
+				retdec::loader::createImage(
+						data.data(),
+						data.size(),
+						config->getConfig().fileFormat.isRaw()),
+				config)
+{
+
+}
+
 FileImage::FileImage(
 		llvm::Module* m,
 		const std::shared_ptr<retdec::fileformat::FileFormat>& ff,
@@ -641,6 +657,20 @@ FileImage* FileImageProvider::addFileImage(
 	return addFileImage(m, FileImage(m, path, config));
 }
 
+/**
+ * Create and add to provider a file image created from file content @a data
+ * for the given module @a m. The @a data must outlive the file image.
+ * @return Created and added file image or @c nullptr if something went wrong
+ *         and it was not successfully created.
+ */
+FileImage* FileImageProvider::addFileImage(
+		llvm::Module* m,
+		const std::vector<std::uint8_t>& data,
+		Config *config)
+{
+	return addFileImage(m, FileImage(m, data, config));
+}
+
 /**
  * Create and add to provider a file image @a ff for the given module @a m
  * and architecture @a a.
@@ -0,0 +1,75 @@
+/**
+ * @file src/bin2llvmir/utils/parallel.cpp
+ * @brief Function-parallel execution of independent per-function work.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "retdec/bin2llvmir/utils/parallel.h"
+#include "retdec/utils/io/log.h"
+
+using namespace retdec::utils::io;
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Record a single @c runOnFunctions() call.
+ */
+void ParallelStatistics::record(
+		std::size_t functions,
+		std::size_t threads,
+		double wallTime,
+		double workTime)
+{
+	_runs += 1;
+	_functions += functions;
+	_threads = std::max(_threads, threads);
+	_wallTime += wallTime;
+	_workTime += workTime;
+}
+
+/**
+ * @return Estimated speedup of the parallel work over serial execution.
+ */
+double ParallelStatistics::getSpeedup() const
+{
+	return _wallTime > 0.0 ? _workTime / _wallTime : 1.0;
+}
+
+/**
+ * Print the statistics of the function-parallel work done by pass @a pass.
+ */
+void ParallelStatistics::print(std::ostream& out, const std::string& pass) const
+{
+	out << std::fixed << std::setprecision(3)
+			<< pass
+			<< ": " << _functions << " functions in " << _runs
+			<< " runs, " << _threads << " threads, "
+			<< _wallTime << " s (serial estimate "
+			<< _workTime << " s), speedup "
+			<< std::setprecision(2) << getSpeedup() << "x"
+			<< std::endl;
+}
+
+/**
+ * Log the statistics of pass @a pass if its work was run on more than one
+ * thread.
+ */
+void ParallelStatistics::log(const std::string& pass) const
+{
+	if (_threads <= 1)
+	{
+		return;
+	}
+
+	std::stringstream report;
+	print(report, pass);
+	Log::info() << report.str();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -4,13 +4,16 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <memory>
 #include <ostream>
 #include <vector>
 
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/io/log.h"
+#include "retdec/utils/parallel.h"
 #include "retdec/utils/version.h"
 #include "retdec/patterngen/pattern_extractor/pattern_extractor.h"
 #include "yaramod/yaramod.h"
@@ -28,7 +31,7 @@ using namespace retdec::patterngen;
 
 void printUsage(Logger &log)
 {
-	log << "Usage: bin2pat [-o OUTPUT_FILE] [-n NOTE]"
+	log << "Usage: bin2pat [-o OUTPUT_FILE] [-n NOTE] [-j THREADS]"
 		<< " <INPUT_FILE [INPUT_FILE...] | -l LIST_FILE>\n\n"
 		<< "-h --help\n"
 		<< "    Show this help.\n\n"
@@ -40,6 +43,9 @@ void printUsage(Logger &log)
 		<< "-n --note NOTE\n"
 		<< "    Optional note that will be added to all rules.\n"
 		<< "    If multiple notes are given, only last one is used.\n\n"
+		<< "-j --threads THREADS\n"
+		<< "    Number of threads used to process input files.\n"
+		<< "    Default 0 means all hardware threads.\n\n"
 		<< "-l --list LIST_FILE\n"
 		<< "    Optionally pass the list of input files as a text file.\n"
 		<< "    This is useful for a large number of input files.\n\n";
@@ -63,6 +69,7 @@ void processArgs(const std::vector<std::string> &args)
 {
 	std::string note;
 	std::string outPath;
+	std::size_t threads = 0;
 	std::vector<std::string> inPaths;
 
 	for (std::size_t i = 0, e = args.size(); i < e; ++i) {
@@ -93,6 +100,22 @@ void processArgs(const std::vector<std::string> &args)
 				return;
 			}
 		}
+		else if (args[i] == "-j" || args[i] == "--threads") {
+			if (i + 1 < e) {
+				try {
+					threads = std::stoull(args[++i]);
+				}
+				catch (...) {
+					printErrorAndDie("invalid number of threads '"
+						+ args[i] + "'");
+					return;
+				}
+			}
+			else {
+				needValue(args[i]);
+				return;
+			}
+		}
 		else if (args[i] == "-l" || args[i] == "--list") {
 			// Ensure -l --list is not the last thing in args
 			if (&args[i] == &args.back()) {
@@ -140,35 +163,69 @@ void processArgs(const std::vector<std::string> &args)
 		return;
 	}
 
-	// Prepare builder.
-	yaramod::YaraFileBuilder builder;
+	// Open output before processing, rules are written as soon as they are
+	// extracted.
+	std::ofstream outputFile;
+	if (!outPath.empty()) {
+		outputFile.open(outPath);
+		if (!outputFile) {
+			printErrorAndDie("could not open output file");
+			return;
+		}
+	}
 
-	// Process files.
-	unsigned index = 0;
+	// Process files. Files are processed in parallel in batches. Rules of each
+	// batch are written in the order of input files, so the output does not
+	// depend on the number of threads and only one batch is kept in memory.
+	threads = getThreadCount(threads);
+	const std::size_t batchSize = threads * 8;
 	bool atLeastOne = false;
-	for (const auto &path : inPaths) {
-		PatternExtractor extractor(path, "file_" + std::to_string(index++));
-
-		// Add rules if valid.
-		if (!extractor.isValid()) {
-			// Sometimes, non-supported files are present in archives. We will
-			// only print warning if such a file is encountered.
-			Log::error() << Log::Error << "file '" << path << "' was not processed.\n";
-			Log::error() << "Problem: " << extractor.getErrorMessage() << ".\n\n";
-			continue;
-		}
-		else {
-			atLeastOne = true;
-			extractor.addRulesToBuilder(builder, note);
-
-			// Print warnings if any.
-			const auto &warnings = extractor.getWarnings();
-			if (!warnings.empty()) {
-				Log::error() << Log::Warning << "problems with file '" << path << "'\n";
-				for (const auto &warning : warnings) {
-					Log::error() << "Problem: " << warning << ".\n";
+	for (std::size_t first = 0; first < inPaths.size(); first += batchSize) {
+		const auto count = std::min(batchSize, inPaths.size() - first);
+		std::vector<std::unique_ptr<PatternExtractor>> extractors(count);
+		parallelFor(count, threads, [&](std::size_t i) {
+			extractors[i] = std::make_unique<PatternExtractor>(
+				inPaths[first + i], "file_" + std::to_string(first + i));
+		});
+
+		yaramod::YaraFileBuilder builder;
+		bool hasRules = false;
+		for (std::size_t i = 0; i < count; ++i) {
+			const auto &path = inPaths[first + i];
+			const auto &extractor = *extractors[i];
+
+			// Add rules if valid.
+			if (!extractor.isValid()) {
+				// Sometimes, non-supported files are present in archives. We
+				// will only print warning if such a file is encountered.
+				Log::error() << Log::Error << "file '" << path << "' was not processed.\n";
+				Log::error() << "Problem: " << extractor.getErrorMessage() << ".\n\n";
+				continue;
+			}
+			else {
+				atLeastOne = true;
+				hasRules = true;
+				extractor.addRulesToBuilder(builder, note);
+
+				// Print warnings if any.
+				const auto &warnings = extractor.getWarnings();
+				if (!warnings.empty()) {
+					Log::error() << Log::Warning << "problems with file '" << path << "'\n";
+					for (const auto &warning : warnings) {
+						Log::error() << "Problem: " << warning << ".\n";
+					}
+					Log::error() << "\n";
 				}
-				Log::error() << "\n";
+			}
+		}
+
+		// Print results.
+		if (hasRules) {
+			if (outputFile.is_open()) {
+				outputFile << builder.get(false)->getText() << "\n";
+			}
+			else {
+				Log::info() << builder.get(false)->getText() << "\n";
 			}
 		}
 	}
@@ -178,19 +235,6 @@ void processArgs(const std::vector<std::string> &args)
 		printErrorAndDie("no valid files were processed");
 		return;
 	}
-
-	// Print results.
-	if (!outPath.empty()) {
-		std::ofstream outputFile(outPath);
-		if (!outputFile) {
-			printErrorAndDie("could not open output file");
-			return;
-		}
-		outputFile << builder.get(false)->getText() << "\n";
-	}
-	else {
-		Log::info() << builder.get(false)->getText() << "\n";
-	}
 }
 
 int main(int argc, char *argv[])
@@ -9,6 +9,7 @@
 
 #include "retdec/capstone2llvmir/arm/arm.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
+#include "capstone2llvmir/translation_table.h"
 
 namespace retdec {
 namespace capstone2llvmir {
@@ -123,12 +124,12 @@ class Capstone2LlvmIrTranslatorArm_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorArm_impl::*)(
-					cs_insn* i,
-					cs_arm*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorArm_impl::*)(
+				cs_insn* i,
+				cs_arm*,
+				llvm::IRBuilder<>&);
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const TranslationTable<_translator_fnc, ARM_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // ARM instruction translation methods.
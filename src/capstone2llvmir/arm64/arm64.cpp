@@ -330,10 +330,9 @@ void Capstone2LlvmIrTranslatorArm64_impl::translateInstruction(
 
 	//std::cout << i->mnemonic << " " << i->op_str << std::endl;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = getTranslationFunction(_i2fm, i->id);
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 
 		(this->*f)(i, ai, irb);
 	}
@@ -9,6 +9,7 @@
 
 #include "retdec/capstone2llvmir/arm64/arm64.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
+#include "capstone2llvmir/translation_table.h"
 
 namespace retdec {
 namespace capstone2llvmir {
@@ -190,9 +191,8 @@ class Capstone2LlvmIrTranslatorArm64_impl :
 		/// Mapping from register to its parent register
 		std::map<uint32_t, uint32_t> _reg2parentMap;
 
-		static std::map<
-			std::size_t,
-			_translator_fnc> _i2fm;
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const TranslationTable<_translator_fnc, ARM64_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // ARM64 instruction translation methods.
@@ -1610,13 +1610,11 @@ void Capstone2LlvmIrTranslatorArm64_impl::initializeRegistersParentMap()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorArm64_impl::*)(
-			cs_insn* i,
-			cs_arm64*,
-			llvm::IRBuilder<>&)>
+constexpr TranslationTable<
+	Capstone2LlvmIrTranslatorArm64_impl::_translator_fnc,
+	ARM64_INS_ENDING>
 Capstone2LlvmIrTranslatorArm64_impl::_i2fm =
+makeTranslationTable<_translator_fnc, ARM64_INS_ENDING>(
 {
 	{ARM_INS_INVALID, nullptr},
 
@@ -2082,7 +2080,7 @@ Capstone2LlvmIrTranslatorArm64_impl::_i2fm =
 	{ARM64_INS_NGCS, &Capstone2LlvmIrTranslatorArm64_impl::translateNgc},
 
 	{ARM64_INS_ENDING, nullptr}
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
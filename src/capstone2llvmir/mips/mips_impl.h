@@ -9,6 +9,7 @@
 
 #include "retdec/capstone2llvmir/mips/mips.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
+#include "capstone2llvmir/translation_table.h"
 
 namespace retdec {
 namespace capstone2llvmir {
@@ -106,12 +107,12 @@ class Capstone2LlvmIrTranslatorMips_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorMips_impl::*)(
-					cs_insn* i,
-					cs_mips*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorMips_impl::*)(
+				cs_insn* i,
+				cs_mips*,
+				llvm::IRBuilder<>&);
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const TranslationTable<_translator_fnc, MIPS_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // MIPS instruction translation methods.
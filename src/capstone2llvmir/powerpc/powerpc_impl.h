@@ -9,6 +9,7 @@
 
 #include "retdec/capstone2llvmir/powerpc/powerpc.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
+#include "capstone2llvmir/translation_table.h"
 
 namespace retdec {
 namespace capstone2llvmir {
@@ -106,12 +107,12 @@ class Capstone2LlvmIrTranslatorPowerpc_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
-					cs_insn* i,
-					cs_ppc*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
+				cs_insn* i,
+				cs_ppc*,
+				llvm::IRBuilder<>&);
+		/// Mapping of Capstone instruction IDs to their translation functions.
+		static const TranslationTable<_translator_fnc, PPC_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // PowerPC instruction translation methods.
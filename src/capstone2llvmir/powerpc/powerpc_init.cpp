@@ -497,13 +497,11 @@ void Capstone2LlvmIrTranslatorPowerpc_impl::initializePseudoCallInstructionIDs()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
-			cs_insn* i,
-			cs_ppc*,
-			llvm::IRBuilder<>&)>
+constexpr TranslationTable<
+	Capstone2LlvmIrTranslatorPowerpc_impl::_translator_fnc,
+	PPC_INS_ENDING>
 Capstone2LlvmIrTranslatorPowerpc_impl::_i2fm =
+makeTranslationTable<_translator_fnc, PPC_INS_ENDING>(
 {
 		{PPC_INS_INVALID, nullptr},
 
@@ -1650,7 +1648,7 @@ Capstone2LlvmIrTranslatorPowerpc_impl::_i2fm =
 		{PPC_INS_BDZFLRL, &Capstone2LlvmIrTranslatorPowerpc_impl::translateB},
 
 		{PPC_INS_BCT, nullptr},
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -0,0 +1,64 @@
+/**
+ * @file src/capstone2llvmir/translation_table.h
+ * @brief Dense mapping of Capstone instruction IDs to translation methods.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#ifndef CAPSTONE2LLVMIR_TRANSLATION_TABLE_H
+#define CAPSTONE2LLVMIR_TRANSLATION_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace retdec {
+namespace capstone2llvmir {
+
+/**
+ * Table of translation methods indexed directly by Capstone instruction ID.
+ * @tparam Fnc Pointer to translator's member function type.
+ * @tparam N   Number of instruction IDs (i.e. @c <ARCH>_INS_ENDING).
+ */
+template <typename Fnc, std::size_t N>
+using TranslationTable = std::array<Fnc, N>;
+
+/**
+ * Create a dense translation table from the given (instruction ID, method)
+ * pairs. This is meant to be evaluated at compile time, so that the table is
+ * constant-initialized and no map needs to be populated at start-up.
+ *
+ * IDs that are out of the table's range (e.g. @c <ARCH>_INS_ENDING) are
+ * ignored. IDs that are not listed map to @c nullptr.
+ */
+template <typename Fnc, std::size_t N>
+constexpr TranslationTable<Fnc, N> makeTranslationTable(
+		std::initializer_list<std::pair<std::size_t, Fnc>> entries)
+{
+	TranslationTable<Fnc, N> table{};
+	for (auto& e : entries)
+	{
+		if (e.first < N)
+		{
+			table[e.first] = e.second;
+		}
+	}
+	return table;
+}
+
+/**
+ * Get translation method for the given instruction ID from the table, or
+ * @c nullptr if there is no such method.
+ */
+template <typename Fnc, std::size_t N>
+inline Fnc getTranslationFunction(
+		const TranslationTable<Fnc, N>& table,
+		std::size_t id)
+{
+	return id < N ? table[id] : nullptr;
+}
+
+} // namespace capstone2llvmir
+} // namespace retdec
+
+#endif
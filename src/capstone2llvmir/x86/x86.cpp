@@ -226,10 +226,9 @@ void Capstone2LlvmIrTranslatorX86_impl::translateInstruction(
 	cs_detail* d = i->detail;
 	cs_x86* xi = &d->x86;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = getTranslationFunction(_i2fm, i->id);
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 		(this->*f)(i, xi, irb);
 	}
 	else
@@ -9,6 +9,7 @@
 
 #include "retdec/capstone2llvmir/x86/x86.h"
 #include "capstone2llvmir/capstone2llvmir_impl.h"
+#include "capstone2llvmir/translation_table.h"
 
 namespace retdec {
 namespace capstone2llvmir {
@@ -208,13 +209,12 @@ class Capstone2LlvmIrTranslatorX86_impl :
 		/// map -- it will deal with added enums.
 		std::vector<uint32_t> _reg2parentMap;
 
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorX86_impl::*)(
+				cs_insn* i,
+				cs_x86*,
+				llvm::IRBuilder<>&);
 		/// Mapping of Capstone instruction IDs to their translation functions.
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorX86_impl::*)(
-					cs_insn* i,
-					cs_x86*,
-					llvm::IRBuilder<>&)> _i2fm;
+		static const TranslationTable<_translator_fnc, X86_INS_ENDING> _i2fm;
 
 		llvm::Value* top = nullptr;
 		llvm::Value* idx = nullptr;
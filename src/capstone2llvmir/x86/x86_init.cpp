@@ -597,13 +597,11 @@ void Capstone2LlvmIrTranslatorX86_impl::initializeRegistersParentMap64()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorX86_impl::*)(
-			cs_insn* i,
-			cs_x86*,
-			llvm::IRBuilder<>&)>
+constexpr TranslationTable<
+	Capstone2LlvmIrTranslatorX86_impl::_translator_fnc,
+	X86_INS_ENDING>
 Capstone2LlvmIrTranslatorX86_impl::_i2fm =
+makeTranslationTable<_translator_fnc, X86_INS_ENDING>(
 {
 		{X86_INS_INVALID, nullptr},
 
@@ -2115,7 +2113,7 @@ Capstone2LlvmIrTranslatorX86_impl::_i2fm =
 		{X86_INS_VCMPTRUE_USPD, nullptr},
 
 		{X86_INS_ENDING, nullptr}, // mark the end of the list of insn
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -44,10 +44,13 @@ const std::string JSON_logFile                  = "logFile";
 const std::string JSON_errFile                  = "errFile";
 
 const std::string JSON_detectStaticCode         = "detectStaticCode";
+const std::string JSON_preDisassemble           = "preDisassemble";
 const std::string JSON_backendDisabledOpts      = "backendDisabledOpts";
 const std::string JSON_backendEnabledOpts       = "backendEnabledOpts";
 const std::string JSON_backendCallInfoObtainer  = "backendCallInfoObtainer";
 const std::string JSON_backendVarRenamer        = "backendVarRenamer";
+const std::string JSON_backendAliasAnalysis     = "backendAliasAnalysis";
+const std::string JSON_backendCfgFormat         = "backendCfgFormat";
 const std::string JSON_backendNoOpts            = "backendNoOpts";
 const std::string JSON_backendEmitCfg           = "backendEmitCfg";
 const std::string JSON_backendEmitCg            = "backendEmitCg";
@@ -59,6 +62,7 @@ const std::string JSON_backendNoCompoundOperators = "backendNoCompoundOperators"
 const std::string JSON_backendNoSymbolicNames   = "backendNoSymbolicNames";
 
 const std::string JSON_timeout                  = "timeout";
+const std::string JSON_threads                  = "threads";
 const std::string JSON_maxMemoryLimit           = "maxMemoryLimit";
 const std::string JSON_maxMemoryLimitHalfRam    = "maxMemoryLimitHalfRam";
 
@@ -162,6 +166,14 @@ bool Parameters::isTimeout() const
 	return _timeout != 0;
 }
 
+/**
+ * @return Disassemble all the ranges to decode in parallel before decoding.
+ */
+bool Parameters::isPreDisassemble() const
+{
+	return _preDisassemble;
+}
+
 void Parameters::setIsVerboseOutput(bool b)
 {
 	_verboseOutput = b;
@@ -251,6 +263,11 @@ void Parameters::setTimeout(uint64_t seconds)
 	_timeout = seconds;
 }
 
+void Parameters::setThreads(uint64_t threads)
+{
+	_threads = threads;
+}
+
 void Parameters::setEntryPoint(const retdec::common::Address& a)
 {
 	_entryPoint = a;
@@ -285,6 +302,16 @@ void Parameters::setBackendVarRenamer(const std::string& val)
 	_backendVarRenamer = val;
 }
 
+void Parameters::setBackendAliasAnalysis(const std::string& val)
+{
+	_backendAliasAnalysis = val;
+}
+
+void Parameters::setBackendCfgFormat(const std::string& val)
+{
+	_backendCfgFormat = val;
+}
+
 void Parameters::setIsBackendNoOpts(bool b)
 {
 	_backendNoOpts = b;
@@ -335,6 +362,11 @@ void Parameters::setIsDetectStaticCode(bool b)
 	_detectStaticCode = b;
 }
 
+void Parameters::setIsPreDisassemble(bool b)
+{
+	_preDisassemble = b;
+}
+
 const std::string& Parameters::getOrdinalNumbersDirectory() const
 {
 	return _ordinalNumbersDirectory;
@@ -405,6 +437,14 @@ uint64_t Parameters::getTimeout() const
 	return _timeout;
 }
 
+/**
+ * @return Maximal number of threads to use, @c 0 means all hardware threads.
+ */
+uint64_t Parameters::getThreads() const
+{
+	return _threads;
+}
+
 retdec::common::Address Parameters::getEntryPoint() const
 {
 	return _entryPoint;
@@ -440,6 +480,20 @@ const std::string& Parameters::getBackendVarRenamer() const
 	return _backendVarRenamer;
 }
 
+const std::string& Parameters::getBackendAliasAnalysis() const
+{
+	return _backendAliasAnalysis;
+}
+
+/**
+ * @return Format of the emitted CFGs: @c dot (a file per function) or
+ *         @c json-lines (all functions in a single indexed file).
+ */
+const std::string& Parameters::getBackendCfgFormat() const
+{
+	return _backendCfgFormat;
+}
+
 void fixPath(std::string& path, fs::path root)
 {
 	fs::path p(path);
@@ -504,10 +558,13 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeString(writer, JSON_backendEnabledOpts, getBackendEnabledOpts());
 	serdes::serializeString(writer, JSON_backendCallInfoObtainer, getBackendCallInfoObtainer());
 	serdes::serializeString(writer, JSON_backendVarRenamer, getBackendVarRenamer());
+	serdes::serializeString(writer, JSON_backendAliasAnalysis, getBackendAliasAnalysis());
+	serdes::serializeString(writer, JSON_backendCfgFormat, getBackendCfgFormat());
 	serdes::serializeBool(writer, JSON_backendNoOpts, isBackendNoOpts());
 	serdes::serializeBool(writer, JSON_backendEmitCfg, isBackendEmitCfg());
 	serdes::serializeBool(writer, JSON_backendEmitCg, isBackendEmitCg());
 	serdes::serializeBool(writer, JSON_detectStaticCode, isDetectStaticCode());
+	serdes::serializeBool(writer, JSON_preDisassemble, isPreDisassemble());
 	serdes::serializeBool(writer, JSON_backendKeepAllBrackets, isBackendKeepAllBrackets());
 	serdes::serializeBool(writer, JSON_backendKeepLibraryFuncs, isBackendKeepLibraryFuncs());
 	serdes::serializeBool(writer, JSON_backendNoTimeVaryingInfo, isBackendNoTimeVaryingInfo());
@@ -516,6 +573,7 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeBool(writer, JSON_backendNoSymbolicNames, isBackendNoSymbolicNames());
 
 	serdes::serializeUint64(writer, JSON_timeout, getTimeout());
+	serdes::serializeUint64(writer, JSON_threads, getThreads());
 	serdes::serializeUint64(writer, JSON_maxMemoryLimit, getMaxMemoryLimit());
 	serdes::serializeBool(writer, JSON_maxMemoryLimitHalfRam, isMaxMemoryLimitHalfRam());
 
@@ -569,10 +627,13 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	setErrFile( serdes::deserializeString(val, JSON_errFile) );
 
 	setIsDetectStaticCode( serdes::deserializeBool(val, JSON_detectStaticCode, true) );
+	setIsPreDisassemble( serdes::deserializeBool(val, JSON_preDisassemble, false) );
 	setBackendDisabledOpts( serdes::deserializeString(val, JSON_backendDisabledOpts) );
 	setBackendEnabledOpts( serdes::deserializeString(val, JSON_backendEnabledOpts) );
 	setBackendCallInfoObtainer( serdes::deserializeString(val, JSON_backendCallInfoObtainer, "optim") );
 	setBackendVarRenamer( serdes::deserializeString(val, JSON_backendVarRenamer, "readable") );
+	setBackendAliasAnalysis( serdes::deserializeString(val, JSON_backendAliasAnalysis, "simple") );
+	setBackendCfgFormat( serdes::deserializeString(val, JSON_backendCfgFormat, "dot") );
 	setIsBackendNoOpts( serdes::deserializeBool(val, JSON_backendNoOpts, false) );
 	setIsBackendEmitCfg( serdes::deserializeBool(val, JSON_backendEmitCfg, false) );
 	setIsBackendEmitCg( serdes::deserializeBool(val, JSON_backendEmitCg, false) );
@@ -584,6 +645,7 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	setIsBackendNoSymbolicNames( serdes::deserializeBool(val, JSON_backendNoSymbolicNames, false) );
 
 	setTimeout( serdes::deserializeUint64(val, JSON_timeout, 0) );
+	setThreads( serdes::deserializeUint64(val, JSON_threads, 1) );
 	setMaxMemoryLimit( serdes::deserializeUint64(val, JSON_maxMemoryLimit, 0) );
 	setIsMaxMemoryLimitHalfRam( serdes::deserializeBool(val, JSON_maxMemoryLimitHalfRam, true) );
 
@@ -81,7 +81,7 @@ void DebugFormat::loadSymtab()
 
 		retdec::common::Function nf(funcName);
 
-		nf.setDemangledName(_demangler->demangleToString(funcName));
+		nf.setDemangledName(_demangler->demangleToStringCached(funcName));
 
 		retdec::common::Address addr = it->first;
 		if (_inFile->getFileFormat()->isArm() && addr % 2 != 0)
@@ -27,17 +27,16 @@ namespace debugformat {
 
 void DebugFormat::loadDwarf()
 {
-	// Open input file as buffer.
+	// Use input file bytes already read by the file format, the input
+	// does not have to exist on disk.
 	//
-	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffOrErr =
-			llvm::MemoryBuffer::getFileOrSTDIN(
-				_inFile->getFileFormat()->getPathToFile());
-	if (buffOrErr.getError())
-	{
-		return;
-	}
-	std::unique_ptr<llvm::MemoryBuffer> bufferPtr = std::move(buffOrErr.get());
-	llvm::MemoryBufferRef buffer = *bufferPtr;
+	auto* fileFormat = _inFile->getFileFormat();
+	const auto& bytes = fileFormat->getBytes();
+	llvm::MemoryBufferRef buffer(
+			llvm::StringRef(
+					reinterpret_cast<const char*>(bytes.data()),
+					bytes.size()),
+			fileFormat->getPathToFile());
 
 	// Open buffer as a binary file.
 	//
@@ -148,7 +147,7 @@ retdec::common::Function DebugFormat::loadDwarf_subprogram(llvm::DWARFDie die)
 	if (ln.hasValue())
 	{
 		linkageName = ln.getValue();
-		auto dn = _demangler->demangleToString(linkageName);
+		auto dn = _demangler->demangleToStringCached(linkageName);
 		demangledName = dn.empty() ? linkageName : dn;
 	}
 	if (name.empty() && linkageName.empty())
@@ -0,0 +1,165 @@
+/**
+ * @file src/demangler/demangle_cache.cpp
+ * @brief Cache of demangled names.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "retdec/demangler/demangle_cache.h"
+#include "retdec/demangler/demangler.h"
+#include "retdec/utils/parallel.h"
+
+namespace retdec {
+namespace demangler {
+
+namespace {
+
+/// Number of names demangled by one task of @c DemangleCache::demangleAll().
+const std::size_t NamesPerTask = 256;
+
+std::unique_ptr<Demangler> createDemangler(const std::string &compiler)
+{
+	if (compiler == "microsoft") {
+		return std::make_unique<MicrosoftDemangler>();
+	} else if (compiler == "borland") {
+		return std::make_unique<BorlandDemangler>();
+	} else if (compiler == "itanium") {
+		return std::make_unique<ItaniumDemangler>();
+	}
+	return nullptr;
+}
+
+}    // anonymous namespace
+
+/**
+ * @param compiler Name of compiler mangling scheme of the cached names.
+ */
+DemangleCache::DemangleCache(const std::string &compiler) :
+	_compiler(compiler) {}
+
+/**
+ * @brief Get cached result of demangling.
+ * @param mangled Mangled name.
+ * @param[out] demangled Set to the demangled name if it is cached.
+ * @param[out] status Set to the status of the demangling if it is cached.
+ * @return @c true if the name is cached, @c false otherwise.
+ */
+bool DemangleCache::get(
+	const std::string &mangled,
+	std::string &demangled,
+	Demangler::Status &status) const
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	auto entry = _entries.find(mangled);
+	if (entry == _entries.end()) {
+		return false;
+	}
+
+	demangled = *entry->second.demangled;
+	status = entry->second.status;
+	return true;
+}
+
+/**
+ * @brief Store result of demangling. Already cached name is not changed.
+ * @param mangled Mangled name.
+ * @param demangled Demangled name.
+ * @param status Status of the demangler after demangling of the name.
+ */
+void DemangleCache::add(
+	const std::string &mangled,
+	const std::string &demangled,
+	Demangler::Status status)
+{
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	addLocked(mangled, demangled, status);
+}
+
+/**
+ * @brief Store result of demangling, the mutex must be locked.
+ */
+void DemangleCache::addLocked(
+	const std::string &mangled,
+	const std::string &demangled,
+	Demangler::Status status)
+{
+	const auto *interned = &*_demangled.insert(demangled).first;
+	_entries.emplace(mangled, Entry{interned, status});
+}
+
+/**
+ * @brief Demangle all the given names that are not cached yet and store them.
+ * Nothing is done if the mangling scheme of the cache is not itanium,
+ * microsoft, or borland.
+ * @param names Mangled names.
+ * @param threads Maximal number of threads to use, @c 0 means all hardware
+ *        threads.
+ */
+void DemangleCache::demangleAll(
+	const std::vector<std::string> &names,
+	std::size_t threads)
+{
+	if (!createDemangler(_compiler)) {
+		return;
+	}
+
+	std::vector<const std::string*> todo;
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+		std::unordered_set<std::string> seen;
+		for (const auto &name : names) {
+			if (_entries.count(name)) {
+				continue;
+			}
+			if (seen.insert(name).second) {
+				todo.push_back(&name);
+			}
+		}
+	}
+
+	auto tasks = (todo.size() + NamesPerTask - 1) / NamesPerTask;
+	utils::parallelFor(tasks, threads, [&](std::size_t task) {
+		auto demangler = createDemangler(_compiler);
+		auto begin = task * NamesPerTask;
+		auto end = std::min(begin + NamesPerTask, todo.size());
+
+		std::vector<std::pair<std::string, Demangler::Status>> results;
+		results.reserve(end - begin);
+		for (auto i = begin; i < end; ++i) {
+			auto demangled = demangler->demangleToString(*todo[i]);
+			results.emplace_back(std::move(demangled), demangler->status());
+		}
+
+		std::unique_lock<std::shared_mutex> lock(_mutex);
+		for (auto i = begin; i < end; ++i) {
+			const auto &r = results[i - begin];
+			addLocked(*todo[i], r.first, r.second);
+		}
+	});
+}
+
+/**
+ * @return Number of cached names.
+ */
+std::size_t DemangleCache::size() const
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	return _entries.size();
+}
+
+/**
+ * @brief Remove all cached names.
+ */
+void DemangleCache::clear()
+{
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	_entries.clear();
+	_demangled.clear();
+}
+
+}
+}
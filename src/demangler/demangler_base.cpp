@@ -4,6 +4,7 @@
  * @copyright (c) 2018 Avast Software, licensed under the MIT license
  */
 
+#include "retdec/demangler/demangle_cache.h"
 #include "retdec/demangler/demangler_base.h"
 
 namespace retdec {
@@ -14,7 +15,26 @@ namespace demangler {
  * @param compiler Name of compiler mangling scheme.
  */
 Demangler::Demangler(const std::string &compiler) :
-	_compiler(compiler), _status(init) {}
+	_compiler(compiler), _status(init),
+	_cache(std::make_unique<DemangleCache>(compiler)) {}
+
+Demangler::~Demangler() = default;
+
+/**
+ * @brief Demangle to string using the cache of this demangler.
+ * Status is set the same way as by @c demangleToString().
+ * @param mangled Mangled name.
+ * @return Demangled name.
+ */
+std::string Demangler::demangleToStringCached(const std::string &mangled)
+{
+	std::string demangled;
+	if (!_cache->get(mangled, demangled, _status)) {
+		demangled = demangleToString(mangled);
+		_cache->add(mangled, demangled, _status);
+	}
+	return demangled;
+}
 
 /**
  * @return Currend demangler status.
@@ -24,5 +44,21 @@ Demangler::Status Demangler::status()
 	return _status;
 }
 
+/**
+ * @return Name of compiler mangling scheme.
+ */
+const std::string &Demangler::compiler() const
+{
+	return _compiler;
+}
+
+/**
+ * @return Cache of names demangled by this demangler.
+ */
+DemangleCache &Demangler::cache()
+{
+	return *_cache;
+}
+
 }
 }
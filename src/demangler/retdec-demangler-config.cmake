@@ -4,6 +4,7 @@ if(NOT TARGET retdec::demangler)
         REQUIRED
         COMPONENTS
             ctypesparser
+            utils
             llvm
     )
 
@@ -6,14 +6,17 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <sstream>
+#include <tuple>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/file_io.h"
+#include "retdec/utils/parallel.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
 #include "retdec/utils/io/log.h"
@@ -21,7 +24,7 @@
 #include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "retdec/fileformat/file_format/intel_hex/intel_hex_format.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
-#include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string_scanner.h"
 #include "retdec/fileformat/utils/conversions.h"
 #include "retdec/fileformat/utils/crypto.h"
 #include "retdec/fileformat/utils/file_io.h"
@@ -370,72 +373,107 @@ void FileFormat::initArchitecture(
 }
 
 /**
- * Load strings from data sections
+ * Run independent table loaders
+ * @param loaders Names of loaded tables and their loaders
+ *
+ * Loaders run in parallel if @c LoadFlags::PARALLEL_LOAD is set, so they must
+ * not modify data shared with other loaders without locking @c loadMutex.
+ * Duration of each loader is stored in the order of @a loaders, see
+ * @c getLoadTimes().
  */
-void FileFormat::loadStrings()
+void FileFormat::runLoaders(const std::vector<std::pair<std::string, std::function<void()>>> &loaders)
 {
-	if (!(getLoadFlags() & LoadFlags::DETECT_STRINGS))
-		return;
+	std::vector<double> times(loaders.size());
+	parallelFor(loaders.size(), (getLoadFlags() & LoadFlags::PARALLEL_LOAD) ? 0 : 1,
+			[&](std::size_t i)
+			{
+				auto start = std::chrono::steady_clock::now();
+				loaders[i].second();
+				times[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			});
 
-	loadStrings(StringType::Ascii, 1);
-	loadStrings(StringType::Wide, 2);
+	for (std::size_t i = 0; i < loaders.size(); ++i)
+		loadTimes.emplace_back(loaders[i].first, times[i]);
+}
 
-	// Sort and remove duplicates
-	std::sort(strings.begin(), strings.end());
-	auto endItr = std::unique(strings.begin(), strings.end());
-	strings.erase(endItr, strings.end());
+/**
+ * Add address range which should not be decoded for instructions
+ * @param range Address range
+ *
+ * Can be called by loaders run by @c runLoaders().
+ */
+void FileFormat::addNonDecodableRange(retdec::common::Range<std::uint64_t> range)
+{
+	std::lock_guard<std::mutex> lock(loadMutex);
+	nonDecodableRanges.insert(std::move(range));
 }
 
 /**
- * Load strings of specified type and with specified character size.
- * @param type Type of the strings.
- * @param charSize Character size.
+ * Load strings from data sections
+ *
+ * All sections (or segments if there are no sections) are searched for ASCII
+ * and wide strings in a single pass each, in parallel if
+ * @c LoadFlags::PARALLEL_LOAD is set. Found strings refer to the section data
+ * and their content is created only when it is asked for.
  */
-void FileFormat::loadStrings(StringType type, std::size_t charSize)
+void FileFormat::loadStrings()
 {
-	if (!sections.empty())
-	{
-		for (const auto* sec : sections)
-		{
-			if (!sec->isSomeData() && !sec->isDebug())
-				continue;
+	if (!(getLoadFlags() & LoadFlags::DETECT_STRINGS))
+		return;
 
-			loadStrings(type, charSize, sec);
-		}
-	}
+	std::vector<const SecSeg*> secSegs;
+	if (!sections.empty())
+		secSegs.assign(sections.begin(), sections.end());
 	else
-	{
-		for (const auto* seg : segments)
-		{
-			if (!seg->isSomeData() && !seg->isDebug())
-				continue;
-
-			loadStrings(type, charSize, seg);
-		}
-	}
-}
+		secSegs.assign(segments.begin(), segments.end());
+	secSegs.erase(std::remove_if(secSegs.begin(), secSegs.end(),
+			[](const SecSeg* secSeg) { return !secSeg->isSomeData() && !secSeg->isDebug(); }),
+			secSegs.end());
 
-void FileFormat::loadStrings(StringType type, std::size_t charSize, const SecSeg* secSeg)
-{
 	CharacterEndianness endian = isLittleEndian() ? CharacterEndianness::Little : CharacterEndianness::Big;
+	std::vector<std::vector<StringRecord>> records(secSegs.size());
+	parallelFor(secSegs.size(), (getLoadFlags() & LoadFlags::PARALLEL_LOAD) ? 0 : 1,
+			[&](std::size_t i)
+			{
+				auto bytes = secSegs[i]->getBytes();
+				scanStrings(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size(), endian, DefaultMinStringLength, records[i]);
+			});
 
-	for (auto begin = secSeg->getBytes().begin(), end = secSeg->getBytes().end(), itr = begin; itr != end;)
+	struct FoundString
 	{
-		if (makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
-		{
-			auto stringBeginItr = makeCharacterIterator(itr, begin, end, charSize);
-			auto stringDataEndItr = makeCharacterIterator(end, begin, end, charSize);
-			auto stringEndItr = stringBeginItr + 1;
-			while (stringEndItr != stringDataEndItr && stringEndItr.pointsToValidCharacter(endian))
-				++stringEndItr;
+		StringRecord record;
+		std::uint64_t fileOffset;
+		std::size_t secSegIndex;
+	};
 
-			if (static_cast<std::size_t>(stringEndItr - stringBeginItr) >= DefaultMinStringLength)
-				strings.emplace_back(type, secSeg->getOffset() + (itr - begin), secSeg->getName(), std::string{stringBeginItr, stringEndItr});
+	std::vector<FoundString> found;
+	for (std::size_t i = 0; i < records.size(); ++i)
+	{
+		for (const auto& record : records[i])
+			found.push_back({record, secSegs[i]->getOffset() + record.offset, i});
+	}
 
-			itr = stringEndItr.getUnderlyingIterator();
-		}
-		else
-			++itr;
+	// Sort and remove duplicates from overlapping sections. Strings of the
+	// same type at the same offset are made of the same bytes, so the shorter
+	// one is also the smaller one.
+	auto key = [](const FoundString& s) { return std::make_tuple(s.fileOffset, s.record.type, s.record.length); };
+	std::sort(found.begin(), found.end(),
+			[&](const FoundString& s1, const FoundString& s2) { return key(s1) < key(s2); });
+	found.erase(std::unique(found.begin(), found.end(),
+			[&](const FoundString& s1, const FoundString& s2) { return key(s1) == key(s2); }),
+			found.end());
+
+	strings.clear();
+	strings.reserve(found.size());
+	for (const auto& s : found)
+	{
+		const auto* secSeg = secSegs[s.secSegIndex];
+		auto charSize = getStringCharSize(s.record.type);
+		// Skip the zero byte of big endian wide characters.
+		auto firstChar = s.record.offset + (s.record.type == StringType::Wide && endian == CharacterEndianness::Big ? 1 : 0);
+		strings.emplace_back(s.record.type, s.fileOffset, secSeg->getName(),
+				reinterpret_cast<const std::uint8_t*>(secSeg->getBytes().data()) + firstChar,
+				s.record.length, charSize);
 	}
 }
 
@@ -1779,6 +1817,16 @@ const retdec::common::RangeContainer<std::uint64_t>& FileFormat::getNonDecodable
 	return nonDecodableRanges;
 }
 
+/**
+ * Get durations of loading of file format tables
+ * @return Names of tables and durations of their loading in seconds, in the
+ *    order in which the loaders were started
+ */
+const std::vector<std::pair<std::string, double>>& FileFormat::getLoadTimes() const
+{
+	return loadTimes;
+}
+
 /**
  * Get all sections
  * @return Reference to sections
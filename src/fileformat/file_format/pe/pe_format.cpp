@@ -631,13 +631,16 @@ void PeFormat::initStructures(const std::string & dllListFile)
 		loadRichHeader();
 		loadSections();
 		loadSymbols();
-		loadImports();
-		loadExports();
-		loadPdbInfo();
-		loadResources();
-		loadCertificates();
-		loadTlsInformation();
-		loadDotnetHeaders();
+		// These tables depend only on headers and sections
+		runLoaders({
+			{"imports", [this]() { loadImports(); }},
+			{"exports", [this]() { loadExports(); }},
+			{"pdbInfo", [this]() { loadPdbInfo(); }},
+			{"resources", [this]() { loadResources(); }},
+			{"certificates", [this]() { loadCertificates(); }},
+			{"tlsInformation", [this]() { loadTlsInformation(); }},
+			{"dotnetHeaders", [this]() { loadDotnetHeaders(); }}
+		});
 		loadVisualBasicHeader();
 		computeSectionTableHashes();
 		loadStrings();
@@ -1504,7 +1507,7 @@ void PeFormat::loadImports()
 
 	for(auto&& addressRange : formatParser->getImportDirectoryOccupiedAddresses())
 	{
-		nonDecodableRanges.insert(std::move(addressRange));
+		addNonDecodableRange(std::move(addressRange));
 	}
 }
 
@@ -1532,7 +1535,7 @@ void PeFormat::loadExports()
 
 	for(auto&& addressRange : formatParser->getExportDirectoryOccupiedAddresses())
 	{
-		nonDecodableRanges.insert(std::move(addressRange));
+		addNonDecodableRange(std::move(addressRange));
 	}
 }
 
@@ -1611,7 +1614,7 @@ void PeFormat::loadPdbInfo()
 
 	for (auto&& addressRange : formatParser->getDebugDirectoryOccupiedAddresses())
 	{
-		nonDecodableRanges.insert(std::move(addressRange));
+		addNonDecodableRange(std::move(addressRange));
 	}
 }
 
@@ -1796,7 +1799,7 @@ void PeFormat::loadResources()
 
 	for (auto&& addressRange : formatParser->getResourceDirectoryOccupiedAddresses())
 	{
-		nonDecodableRanges.insert(std::move(addressRange));
+		addNonDecodableRange(std::move(addressRange));
 	}
 }
 
@@ -24,8 +24,21 @@ const std::string& String::getSectionName() const
 	return sectionName;
 }
 
+/**
+ * Get content of the string. Strings found in the file are converted to
+ * @c std::string on the first call, which is not thread-safe.
+ * @return Content of the string
+ */
 const std::string& String::getContent() const
 {
+	if (data)
+	{
+		content.resize(length);
+		for (std::size_t i = 0; i < length; ++i)
+			content[i] = static_cast<char>(data[i * charSize]);
+		data = nullptr;
+	}
+
 	return content;
 }
 
@@ -62,23 +75,25 @@ void String::setSectionName(std::string&& stringSectionName)
 void String::setContent(const std::string& stringContent)
 {
 	content = stringContent;
+	data = nullptr;
 }
 
 void String::setContent(std::string&& stringContent)
 {
 	content = std::move(stringContent);
+	data = nullptr;
 }
 
 bool String::operator<(const String& rhs) const
 {
 	return (fileOffset < rhs.fileOffset)
 		|| (fileOffset == rhs.fileOffset && type < rhs.getType())
-		|| (fileOffset == rhs.fileOffset && type == rhs.type && content < rhs.content);
+		|| (fileOffset == rhs.fileOffset && type == rhs.type && getContent() < rhs.getContent());
 }
 
 bool String::operator==(const String& rhs) const
 {
-	return (fileOffset == rhs.fileOffset) && (type == rhs.type) && (content == rhs.content);
+	return (fileOffset == rhs.fileOffset) && (type == rhs.type) && (getContent() == rhs.getContent());
 }
 
 bool String::operator!=(const String& rhs) const
@@ -0,0 +1,168 @@
+/**
+ * @file src/fileformat/types/strings/string_scanner.cpp
+ * @brief Detection of printable strings in raw bytes.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <cstring>
+#include <limits>
+
+#include "retdec/fileformat/types/strings/string_scanner.h"
+
+namespace retdec {
+namespace fileformat {
+
+namespace
+{
+
+const std::size_t NoRun = std::numeric_limits<std::size_t>::max();
+
+/// Number of bytes tested at once by the fast paths.
+const std::size_t BlockSize = sizeof(std::uint64_t);
+
+const std::uint64_t LowBits = 0x0101010101010101ULL;
+const std::uint64_t HighBits = 0x8080808080808080ULL;
+const std::uint64_t SevenBits = 0x7f7f7f7f7f7f7f7fULL;
+
+/**
+ * Printable character in the "C" locale (same as @c std::isprint()).
+ */
+inline bool isPrintable(std::uint8_t c)
+{
+	return c >= 0x20 && c <= 0x7e;
+}
+
+inline std::uint64_t loadBlock(const std::uint8_t *data)
+{
+	std::uint64_t block;
+	std::memcpy(&block, data, sizeof(block));
+	return block;
+}
+
+/**
+ * Does any byte of the block fall into [0x20, 0x7e]?
+ */
+inline bool hasPrintable(std::uint64_t x)
+{
+	// Bytes in (0x1f, 0x7f), see "Determine if a word has a byte between m
+	// and n" in Bit Twiddling Hacks.
+	std::uint64_t low = x & SevenBits;
+	return ((LowBits * (127 + 0x7f) - low) & ~x & (low + LowBits * (127 - 0x1f)) & HighBits) != 0;
+}
+
+/**
+ * Are all the bytes of the block in [0x20, 0x7e]?
+ */
+inline bool isAllPrintable(std::uint64_t x)
+{
+	bool hasLess = ((x - LowBits * 0x20) & ~x & HighBits) != 0;
+	bool hasMore = (((x + LowBits * (127 - 0x7e)) | x) & HighBits) != 0;
+	return !hasLess && !hasMore;
+}
+
+} // anonymous namespace
+
+/**
+ * Get size of a single character of the given string type.
+ * @param type Type of the strings.
+ * @return Character size in bytes.
+ */
+std::size_t getStringCharSize(StringType type)
+{
+	return type == StringType::Wide ? 2 : 1;
+}
+
+/**
+ * Find ASCII strings and 2-byte wide strings of the given endianness in a
+ * single pass over the data.
+ *
+ * A string is a maximal run of at least @a minLength printable characters.
+ * A wide character is a printable byte and a zero byte in the order given
+ * by @a endian. The found strings are the same as if the data were searched
+ * with @c CharacterIterator separately for every character size.
+ *
+ * Blocks of data without printable bytes (and blocks inside ASCII strings)
+ * are tested and skipped as a whole.
+ *
+ * @param data Data to search.
+ * @param size Size of @a data.
+ * @param endian Endianness of wide characters.
+ * @param minLength Minimal number of characters in a string.
+ * @param result Found strings are appended here.
+ */
+void scanStrings(
+		const std::uint8_t *data,
+		std::size_t size,
+		CharacterEndianness endian,
+		std::size_t minLength,
+		std::vector<StringRecord> &result)
+{
+	const bool little = endian == CharacterEndianness::Little;
+	const std::size_t wideSize = getStringCharSize(StringType::Wide);
+
+	std::size_t asciiStart = NoRun;
+	// Wide strings starting at even and odd offsets never overlap, but each
+	// of them must be tracked separately.
+	std::size_t wideStart[2] = {NoRun, NoRun};
+
+	auto addAscii = [&](std::size_t end) {
+		if (end - asciiStart >= minLength)
+			result.push_back({StringType::Ascii, asciiStart, end - asciiStart});
+		asciiStart = NoRun;
+	};
+	auto addWide = [&](std::size_t parity, std::size_t end) {
+		auto length = (end - wideStart[parity]) / wideSize;
+		if (length >= minLength)
+			result.push_back({StringType::Wide, wideStart[parity], length});
+		wideStart[parity] = NoRun;
+	};
+
+	for (std::size_t i = 0; i < size;)
+	{
+		// The fast paths advance one byte less than the block size because
+		// a wide character starting at the last byte reaches into the next
+		// block.
+		if (wideStart[0] == NoRun && wideStart[1] == NoRun && i + BlockSize <= size)
+		{
+			auto block = loadBlock(data + i);
+			if (asciiStart == NoRun && !hasPrintable(block))
+			{
+				i += BlockSize - 1;
+				continue;
+			}
+			if (asciiStart != NoRun && isAllPrintable(block))
+			{
+				i += BlockSize - 1;
+				continue;
+			}
+		}
+
+		bool printable = isPrintable(data[i]);
+		if (printable && asciiStart == NoRun)
+			asciiStart = i;
+		else if (!printable && asciiStart != NoRun)
+			addAscii(i);
+
+		bool wide = i + 1 < size && (little
+				? printable && data[i + 1] == 0
+				: data[i] == 0 && isPrintable(data[i + 1]));
+		auto parity = i & 1;
+		if (wide && wideStart[parity] == NoRun)
+			wideStart[parity] = i;
+		else if (!wide && wideStart[parity] != NoRun)
+			addWide(parity, i);
+
+		++i;
+	}
+
+	if (asciiStart != NoRun)
+		addAscii(size);
+	for (std::size_t parity = 0; parity < 2; ++parity)
+	{
+		if (wideStart[parity] != NoRun)
+			addWide(parity, size);
+	}
+}
+
+} // namespace fileformat
+} // namespace retdec
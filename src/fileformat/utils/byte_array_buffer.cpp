@@ -4,6 +4,7 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <functional>
 #include <cassert>
 #include <cstring>
@@ -66,43 +67,47 @@ std::streamsize byte_array_buffer::showmanyc()
 	return end_ - current_;
 }
 
+std::streamsize byte_array_buffer::xsgetn(char_type* s, std::streamsize count)
+{
+	std::streamsize n = std::min<std::streamsize>(count, end_ - current_);
+	if (n > 0)
+	{
+		std::memcpy(s, current_, n);
+		current_ += n;
+	}
+	return n;
+}
+
 std::streampos byte_array_buffer::seekoff(
 		std::streamoff off,
 		std::ios_base::seekdir way,
 		std::ios_base::openmode which)
 {
-	if (way == std::ios_base::beg)
-	{
-		current_ = begin_ + off;
-	}
-	else if (way == std::ios_base::cur)
+	std::streamoff base = 0;
+	if (way == std::ios_base::cur)
 	{
-		current_ += off;
+		base = current_ - begin_;
 	}
 	else if (way == std::ios_base::end)
 	{
-		current_ = end_;
+		base = end_ - begin_;
 	}
 
-	if (current_ < begin_ || current_ > end_)
-	{
-		return -1;
-	}
-
-	return current_ - begin_;
+	return seekpos(base + off, which);
 }
 
 std::streampos byte_array_buffer::seekpos(
 		std::streampos sp,
 		std::ios_base::openmode which)
 {
-	current_ = begin_ + sp;
-
-	if (current_ < begin_ || current_ > end_)
+	// Invalid position leaves the current one untouched.
+	std::streamoff off = sp;
+	if (off < 0 || off > end_ - begin_)
 	{
 		return -1;
 	}
 
+	current_ = begin_ + off;
 	return current_ - begin_;
 }
 
@@ -76,6 +76,8 @@ struct ProgParams
 	std::size_t epBytesCount = EP_BYTES_SIZE;
 	/// load flags for `fileformat`
 	LoadFlags loadFlags = LoadFlags::NONE;
+	/// print durations of loading of file format tables
+	bool printLoadTimes = false;
 
 	friend std::ostream& operator<<(std::ostream& os, const ProgParams& pp);
 };
@@ -96,6 +98,7 @@ std::ostream& operator<<(std::ostream& os, const ProgParams& pp)
 	os << "max half memory    : " << pp.maxMemoryHalfRAM << "\n";
 	os << "ep bytes count     : " << pp.epBytesCount << "\n";
 	os << "load flags         : " << pp.loadFlags << "\n";
+	os << "print load times   : " << pp.printLoadTimes << "\n";
 
 	os << "yara malware rules : " << "\n";
 	for (auto& r : pp.yaraMalwarePaths)
@@ -195,6 +198,9 @@ void printHelp()
 				<< "\n"
 				<< "Options for specifying properties to load from the file:\n"
 				<< "    --strings, -S         Load strings in the input file and print them.\n"
+				<< "    --parallel            Use all available threads for loading of the file.\n"
+				<< "    --load-times          Print durations of loading of file format tables\n"
+				<< "                          to the standard error.\n"
 				<< "    --no-hashes[=all|file|verbose]\n"
 				<< "                          Do not print and calculate hashes.\n"
 				<< "                          Either all hashes or only file/verbose hashes.\n"
@@ -609,6 +615,15 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 			params.loadFlags = static_cast<LoadFlags>(params.loadFlags
 					| LoadFlags::DETECT_STRINGS);
 		}
+		else if (c == "--parallel")
+		{
+			params.loadFlags = static_cast<LoadFlags>(params.loadFlags
+					| LoadFlags::PARALLEL_LOAD);
+		}
+		else if (c == "--load-times")
+		{
+			params.printLoadTimes = true;
+		}
 		else if (c == "-m" || c == "--malware")
 		{
 			params.yaraMalwarePaths.insert(getParamOrDie(argv, i));
@@ -805,6 +820,14 @@ int main(int argc, char* argv[])
 					break;
 				}
 
+				if(params.printLoadTimes)
+				{
+					for(const auto &loadTime : fileDetector->getFileParser()->getLoadTimes())
+					{
+						Log::error() << "Loading of " << loadTime.first << ": " << loadTime.second << " s\n";
+					}
+				}
+
 				if(useConfig)
 				{
 					fileDetector->setConfigFile(config);
@@ -0,0 +1,937 @@
+/**
+* @file src/llvmir2hll/analysis/alias_analysis/alias_analyses/steensgaard_alias_analysis.cpp
+* @brief Implementation of SteensgaardAliasAnalysis.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <utility>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analyses/steensgaard_alias_analysis.h"
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis_factory.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/address_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
+#include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/array_type.h"
+#include "retdec/llvmir2hll/ir/assign_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_cast_expr.h"
+#include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shl_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shr_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/comma_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_array.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_float.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/const_null_pointer.h"
+#include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/const_struct.h"
+#include "retdec/llvmir2hll/ir/const_symbol.h"
+#include "retdec/llvmir2hll/ir/deref_op_expr.h"
+#include "retdec/llvmir2hll/ir/div_op_expr.h"
+#include "retdec/llvmir2hll/ir/eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/ext_cast_expr.h"
+#include "retdec/llvmir2hll/ir/for_loop_stmt.h"
+#include "retdec/llvmir2hll/ir/fp_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/global_var_def.h"
+#include "retdec/llvmir2hll/ir/gt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/gt_op_expr.h"
+#include "retdec/llvmir2hll/ir/int_to_fp_cast_expr.h"
+#include "retdec/llvmir2hll/ir/int_to_ptr_cast_expr.h"
+#include "retdec/llvmir2hll/ir/lt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/mod_op_expr.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/neg_op_expr.h"
+#include "retdec/llvmir2hll/ir/neq_op_expr.h"
+#include "retdec/llvmir2hll/ir/not_op_expr.h"
+#include "retdec/llvmir2hll/ir/or_op_expr.h"
+#include "retdec/llvmir2hll/ir/pointer_type.h"
+#include "retdec/llvmir2hll/ir/ptr_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/statement.h"
+#include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/ternary_op_expr.h"
+#include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
+#include "retdec/llvmir2hll/ir/var_def_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/func_fingerprinter.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::hasItem;
+
+namespace retdec {
+namespace llvmir2hll {
+
+REGISTER_AT_FACTORY("steensgaard", STEENSGAARD_ALIAS_ANALYSIS_ID,
+	AliasAnalysisFactory, SteensgaardAliasAnalysis::create);
+
+namespace {
+/// The empty set of variables.
+const VarSet EMPTY_VAR_SET = VarSet();
+}
+
+/**
+* @brief Constructs a new analysis.
+*/
+SteensgaardAliasAnalysis::SteensgaardAliasAnalysis(): AliasAnalysis(),
+	OrderedAllVisitor(true, true), parents(), ranks(), pointees(), inexact(),
+	escapedNode(NoNode), nonVarMemoryNode(NoNode), varNodes(), retNodes(),
+	funcsByName(), directlyCalledFuncs(), addressTakenFuncs(),
+	funcFingerprints(), globalVarsAnalyzed(false), globalVarsFingerprint(0),
+	allAddressedVars(), classVars(), resultsChanged(false), func(),
+	lastNode(NoNode) {}
+
+/**
+* @brief Creates a new alias analysis.
+*/
+ShPtr<AliasAnalysis> SteensgaardAliasAnalysis::create() {
+	return ShPtr<SteensgaardAliasAnalysis>(new SteensgaardAliasAnalysis());
+}
+
+std::string SteensgaardAliasAnalysis::getId() const {
+	return STEENSGAARD_ALIAS_ANALYSIS_ID;
+}
+
+void SteensgaardAliasAnalysis::init(ShPtr<Module> module) {
+	resultsChanged = false;
+
+	// Results computed for another module are useless. For the same module,
+	// however, they remain a sound approximation, so we only add constraints
+	// from functions that have changed since the last initialization.
+	if (module != this->module) {
+		reset();
+	}
+	AliasAnalysis::init(module);
+	restart();
+
+	funcsByName.clear();
+	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
+		funcsByName[(*i)->getName()] = *i;
+	}
+
+	auto newGlobalVarsFingerprint = FuncFingerprinter::getGlobalVarsFingerprint(
+		module);
+	if (!globalVarsAnalyzed || newGlobalVarsFingerprint != globalVarsFingerprint) {
+		analyzeGlobalVars();
+		globalVarsAnalyzed = true;
+		globalVarsFingerprint = newGlobalVarsFingerprint;
+	}
+
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		auto fingerprint = FuncFingerprinter::getFingerprint(*i);
+		auto fingerprintIter = funcFingerprints.find(*i);
+		if (fingerprintIter == funcFingerprints.end() ||
+				fingerprintIter->second != fingerprint) {
+			analyzeFunc(*i);
+			funcFingerprints[*i] = fingerprint;
+		}
+	}
+	func.reset();
+
+	makeFuncsCalledFromOutsideEscape();
+	computeClassVars();
+	flattenClasses();
+}
+
+const VarSet &SteensgaardAliasAnalysis::mayPointTo(ShPtr<Variable> var) const {
+	if (!isa<PointerType>(var->getType())) {
+		// Assumption: a non-pointer variable never points to any variable.
+		return EMPTY_VAR_SET;
+	}
+
+	if (!hasItem(varNodes, var)) {
+		// We have no information about the given pointer -> assume that it
+		// may alias with all the variables that have their address taken.
+		return allAddressedVars;
+	}
+
+	auto pointeeClass = getPointeeClass(var);
+	if (pointeeClass == NoNode) {
+		// Nothing that may point to a variable is ever assigned into it.
+		return EMPTY_VAR_SET;
+	}
+
+	if (pointeeClass == getClass(escapedNode)) {
+		// The pointer may point to memory accessible from outside of the
+		// module, i.e. anywhere.
+		return allAddressedVars;
+	}
+
+	auto classVarsIter = classVars.find(pointeeClass);
+	return classVarsIter != classVars.end() ? classVarsIter->second :
+		EMPTY_VAR_SET;
+}
+
+ShPtr<Variable> SteensgaardAliasAnalysis::pointsTo(ShPtr<Variable> var) const {
+	if (!isa<PointerType>(var->getType()) || !hasItem(varNodes, var)) {
+		return ShPtr<Variable>();
+	}
+
+	// The escaped class and the class of memory that does not belong to any
+	// variable are inexact, so they are ruled out here as well.
+	auto pointeeClass = getPointeeClass(var);
+	if (pointeeClass == NoNode || inexact[pointeeClass]) {
+		return ShPtr<Variable>();
+	}
+
+	// The analysis is flow-insensitive, so the pointer may also be null or
+	// uninitialized at some places. However, dereferencing it there is
+	// undefined, so every valid dereference accesses the variable.
+	auto classVarsIter = classVars.find(pointeeClass);
+	if (classVarsIter == classVars.end() || classVarsIter->second.size() != 1) {
+		return ShPtr<Variable>();
+	}
+	return *classVarsIter->second.begin();
+}
+
+bool SteensgaardAliasAnalysis::mayBePointed(ShPtr<Variable> var) const {
+	// Assumption: a variable may be pointed if and only if its address is
+	// taken.
+	return hasItem(allAddressedVars, var);
+}
+
+/**
+* @brief Returns @c true if the last call to init() has changed the results,
+*        @c false otherwise.
+*
+* Re-analyzing a changed function mostly adds constraints that are already
+* present, in which case the results do not change.
+*/
+bool SteensgaardAliasAnalysis::resultsChangedByLastInit() const {
+	return resultsChanged;
+}
+
+/**
+* @brief Throws away all the computed information.
+*/
+void SteensgaardAliasAnalysis::reset() {
+	parents.clear();
+	ranks.clear();
+	pointees.clear();
+	inexact.clear();
+	varNodes.clear();
+	retNodes.clear();
+	directlyCalledFuncs.clear();
+	addressTakenFuncs.clear();
+	funcFingerprints.clear();
+	globalVarsAnalyzed = false;
+	allAddressedVars.clear();
+	classVars.clear();
+	resultsChanged = true;
+
+	// The escaped memory may contain pointers to itself.
+	escapedNode = createNode();
+	pointees[escapedNode] = escapedNode;
+	inexact[escapedNode] = true;
+
+	nonVarMemoryNode = createNode();
+	inexact[nonVarMemoryNode] = true;
+}
+
+/**
+* @brief Adds constraints from the initializers of global variables.
+*/
+void SteensgaardAliasAnalysis::analyzeGlobalVars() {
+	for (auto i = module->global_var_begin(), e = module->global_var_end();
+			i != e; ++i) {
+		Node varNode = getVarNode((*i)->getVar());
+		if (ShPtr<Expression> init = (*i)->getInitializer()) {
+			joinPointees(varNode, getValueNode(init));
+		}
+	}
+}
+
+/**
+* @brief Adds constraints from the given function.
+*/
+void SteensgaardAliasAnalysis::analyzeFunc(ShPtr<Function> func) {
+	this->func = func;
+	for (const auto &param : func->getParams()) {
+		getVarNode(param);
+	}
+	if (ShPtr<Statement> body = func->getBody()) {
+		visitStmt(body);
+	}
+}
+
+/**
+* @brief Makes parameters and return values of functions that may be called
+*        from outside of the module escape.
+*
+* These are functions that are not called directly from the module or whose
+* address is taken.
+*/
+void SteensgaardAliasAnalysis::makeFuncsCalledFromOutsideEscape() {
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		if (hasItem(directlyCalledFuncs, *i) &&
+				!hasItem(addressTakenFuncs, *i)) {
+			continue;
+		}
+
+		for (const auto &param : (*i)->getParams()) {
+			joinPointees(getVarNode(param), escapedNode);
+		}
+		joinPointees(getRetNode(*i), escapedNode);
+	}
+}
+
+/**
+* @brief Computes the variables with their address taken in every class.
+*/
+void SteensgaardAliasAnalysis::computeClassVars() {
+	classVars.clear();
+	for (const auto &p : varNodes) {
+		if (hasItem(allAddressedVars, p.first)) {
+			classVars[find(p.second)].insert(p.first);
+		}
+	}
+}
+
+/**
+* @brief Makes every node a direct child of the representative of its class.
+*
+* After that, getClass() finds the representative in a single step.
+*/
+void SteensgaardAliasAnalysis::flattenClasses() {
+	for (Node node = 0, e = parents.size(); node < e; ++node) {
+		parents[node] = find(node);
+	}
+}
+
+/**
+* @brief Creates a new node forming a class of its own.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::createNode() {
+	Node node = parents.size();
+	parents.push_back(node);
+	ranks.push_back(0);
+	pointees.push_back(NoNode);
+	inexact.push_back(false);
+	return node;
+}
+
+/**
+* @brief Returns the representative of the class of @a node.
+*
+* The paths to the representative are shortened on the way.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::find(Node node) {
+	while (parents[node] != node) {
+		// Path halving.
+		parents[node] = parents[parents[node]];
+		node = parents[node];
+	}
+	return node;
+}
+
+/**
+* @brief Returns the representative of the class of @a node without modifying
+*        the union-find structure.
+*
+* Use it only after the analysis, when the classes have been flattened.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getClass(
+		Node node) const {
+	while (parents[node] != node) {
+		node = parents[node];
+	}
+	return node;
+}
+
+/**
+* @brief Returns the class to which @a var points.
+*
+* If @a var has no node or its class has no pointee, @c NoNode is returned.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getPointeeClass(
+		ShPtr<Variable> var) const {
+	auto varNodeIter = varNodes.find(var);
+	if (varNodeIter == varNodes.end()) {
+		return NoNode;
+	}
+
+	auto pointee = pointees[getClass(varNodeIter->second)];
+	return pointee != NoNode ? getClass(pointee) : NoNode;
+}
+
+/**
+* @brief Merges the classes of @a node1 and @a node2.
+*
+* The pointees of the merged classes are merged as well.
+*/
+void SteensgaardAliasAnalysis::unify(Node node1, Node node2) {
+	std::vector<std::pair<Node, Node>> toUnify{{node1, node2}};
+	while (!toUnify.empty()) {
+		auto nodes = toUnify.back();
+		toUnify.pop_back();
+
+		Node root1 = find(nodes.first);
+		Node root2 = find(nodes.second);
+		if (root1 == root2) {
+			continue;
+		}
+
+		resultsChanged = true;
+		if (ranks[root1] < ranks[root2]) {
+			std::swap(root1, root2);
+		}
+		parents[root2] = root1;
+		if (ranks[root1] == ranks[root2]) {
+			++ranks[root1];
+		}
+		inexact[root1] = inexact[root1] || inexact[root2];
+
+		if (pointees[root1] == NoNode) {
+			pointees[root1] = pointees[root2];
+		} else if (pointees[root2] != NoNode) {
+			toUnify.emplace_back(pointees[root1], pointees[root2]);
+		}
+	}
+}
+
+/**
+* @brief Returns the node representing the memory to which @a node points.
+*
+* If the class of @a node has no pointee, a new one is created. If @a node is
+* @c NoNode, i.e. the pointer is unknown, the escaped node is returned.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getPointee(Node node) {
+	if (node == NoNode) {
+		return escapedNode;
+	}
+
+	Node root = find(node);
+	if (pointees[root] == NoNode) {
+		Node pointee = createNode();
+		pointees[root] = pointee;
+	}
+	return pointees[root];
+}
+
+/**
+* @brief Records that values represented by @a node1 and @a node2 may point
+*        to the same memory.
+*
+* If any of the nodes is @c NoNode, nothing happens.
+*/
+void SteensgaardAliasAnalysis::joinPointees(Node node1, Node node2) {
+	if (node1 == NoNode || node2 == NoNode) {
+		return;
+	}
+	unify(getPointee(node1), getPointee(node2));
+}
+
+/**
+* @brief Merges the values represented by @a node1 and @a node2 and returns
+*        the node representing the result.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::mergeValues(
+		Node node1, Node node2) {
+	if (node1 == NoNode) {
+		return node2;
+	}
+	joinPointees(node1, node2);
+	return node1;
+}
+
+/**
+* @brief Returns the node of @a var (creates it if it does not exist).
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getVarNode(
+		ShPtr<Variable> var) {
+	auto varNodeIter = varNodes.find(var);
+	if (varNodeIter != varNodes.end()) {
+		return varNodeIter->second;
+	}
+
+	Node node = createNode();
+	varNodes.emplace(var, node);
+	resultsChanged = true;
+	if (hasItem(globalVars, var)) {
+		// Global variables are accessible from outside of the module.
+		joinPointees(node, escapedNode);
+	}
+	return node;
+}
+
+/**
+* @brief Returns the node of values returned from @a func (creates it if it
+*        does not exist).
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getRetNode(
+		ShPtr<Function> func) {
+	auto retNodeIter = retNodes.find(func);
+	if (retNodeIter != retNodes.end()) {
+		return retNodeIter->second;
+	}
+
+	Node node = createNode();
+	retNodes.emplace(func, node);
+	return node;
+}
+
+/**
+* @brief Returns the node representing the value of @a expr.
+*
+* If the value of @a expr cannot point to any variable, @c NoNode is
+* returned.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getValueNode(
+		ShPtr<Expression> expr) {
+	lastNode = NoNode;
+	expr->accept(this);
+	return lastNode;
+}
+
+/**
+* @brief Returns the node representing the memory designated by @a expr.
+*
+* The elements of an array and the members of a structure are represented by
+* the node of the whole array or structure.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::getLocationNode(
+		ShPtr<Expression> expr) {
+	if (ShPtr<Variable> var = cast<Variable>(expr)) {
+		return getVarNode(var);
+	} else if (ShPtr<DerefOpExpr> derefOpExpr = cast<DerefOpExpr>(expr)) {
+		return getPointee(getValueNode(derefOpExpr->getOperand()));
+	} else if (ShPtr<ArrayIndexOpExpr> arrayIndexOpExpr =
+			cast<ArrayIndexOpExpr>(expr)) {
+		getValueNode(arrayIndexOpExpr->getIndex());
+		ShPtr<Expression> base(arrayIndexOpExpr->getBase());
+		if (isa<ArrayType>(base->getType())) {
+			return getLocationNode(base);
+		}
+		Node baseNode = getValueNode(base);
+		makePointeeInexact(baseNode);
+		return getPointee(baseNode);
+	} else if (ShPtr<StructIndexOpExpr> structIndexOpExpr =
+			cast<StructIndexOpExpr>(expr)) {
+		ShPtr<Expression> structExpr(structIndexOpExpr->getFirstOperand());
+		Node structNode = getLocationNode(structExpr);
+		if (!isa<Variable>(structExpr)) {
+			// A member of a structure accessed through a pointer.
+			makeInexact(structNode);
+		}
+		return structNode;
+	}
+	return getValueNode(expr);
+}
+
+/**
+* @brief Creates a new node whose pointee is @a node.
+*/
+SteensgaardAliasAnalysis::Node SteensgaardAliasAnalysis::createNodePointingTo(
+		Node node) {
+	Node pointer = createNode();
+	pointees[pointer] = node;
+	return pointer;
+}
+
+/**
+* @brief Records that the address of the variable designated by @a expr is
+*        taken (if there is such a variable).
+*/
+void SteensgaardAliasAnalysis::addAddressedVar(ShPtr<Expression> expr) {
+	// Taking the address of an element of an array or of a member of a
+	// structure makes the whole variable addressed.
+	bool partOfVar = false;
+	while (true) {
+		if (ShPtr<StructIndexOpExpr> structIndexOpExpr =
+				cast<StructIndexOpExpr>(expr)) {
+			expr = structIndexOpExpr->getFirstOperand();
+			partOfVar = true;
+		} else if (ShPtr<ArrayIndexOpExpr> arrayIndexOpExpr =
+				cast<ArrayIndexOpExpr>(expr)) {
+			if (!isa<ArrayType>(arrayIndexOpExpr->getBase()->getType())) {
+				return;
+			}
+			expr = arrayIndexOpExpr->getBase();
+			partOfVar = true;
+		} else {
+			break;
+		}
+	}
+
+	if (ShPtr<Variable> var = cast<Variable>(expr)) {
+		if (allAddressedVars.insert(var).second) {
+			resultsChanged = true;
+		}
+		if (partOfVar) {
+			makeInexact(getVarNode(var));
+		}
+	}
+}
+
+/**
+* @brief Records that the class of @a node represents memory that is not a
+*        single whole variable.
+*/
+void SteensgaardAliasAnalysis::makeInexact(Node node) {
+	Node root = find(node);
+	if (!inexact[root]) {
+		inexact[root] = true;
+		resultsChanged = true;
+	}
+}
+
+/**
+* @brief Records that the value represented by @a node may point into the
+*        middle of the memory to which it points, e.g. after adding an offset
+*        to it.
+*
+* If @a node is @c NoNode, nothing happens.
+*/
+void SteensgaardAliasAnalysis::makePointeeInexact(Node node) {
+	if (node != NoNode) {
+		makeInexact(getPointee(node));
+	}
+}
+
+/**
+* @brief Returns the function named by @a var.
+*
+* If @a var is a local or global variable, the null pointer is returned.
+*/
+ShPtr<Function> SteensgaardAliasAnalysis::getFuncForVar(
+		ShPtr<Variable> var) const {
+	if ((func && func->hasLocalVar(var, true)) || hasItem(globalVars, var)) {
+		return ShPtr<Function>();
+	}
+
+	auto funcIter = funcsByName.find(var->getName());
+	return funcIter != funcsByName.end() ? funcIter->second : ShPtr<Function>();
+}
+
+/**
+* @brief Records that @a func may be called from an unknown place.
+*/
+void SteensgaardAliasAnalysis::makeFuncEscape(ShPtr<Function> func) {
+	addressTakenFuncs.insert(func);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<AssignStmt> stmt) {
+	lastStmt = stmt;
+	Node lhsNode = getLocationNode(stmt->getLhs());
+	joinPointees(lhsNode, getValueNode(stmt->getRhs()));
+	if (visitSuccessors && stmt->hasSuccessor()) {
+		visitStmt(stmt->getSuccessor());
+	}
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<VarDefStmt> stmt) {
+	lastStmt = stmt;
+	Node varNode = getVarNode(stmt->getVar());
+	if (ShPtr<Expression> init = stmt->getInitializer()) {
+		joinPointees(varNode, getValueNode(init));
+	}
+	if (visitSuccessors && stmt->hasSuccessor()) {
+		visitStmt(stmt->getSuccessor());
+	}
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ReturnStmt> stmt) {
+	lastStmt = stmt;
+	if (ShPtr<Expression> retVal = stmt->getRetVal()) {
+		joinPointees(getRetNode(func), getValueNode(retVal));
+	}
+	if (visitSuccessors && stmt->hasSuccessor()) {
+		visitStmt(stmt->getSuccessor());
+	}
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ForLoopStmt> stmt) {
+	lastStmt = stmt;
+	Node indVarNode = getVarNode(stmt->getIndVar());
+	joinPointees(indVarNode, getValueNode(stmt->getStartValue()));
+	getValueNode(stmt->getEndCond());
+	getValueNode(stmt->getStep());
+	if (visitNestedStmts) {
+		visitStmt(stmt->getBody());
+	}
+	if (visitSuccessors && stmt->hasSuccessor()) {
+		visitStmt(stmt->getSuccessor());
+	}
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<AddOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<AddressOpExpr> expr) {
+	ShPtr<Expression> operand(expr->getOperand());
+	if (ShPtr<Variable> var = cast<Variable>(operand)) {
+		if (ShPtr<Function> calledFunc = getFuncForVar(var)) {
+			makeFuncEscape(calledFunc);
+			lastNode = createNodePointingTo(nonVarMemoryNode);
+			return;
+		}
+	}
+
+	addAddressedVar(operand);
+	lastNode = createNodePointingTo(getLocationNode(operand));
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<AndOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ArrayIndexOpExpr> expr) {
+	lastNode = getLocationNode(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<AssignOpExpr> expr) {
+	Node lhsNode = getLocationNode(expr->getFirstOperand());
+	joinPointees(lhsNode, getValueNode(expr->getSecondOperand()));
+	lastNode = lhsNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitAndOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitOrOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitShlOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitShrOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitXorOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<CallExpr> expr) {
+	ShPtr<Function> calledFunc;
+	if (ShPtr<Variable> calledVar = cast<Variable>(expr->getCalledExpr())) {
+		calledFunc = getFuncForVar(calledVar);
+	} else {
+		getValueNode(expr->getCalledExpr());
+	}
+
+	if (calledFunc && calledFunc->isDefinition()) {
+		directlyCalledFuncs.insert(calledFunc);
+		const auto &params = calledFunc->getParams();
+		const auto &args = expr->getArgs();
+		for (std::size_t i = 0, e = args.size(); i < e; ++i) {
+			Node argNode = getValueNode(args[i]);
+			// Variadic arguments are accessed in an unknown way.
+			joinPointees(i < params.size() ? getVarNode(params[i]) :
+				escapedNode, argNode);
+		}
+		lastNode = getRetNode(calledFunc);
+		return;
+	}
+
+	for (const auto &arg : expr->getArgs()) {
+		Node argNode = getValueNode(arg);
+		if (!calledFunc) {
+			// The called function is unknown, so it may be a function from
+			// the module whose parameters escape.
+			joinPointees(escapedNode, argNode);
+		}
+		// Assumption: a declared (external) function does not store pointers
+		// passed to it.
+	}
+	lastNode = escapedNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<CommaOpExpr> expr) {
+	getValueNode(expr->getFirstOperand());
+	lastNode = getValueNode(expr->getSecondOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<DerefOpExpr> expr) {
+	lastNode = getLocationNode(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<DivOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<EqOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<GtEqOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<GtOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<LtEqOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<LtOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ModOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<MulOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<NegOpExpr> expr) {
+	lastNode = getValueNode(expr->getOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<NeqOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<NotOpExpr> expr) {
+	getValueNode(expr->getOperand());
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<OrOpExpr> expr) {
+	visitNonPointerOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<StructIndexOpExpr> expr) {
+	lastNode = getLocationNode(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<SubOpExpr> expr) {
+	visitArithmOpExpr(expr);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<TernaryOpExpr> expr) {
+	getValueNode(expr->getCondition());
+	Node trueValueNode = getValueNode(expr->getTrueValue());
+	lastNode = mergeValues(trueValueNode, getValueNode(expr->getFalseValue()));
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<Variable> var) {
+	if (ShPtr<Function> calledFunc = getFuncForVar(var)) {
+		// A function used as a value may be called by a pointer.
+		makeFuncEscape(calledFunc);
+		lastNode = createNodePointingTo(nonVarMemoryNode);
+	} else if (isa<ArrayType>(var->getType())) {
+		// An array used as a value decays into a pointer to its first element.
+		addAddressedVar(var);
+		makeInexact(getVarNode(var));
+		lastNode = createNodePointingTo(getVarNode(var));
+	} else {
+		lastNode = getVarNode(var);
+	}
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<BitCastExpr> expr) {
+	lastNode = getValueNode(expr->getOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ExtCastExpr> expr) {
+	lastNode = getValueNode(expr->getOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<FPToIntCastExpr> expr) {
+	getValueNode(expr->getOperand());
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<IntToFPCastExpr> expr) {
+	getValueNode(expr->getOperand());
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<IntToPtrCastExpr> expr) {
+	Node operandNode = getValueNode(expr->getOperand());
+	// An integer that has not been obtained from a pointer (e.g. a constant
+	// address) may point anywhere.
+	lastNode = operandNode != NoNode ? operandNode : escapedNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<PtrToIntCastExpr> expr) {
+	lastNode = getValueNode(expr->getOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<TruncCastExpr> expr) {
+	lastNode = getValueNode(expr->getOperand());
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstArray> constant) {
+	Node node = NoNode;
+	if (constant->isInitialized()) {
+		for (const auto &item : constant->getInitializedValue()) {
+			node = mergeValues(node, getValueNode(item));
+		}
+	}
+	lastNode = node;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstBool> constant) {
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstFloat> constant) {
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstInt> constant) {
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstNullPointer> constant) {
+	lastNode = NoNode;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstString> constant) {
+	lastNode = createNodePointingTo(nonVarMemoryNode);
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstStruct> constant) {
+	Node node = NoNode;
+	for (const auto &item : constant->getValue()) {
+		node = mergeValues(node, getValueNode(item.second));
+	}
+	lastNode = node;
+}
+
+void SteensgaardAliasAnalysis::visit(ShPtr<ConstSymbol> constant) {
+	lastNode = getValueNode(constant->getValue());
+}
+
+/**
+* @brief Visits an operator whose result may be derived from a pointer.
+*/
+void SteensgaardAliasAnalysis::visitArithmOpExpr(ShPtr<BinaryOpExpr> expr) {
+	Node firstOperandNode = getValueNode(expr->getFirstOperand());
+	lastNode = mergeValues(firstOperandNode,
+		getValueNode(expr->getSecondOperand()));
+	makePointeeInexact(lastNode);
+}
+
+/**
+* @brief Visits an operator whose result never points to any variable.
+*/
+void SteensgaardAliasAnalysis::visitNonPointerOpExpr(ShPtr<BinaryOpExpr> expr) {
+	getValueNode(expr->getFirstOperand());
+	getValueNode(expr->getSecondOperand());
+	lastNode = NoNode;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
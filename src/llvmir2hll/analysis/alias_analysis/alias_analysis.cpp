@@ -38,5 +38,16 @@ bool AliasAnalysis::isInitialized() const {
 	return module != nullptr;
 }
 
+/**
+* @brief Returns @c true if the last call to init() may have changed the
+*        results of the analysis, @c false otherwise.
+*
+* Users caching the results (like ValueAnalysis) may keep them when this
+* function returns @c false. By default, @c true is returned.
+*/
+bool AliasAnalysis::resultsChangedByLastInit() const {
+	return true;
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -90,7 +90,8 @@ namespace llvmir2hll {
 ValueData::ValueData(): dirReadVars(), dirWrittenVars(), dirAllVars(),
 	dirNumOfVarUses(), mayBeReadVars(), mayBeWrittenVars(),
 	mayBeAccessedVars(), mustBeReadVars(), mustBeWrittenVars(),
-	mustBeAccessedVars(), calls(), addressTakenVars(), containsDerefs(false),
+	mustBeAccessedVars(), calls(), addressTakenVars(), surelyWrittenVarBits(),
+	writtenVarBits(), varBitsNumbering(0), containsDerefs(false),
 	containsArrayAccesses(false), containsStructAccesses(false) {}
 
 /**
@@ -546,6 +547,9 @@ void ValueData::clear() {
 	mustBeAccessedVars.clear();
 	calls.clear();
 	addressTakenVars.clear();
+	surelyWrittenVarBits.clear();
+	writtenVarBits.clear();
+	varBitsNumbering = 0;
 	containsDerefs = false;
 	containsArrayAccesses = false;
 	containsStructAccesses = false;
@@ -560,7 +564,8 @@ ValueAnalysis::ValueAnalysis(ShPtr<AliasAnalysis> aliasAnalysis,
 		bool enableCaching):
 	OrderedAllVisitor(false, false), Caching(enableCaching),
 	aliasAnalysis(aliasAnalysis), valueData(), writing(false),
-	removingFromCache(false) {}
+	removingFromCache(false), varIndexesFunc(nullptr), varIndexes(),
+	varNumbering(1) {}
 
 /**
 * @brief Returns information about the given value.
@@ -601,6 +606,7 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 */
 void ValueAnalysis::clearCache() {
 	Caching::clearCache();
+	restartVarNumbering();
 	validateState();
 }
 
@@ -635,9 +641,21 @@ void ValueAnalysis::removeFromCache(ShPtr<Value> value, bool recursive) {
 *
 * This function is a delegation to AliasAnalysis::init(). See it for more
 * information.
+*
+* If the results of the alias analysis have changed, the cached information
+* about values that depends on them is removed from the cache. The rest of the
+* cache is kept.
 */
 void ValueAnalysis::initAliasAnalysis(ShPtr<Module> module) {
 	aliasAnalysis->init(module);
+
+	// Only the indirectly used variables depend on the alias analysis, and
+	// they are computed solely for values containing dereferences.
+	if (isCachingEnabled() && aliasAnalysis->resultsChangedByLastInit()) {
+		removeFromCacheIf([](const ShPtr<ValueData> &data) {
+			return data->hasDerefs();
+		});
+	}
 }
 
 /**
@@ -671,6 +689,130 @@ bool ValueAnalysis::mayBePointed(ShPtr<Variable> var) const {
 	return aliasAnalysis->mayBePointed(var);
 }
 
+/**
+* @brief Returns the dense representation of the given set of variables of
+*        @a func.
+*
+* The result can be checked against the sets returned by getWrittenVarBits()
+* and getSurelyWrittenVarBits() for values from @a func. It is valid until
+* variables of another function are numbered or the cache is cleared.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+VarBitSet ValueAnalysis::getVarBitSet(const VarSet &vars,
+		ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+
+	numberVarsOf(func);
+	VarBitSet result;
+	for (const auto &var : vars) {
+		result.insert(getVarIndex(var.get()));
+	}
+	return result;
+}
+
+/**
+* @brief Returns indexes of all variables that are directly written, may be
+*        written, or must be written into in the value described by @a data.
+*
+* @param[in] data Information about a value from @a func.
+* @param[in] func Function in which the value is.
+*
+* The indexes are computed when they are first needed and then kept in @a data
+* while the numbering of variables stays the same.
+*
+* @par Preconditions
+*  - @a data and @a func are non-null
+*/
+const VarBitSet &ValueAnalysis::getWrittenVarBits(ShPtr<ValueData> data,
+		ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(data);
+	PRECONDITION_NON_NULL(func);
+
+	numberVarsOf(func);
+	computeVarBits(data);
+	return data->writtenVarBits;
+}
+
+/**
+* @brief Returns indexes of all variables that are directly written or must be
+*        written into in the value described by @a data.
+*
+* See getWrittenVarBits() for more details.
+*
+* @par Preconditions
+*  - @a data and @a func are non-null
+*/
+const VarBitSet &ValueAnalysis::getSurelyWrittenVarBits(ShPtr<ValueData> data,
+		ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(data);
+	PRECONDITION_NON_NULL(func);
+
+	numberVarsOf(func);
+	computeVarBits(data);
+	return data->surelyWrittenVarBits;
+}
+
+/**
+* @brief Makes variables of @a func the currently numbered ones.
+*
+* If variables of another function have been numbered so far, the numbering is
+* restarted, so indexes of a function stay dense.
+*/
+void ValueAnalysis::numberVarsOf(ShPtr<Function> func) {
+	if (func.get() != varIndexesFunc) {
+		restartVarNumbering();
+		varIndexesFunc = func.get();
+	}
+}
+
+/**
+* @brief Forgets the current numbering of variables.
+*/
+void ValueAnalysis::restartVarNumbering() {
+	varIndexesFunc = nullptr;
+	varIndexes.clear();
+	++varNumbering;
+}
+
+/**
+* @brief Returns the dense index of the given variable in the current
+*        numbering.
+*
+* Variables are numbered from zero in the order in which they are first seen.
+* Variables are identified by their addresses. When a variable is destroyed
+* and another one gets its address, the new one gets the old index. This is
+* harmless because all indexes of the destroyed variable are kept in data that
+* refer to it (and thus keep it alive).
+*/
+std::size_t ValueAnalysis::getVarIndex(const Variable *var) {
+	return varIndexes.emplace(var, varIndexes.size()).first->second;
+}
+
+/**
+* @brief Computes indexes of written-into variables in @a data unless they are
+*        already valid for the current numbering.
+*/
+void ValueAnalysis::computeVarBits(ShPtr<ValueData> data) {
+	if (data->varBitsNumbering == varNumbering) {
+		return;
+	}
+
+	data->surelyWrittenVarBits.clear();
+	for (const auto &var : data->dirWrittenVars) {
+		data->surelyWrittenVarBits.insert(getVarIndex(var.get()));
+	}
+	for (const auto &var : data->mustBeWrittenVars) {
+		data->surelyWrittenVarBits.insert(getVarIndex(var.get()));
+	}
+	data->writtenVarBits = data->surelyWrittenVarBits;
+	for (const auto &var : data->mayBeWrittenVars) {
+		data->writtenVarBits.insert(getVarIndex(var.get()));
+	}
+	data->varBitsNumbering = varNumbering;
+}
+
 /**
 * @brief Creates a new analysis.
 *
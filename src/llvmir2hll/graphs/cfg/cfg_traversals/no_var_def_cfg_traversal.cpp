@@ -11,7 +11,6 @@
 #include "retdec/utils/container.h"
 
 using retdec::utils::hasItem;
-using retdec::utils::shareSomeItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -26,7 +25,9 @@ namespace llvmir2hll {
 */
 NoVarDefCFGTraversal::NoVarDefCFGTraversal(ShPtr<CFG> cfg, const StmtSet &ends,
 		const VarSet &vars, ShPtr<ValueAnalysis> va):
-		CFGTraversal(cfg, true), ends(ends), vars(vars), va(va) {}
+		CFGTraversal(cfg, true), ends(ends), vars(va->getVarBitSet(vars,
+			cfg->getCorrespondingFunction())),
+		va(va) {}
 
 /**
 * @brief Returns @c true if no variable from @a vars is defined between @a start
@@ -73,9 +74,8 @@ bool NoVarDefCFGTraversal::visitStmt(ShPtr<Statement> stmt) {
 
 	// Check that no variable from vars is (or may be) modified in the
 	// statement.
-	if (shareSomeItem(stmtData->getDirWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMayBeWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMustBeWrittenVars(), vars)) {
+	if (va->getWrittenVarBits(stmtData,
+			cfg->getCorrespondingFunction()).intersects(vars)) {
 		currRetVal = false;
 		return false;
 	}
@@ -8,9 +8,6 @@
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/ir/statement.h"
 #include "retdec/llvmir2hll/support/debug.h"
-#include "retdec/utils/container.h"
-
-using retdec::utils::shareSomeItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -25,7 +22,9 @@ namespace llvmir2hll {
 */
 VarDefCFGTraversal::VarDefCFGTraversal(ShPtr<CFG> cfg, const VarSet &vars,
 		ShPtr<Statement> end, ShPtr<ValueAnalysis> va):
-		CFGTraversal(cfg, false), vars(vars), end(end), va(va) {}
+		CFGTraversal(cfg, false), vars(va->getVarBitSet(vars,
+			cfg->getCorrespondingFunction())), end(end),
+		va(va) {}
 
 /**
 * @brief Returns @c true if a variable from @a vars is defined between @a start
@@ -68,8 +67,8 @@ bool VarDefCFGTraversal::visitStmt(ShPtr<Statement> stmt) {
 	// that it doesn't suffice if the variable may be written -- it either has
 	// to be read directly or must be read indirectly.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	if (shareSomeItem(stmtData->getDirWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMustBeWrittenVars(), vars)) {
+	if (va->getSurelyWrittenVarBits(stmtData,
+			cfg->getCorrespondingFunction()).intersects(vars)) {
 		currRetVal = true;
 		return false;
 	}
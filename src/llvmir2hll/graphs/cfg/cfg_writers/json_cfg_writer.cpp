@@ -0,0 +1,131 @@
+/**
+* @file src/llvmir2hll/graphs/cfg/cfg_writers/json_cfg_writer.cpp
+* @brief Implementation of JsonCFGWriter.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <cstddef>
+#include <unordered_map>
+
+#include <rapidjson/encodings.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer_factory.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writers/json_cfg_writer.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/statement.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+REGISTER_AT_FACTORY("json", JSON_CFG_WRITER_ID, CFGWriterFactory,
+	JsonCFGWriter::create);
+
+namespace {
+
+/// Writer of the JSON output.
+using Writer = rapidjson::Writer<rapidjson::StringBuffer, rapidjson::ASCII<>>;
+
+/// Mapping of a node into its index.
+using NodeIndexMap = std::unordered_map<ShPtr<CFG::Node>, std::size_t>;
+
+/**
+* @brief Writes the index of @a node under the given key.
+*
+* If @a node is not in @a nodeIndexes, nothing is written.
+*/
+void writeNodeIndex(Writer &writer, const char *key, ShPtr<CFG::Node> node,
+		const NodeIndexMap &nodeIndexes) {
+	auto i = nodeIndexes.find(node);
+	if (i == nodeIndexes.end()) {
+		return;
+	}
+
+	writer.Key(key);
+	writer.Uint64(i->second);
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new JSON CFG writer.
+*
+* See create() for the description of parameters.
+*/
+JsonCFGWriter::JsonCFGWriter(ShPtr<CFG> cfg, std::ostream &out):
+	CFGWriter(cfg, out) {}
+
+/**
+* @brief Creates a new JSON CFG writer.
+*
+* @param[in] cfg CFG to be emitted.
+* @param[in] out Output stream into which the CFG will be emitted.
+*/
+ShPtr<CFGWriter> JsonCFGWriter::create(ShPtr<CFG> cfg, std::ostream &out) {
+	return ShPtr<CFGWriter>(new JsonCFGWriter(cfg, out));
+}
+
+std::string JsonCFGWriter::getId() const {
+	return JSON_CFG_WRITER_ID;
+}
+
+bool JsonCFGWriter::emitCFG() {
+	NodeIndexMap nodeIndexes;
+	for (auto i = cfg->node_begin(), e = cfg->node_end(); i != e; ++i) {
+		nodeIndexes.emplace(*i, nodeIndexes.size());
+	}
+
+	rapidjson::StringBuffer sb;
+	Writer writer(sb);
+	writer.StartObject();
+
+	writer.Key("function");
+	writer.String(cfg->getCorrespondingFunction()->getName());
+	writeNodeIndex(writer, "entry", cfg->getEntryNode(), nodeIndexes);
+	writeNodeIndex(writer, "exit", cfg->getExitNode(), nodeIndexes);
+
+	writer.Key("nodes");
+	writer.StartArray();
+	for (auto i = cfg->node_begin(), e = cfg->node_end(); i != e; ++i) {
+		writer.StartObject();
+		auto label = (*i)->getLabel();
+		if (!label.empty()) {
+			writer.Key("label");
+			writer.String(label);
+		}
+		writer.Key("stmts");
+		writer.StartArray();
+		for (auto j = (*i)->stmt_begin(), f = (*i)->stmt_end(); j != f; ++j) {
+			writer.String((*j)->getTextRepr());
+		}
+		writer.EndArray();
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	writer.Key("edges");
+	writer.StartArray();
+	for (auto i = cfg->node_begin(), e = cfg->node_end(); i != e; ++i) {
+		for (auto j = (*i)->succ_begin(), f = (*i)->succ_end(); j != f; ++j) {
+			writer.StartObject();
+			writeNodeIndex(writer, "src", (*j)->getSrc(), nodeIndexes);
+			writeNodeIndex(writer, "dst", (*j)->getDst(), nodeIndexes);
+			if (auto cond = (*j)->getLabel()) {
+				writer.Key("cond");
+				writer.String(cond->getTextRepr());
+			}
+			writer.EndObject();
+		}
+	}
+	writer.EndArray();
+
+	writer.EndObject();
+	out.write(sb.GetString(), sb.GetSize());
+	return true;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -152,6 +152,8 @@ HLLWriter::HLLWriter(llvm::raw_ostream &o, const std::string& outputFormat):
 		out = UPtr<OutputManager>(new JsonOutputManagerPlain(o));
 	} else if (outputFormat == "json-human") {
 		out = UPtr<OutputManager>(new JsonOutputManagerPretty(o));
+	} else if (outputFormat == "json-lines") {
+		out = UPtr<OutputManager>(new JsonOutputManagerPlain(o, true));
 	} else {
 		out = UPtr<OutputManager>(new PlainOutputManager(o));
 	}
@@ -218,6 +220,12 @@ void HLLWriter::setOptionUseCompoundOperators(bool use) {
 * Each block is separated by a blank line. A subclass of this class can just
 * override the appropriate emit*() functions. To change the order of blocks,
 * override this function.
+*
+* The declarations (everything before the functions) and each function are
+* ended by OutputManager::flush(), which splits the output into records in the
+* @c json-lines format. The module has to be fully converted, optimized, and
+* renamed before calling this function; no part of it is released during the
+* emission.
 */
 bool HLLWriter::emitTargetCode(ShPtr<Module> module) {
 	this->module = module;
@@ -256,6 +264,10 @@ bool HLLWriter::emitTargetCode(ShPtr<Module> module) {
 	if (emitGlobalVariablesHeader()) { codeEmitted = true; out->newLine(); }
 	if (emitGlobalVariables()) { codeEmitted = true; out->newLine(); }
 
+	// Everything that functions may refer to has been emitted, so the
+	// declarations form a self-contained part of the output.
+	out->flush();
+
 	//
 	// Functions
 	//
@@ -314,7 +326,7 @@ void HLLWriter::decreaseIndentLevel() {
 /**
 * @brief Returns the current indentation (to indent the current block).
 */
-std::string HLLWriter::getCurrentIndent() const {
+const std::string &HLLWriter::getCurrentIndent() const {
 	return currentIndent;
 }
 
@@ -325,7 +337,7 @@ std::string HLLWriter::getCurrentIndent() const {
 * decreaseIndentLevel() to increase and decrease the current indentation,
 * respectively.
 */
-std::string HLLWriter::getSingleLevelIndent() const {
+const std::string &HLLWriter::getSingleLevelIndent() const {
 	return LEVEL_INDENT;
 }
 
@@ -519,6 +531,8 @@ bool HLLWriter::emitFunctions() {
 			out->newLine();
 		}
 		somethingEmitted |= emitFunction(func);
+		// Each function is a self-contained part of the output.
+		out->flush();
 	}
 	return somethingEmitted;
 }
@@ -8,6 +8,8 @@
 #include <set>
 #include <sstream>
 
+#include <llvm/ADT/StringRef.h>
+
 #include "retdec/llvmir2hll/analysis/indirect_func_ref_analysis.h"
 #include "retdec/llvmir2hll/analysis/null_pointer_analysis.h"
 #include "retdec/llvmir2hll/analysis/special_fp_analysis.h"
@@ -230,6 +232,41 @@ bool hasOnlyUninitializedConstArrayInits(ShPtr<ConstStruct> constant) {
 	return true;
 }
 
+/**
+* @brief Returns the name of the C fixed-width integer type with the given
+*        size and signedness.
+*
+* Names of the commonly used types are returned without creating a new
+* string. The other names are stored into @a buffer.
+*/
+llvm::StringRef getIntTypeName(unsigned size, bool isUnsigned,
+		std::string &buffer) {
+	switch (size) {
+		case 16: return isUnsigned ? "uint16_t" : "int16_t";
+		case 32: return isUnsigned ? "uint32_t" : "int32_t";
+		case 64: return isUnsigned ? "uint64_t" : "int64_t";
+		default:
+			buffer = (isUnsigned ? "uint" : "int") + std::to_string(size) + "_t";
+			return buffer;
+	}
+}
+
+/**
+* @brief Returns the name of the floating-point type with the given size.
+*
+* See getIntTypeName() for the description of @a buffer.
+*/
+llvm::StringRef getFloatTypeName(unsigned size, std::string &buffer) {
+	switch (size) {
+		case 32: return "float32_t";
+		case 64: return "float64_t";
+		case 80: return "float80_t";
+		default:
+			buffer = "float" + std::to_string(size) + "_t";
+			return buffer;
+	}
+}
+
 } // anonymous namespace
 
 /**
@@ -1135,7 +1172,8 @@ void CHLLWriter::visit(ShPtr<UnreachableStmt> stmt) {
 }
 
 void CHLLWriter::visit(ShPtr<FloatType> type) {
-	out->dataType("float" + std::to_string(type->getSize()) + "_t");
+	std::string buffer;
+	out->dataType(getFloatTypeName(type->getSize(), buffer));
 }
 
 void CHLLWriter::visit(ShPtr<IntType> type) {
@@ -1153,8 +1191,8 @@ void CHLLWriter::visit(ShPtr<IntType> type) {
 		return;
 	}
 
-	out->dataType((type->isUnsigned() ? std::string("u") : std::string("")) + "int"
-		+ std::to_string(type->getSize()) + "_t");
+	std::string buffer;
+	out->dataType(getIntTypeName(type->getSize(), type->isUnsigned(), buffer));
 }
 
 void CHLLWriter::visit(ShPtr<PointerType> type) {
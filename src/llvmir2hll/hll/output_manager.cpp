@@ -19,6 +19,11 @@ void OutputManager::finalize()
 
 }
 
+void OutputManager::flush()
+{
+
+}
+
 void OutputManager::setCommentPrefix(const std::string& prefix)
 {
 	_commentPrefix = prefix;
@@ -40,7 +45,7 @@ const std::string& OutputManager::getOutputLanguage() const
 }
 
 void OutputManager::operatorX(
-	const std::string& op,
+	llvm::StringRef op,
 	bool spaceBefore,
 	bool spaceAfter)
 {
@@ -56,8 +61,8 @@ void OutputManager::operatorX(
 }
 
 void OutputManager::comment(
-	const std::string& c,
-	const std::string& indent)
+	llvm::StringRef c,
+	llvm::StringRef indent)
 {
 	if (!indent.empty())
 	{
@@ -67,17 +72,17 @@ void OutputManager::comment(
 }
 
 void OutputManager::commentLine(
-	const std::string& c,
-	const std::string& indent)
+	llvm::StringRef c,
+	llvm::StringRef indent)
 {
 	comment(c, indent);
 	newLine();
 }
 
 void OutputManager::includeLine(
-	const std::string& header,
-	const std::string& indent,
-	const std::string& c)
+	llvm::StringRef header,
+	llvm::StringRef indent,
+	llvm::StringRef c)
 {
 	if (!indent.empty())
 	{
@@ -91,9 +96,9 @@ void OutputManager::includeLine(
 }
 
 void OutputManager::typedefLine(
-	const std::string& indent,
-	const std::string& t1,
-	const std::string& t2)
+	llvm::StringRef indent,
+	llvm::StringRef t1,
+	llvm::StringRef t2)
 {
 	if (!indent.empty())
 	{
@@ -4,8 +4,9 @@
 * @copyright (c) 2019 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/llvmir2hll/hll/output_managers/json_manager.h"
-#include "retdec/utils/string.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -43,34 +44,114 @@ const std::string JSON_TOKEN_COMMENT       = "cmnt";
 /**
  * We don't like macros, but we potentially need to return from methods calling
  * this helper routine, so we use it here anyway.
- * \param val Anything that can be concatenated (+) to a std::string.
+ * \param val Anything that can be appended by appendToComment().
  */
 #define HANDLE_COMMENT_MODIFIER(val)                 \
 {                                                    \
 	if (_commentModifierOn)                          \
 	{                                                \
-		_runningComment += val;                      \
+		appendToComment(_runningComment, val);       \
 		return;                                      \
 	}                                                \
 }
 
+void appendToComment(std::string& comment, llvm::StringRef val)
+{
+	comment.append(val.data(), val.size());
+}
+
+void appendToComment(std::string& comment, char val)
+{
+	comment += val;
+}
+
 } // anonymous namespace
 
 template <typename Writer>
-JsonOutputManager<Writer>::JsonOutputManager(llvm::raw_ostream& out) :
+JsonOutputManager<Writer>::JsonOutputManager(
+		llvm::raw_ostream& out,
+		bool lines) :
 		_out(out),
+		_lines(lines),
 		writer(sb)
+{
+	startRecord();
+
+	addressPush(Address::Undefined);
+}
+
+template <typename Writer>
+void JsonOutputManager<Writer>::finalize()
+{
+	// In the lines mode, do not generate an object without tokens, unless it
+	// is the only one.
+	if (_lines && _recordEmpty && _recordsWritten > 0)
+	{
+		_out.flush();
+		return;
+	}
+
+	endRecord();
+
+	writeBuffer();
+	if (_lines)
+	{
+		_out << "\n";
+	}
+	_out.flush();
+}
+
+/**
+ * Writes out everything generated so far. In the lines mode, the current
+ * JSON object is ended, and the subsequent tokens are generated into a new
+ * one.
+ */
+template <typename Writer>
+void JsonOutputManager<Writer>::flush()
+{
+	if (_lines)
+	{
+		if (_recordEmpty)
+		{
+			return;
+		}
+
+		endRecord();
+		writeBuffer();
+		_out << "\n";
+		writer.Reset(sb);
+		++_recordsWritten;
+
+		startRecord();
+		// Associate the next tokens with the current address.
+		if (!_addrs.empty())
+		{
+			_addrToGenerate = std::make_pair(_addrs.top().first, true);
+		}
+	}
+	else
+	{
+		// The writer only appends to the buffer, so its content can be
+		// written out right away.
+		writeBuffer();
+	}
+
+	_out.flush();
+}
+
+template <typename Writer>
+void JsonOutputManager<Writer>::startRecord()
 {
 	writer.StartObject();
 
 	writer.String(JSON_KEY_TOKENS);
 	writer.StartArray();
 
-	addressPush(Address::Undefined);
+	_recordEmpty = true;
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::finalize()
+void JsonOutputManager<Writer>::endRecord()
 {
 	writer.EndArray();
 
@@ -78,8 +159,17 @@ void JsonOutputManager<Writer>::finalize()
 	writer.String(getOutputLanguage());
 
 	writer.EndObject();
+}
 
-	_out << sb.GetString();
+/**
+ * Writes the content of the JSON buffer into the output stream and clears the
+ * buffer, whose memory is reused for the subsequent tokens.
+ */
+template <typename Writer>
+void JsonOutputManager<Writer>::writeBuffer()
+{
+	_out.write(sb.GetString(), sb.GetSize());
+	sb.Clear();
 }
 
 template <typename Writer>
@@ -101,7 +191,7 @@ void JsonOutputManager<Writer>::newLine()
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::space(const std::string& space)
+void JsonOutputManager<Writer>::space(llvm::StringRef space)
 {
 	HANDLE_COMMENT_MODIFIER(space);
 	jsonToken(JSON_TOKEN_SPACE, space);
@@ -111,136 +201,144 @@ template <typename Writer>
 void JsonOutputManager<Writer>::punctuation(char p)
 {
 	HANDLE_COMMENT_MODIFIER(p);
-	jsonToken(JSON_TOKEN_PUNCTUATION, std::string(1, p));
+	jsonToken(JSON_TOKEN_PUNCTUATION, llvm::StringRef(&p, 1));
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::operatorX(const std::string& op)
+void JsonOutputManager<Writer>::operatorX(llvm::StringRef op)
 {
 	HANDLE_COMMENT_MODIFIER(op);
 	jsonToken(JSON_TOKEN_OPERATOR, op);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::globalVariableId(const std::string& id)
+void JsonOutputManager<Writer>::globalVariableId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_GVAR, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::localVariableId(const std::string& id)
+void JsonOutputManager<Writer>::localVariableId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_LVAR, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::memberId(const std::string& id)
+void JsonOutputManager<Writer>::memberId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_MEMBER, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::labelId(const std::string& id)
+void JsonOutputManager<Writer>::labelId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_LABEL, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::functionId(const std::string& id)
+void JsonOutputManager<Writer>::functionId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_FUNCTION, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::parameterId(const std::string& id)
+void JsonOutputManager<Writer>::parameterId(llvm::StringRef id)
 {
 	HANDLE_COMMENT_MODIFIER(id);
 	jsonToken(JSON_TOKEN_ID_PARAMETER, id);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::keyword(const std::string& k)
+void JsonOutputManager<Writer>::keyword(llvm::StringRef k)
 {
 	HANDLE_COMMENT_MODIFIER(k);
 	jsonToken(JSON_TOKEN_KEYWORD, k);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::dataType(const std::string& t)
+void JsonOutputManager<Writer>::dataType(llvm::StringRef t)
 {
 	HANDLE_COMMENT_MODIFIER(t);
 	jsonToken(JSON_TOKEN_DATA_TYPE, t);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::preprocessor(const std::string& p)
+void JsonOutputManager<Writer>::preprocessor(llvm::StringRef p)
 {
 	HANDLE_COMMENT_MODIFIER(p);
 	jsonToken(JSON_TOKEN_PREPROCESSOR, p);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::include(const std::string& i)
+void JsonOutputManager<Writer>::include(llvm::StringRef i)
 {
 	HANDLE_COMMENT_MODIFIER(i);
-	jsonToken(JSON_TOKEN_INCLUDE, "<" + i + ">");
+	jsonToken(JSON_TOKEN_INCLUDE, "<" + i.str() + ">");
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantBool(const std::string& c)
+void JsonOutputManager<Writer>::constantBool(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_BOOL, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantInt(const std::string& c)
+void JsonOutputManager<Writer>::constantInt(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_INT, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantFloat(const std::string& c)
+void JsonOutputManager<Writer>::constantFloat(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_FLOAT, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantString(const std::string& c)
+void JsonOutputManager<Writer>::constantString(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_STRING, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantSymbol(const std::string& c)
+void JsonOutputManager<Writer>::constantSymbol(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_SYMBOL, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::constantPointer(const std::string& c)
+void JsonOutputManager<Writer>::constantPointer(llvm::StringRef c)
 {
 	HANDLE_COMMENT_MODIFIER(c);
 	jsonToken(JSON_TOKEN_CONST_POINTER, c);
 }
 
 template <typename Writer>
-void JsonOutputManager<Writer>::comment(const std::string& c)
+void JsonOutputManager<Writer>::comment(llvm::StringRef c)
 {
-	HANDLE_COMMENT_MODIFIER(" " + c);
+	if (_commentModifierOn)
+	{
+		_runningComment += ' ';
+		appendToComment(_runningComment, c);
+		return;
+	}
+
 	std::string str = getCommentPrefix();
 	if (!c.empty())
 	{
-		str += " " + utils::replaceCharsWithStrings(c, '\n', " ");
+		str += ' ';
+		str.append(c.data(), c.size());
+		std::replace(str.end() - c.size(), str.end(), '\n', ' ');
 	}
 	jsonToken(JSON_TOKEN_COMMENT, str);
 }
@@ -324,8 +422,8 @@ void JsonOutputManager<Writer>::generateAddressEntry(Address a)
 
 template <typename Writer>
 void JsonOutputManager<Writer>::jsonToken(
-		const std::string& k,
-		const std::string& v)
+		llvm::StringRef k,
+		llvm::StringRef v)
 {
 	if (_addrToGenerate.second)
 	{
@@ -336,12 +434,14 @@ void JsonOutputManager<Writer>::jsonToken(
 	writer.StartObject();
 
 	writer.String(JSON_KEY_KIND);
-	writer.String(k);
+	writer.String(k.data(), k.size());
 
 	writer.String(JSON_KEY_VALUE);
-	writer.String(v);
+	writer.String(v.data(), v.size());
 
 	writer.EndObject();
+
+	_recordEmpty = false;
 }
 
 template class JsonOutputManager<rapidjson::Writer<rapidjson::StringBuffer, rapidjson::ASCII<>>>;
@@ -5,7 +5,6 @@
 */
 
 #include "retdec/llvmir2hll/hll/output_managers/plain_manager.h"
-#include "retdec/utils/string.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -16,12 +15,17 @@ PlainOutputManager::PlainOutputManager(llvm::raw_ostream& out) :
 
 }
 
+void PlainOutputManager::finalize()
+{
+	_out.flush();
+}
+
 void PlainOutputManager::newLine()
 {
 	_out << "\n";
 }
 
-void PlainOutputManager::space(const std::string& space)
+void PlainOutputManager::space(llvm::StringRef space)
 {
 	_out << space;
 }
@@ -31,98 +35,110 @@ void PlainOutputManager::punctuation(char p)
 	_out << p;
 }
 
-void PlainOutputManager::operatorX(const std::string& op)
+void PlainOutputManager::operatorX(llvm::StringRef op)
 {
 	_out << op;
 }
 
-void PlainOutputManager::globalVariableId(const std::string& id)
+void PlainOutputManager::globalVariableId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::localVariableId(const std::string& id)
+void PlainOutputManager::localVariableId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::memberId(const std::string& id)
+void PlainOutputManager::memberId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::labelId(const std::string& id)
+void PlainOutputManager::labelId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::functionId(const std::string& id)
+void PlainOutputManager::functionId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::parameterId(const std::string& id)
+void PlainOutputManager::parameterId(llvm::StringRef id)
 {
 	_out << id;
 }
 
-void PlainOutputManager::keyword(const std::string& k)
+void PlainOutputManager::keyword(llvm::StringRef k)
 
 {
 	_out << k;
 }
 
-void PlainOutputManager::dataType(const std::string& t)
+void PlainOutputManager::dataType(llvm::StringRef t)
 {
 	_out << t;
 }
 
-void PlainOutputManager::preprocessor(const std::string& p)
+void PlainOutputManager::preprocessor(llvm::StringRef p)
 {
 	_out << p;
 }
 
-void PlainOutputManager::include(const std::string& i)
+void PlainOutputManager::include(llvm::StringRef i)
 {
 	_out << "<" << i << ">";
 }
 
-void PlainOutputManager::constantBool(const std::string& c)
+void PlainOutputManager::constantBool(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::constantInt(const std::string& c)
+void PlainOutputManager::constantInt(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::constantFloat(const std::string& c)
+void PlainOutputManager::constantFloat(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::constantString(const std::string& c)
+void PlainOutputManager::constantString(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::constantSymbol(const std::string& c)
+void PlainOutputManager::constantSymbol(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::constantPointer(const std::string& c)
+void PlainOutputManager::constantPointer(llvm::StringRef c)
 {
 	_out << c;
 }
 
-void PlainOutputManager::comment(const std::string& c)
+void PlainOutputManager::comment(llvm::StringRef c)
 {
 	_out << getCommentPrefix();
 	if (!c.empty())
 	{
-		_out << " " << utils::replaceCharsWithStrings(c, '\n', " ");
+		// Replace newlines with spaces without creating a new string.
+		_out << ' ';
+		for (std::size_t pos = 0; pos < c.size();)
+		{
+			auto nl = c.find('\n', pos);
+			_out << c.slice(pos, nl);
+			if (nl == llvm::StringRef::npos)
+			{
+				break;
+			}
+			_out << ' ';
+			pos = nl + 1;
+		}
 	}
 }
 
@@ -24,6 +24,10 @@ ShPtr<Value> ArrayType::clone() {
 }
 
 bool ArrayType::isEqualTo(ShPtr<Value> otherValue) const {
+	if (otherValue.get() == this) {
+		return true;
+	}
+
 	// Both types and numbers of dimensions have to be equal.
 	if (ShPtr<ArrayType> otherArrayType = cast<ArrayType>(otherValue)) {
 		if ((elemType == otherArrayType->elemType) &&
@@ -32,6 +32,10 @@ ShPtr<Value> FunctionType::clone() {
 }
 
 bool FunctionType::isEqualTo(ShPtr<Value> otherValue) const {
+	if (otherValue.get() == this) {
+		return true;
+	}
+
 	// The types of compared instances have to match.
 	ShPtr<FunctionType> otherType = cast<FunctionType>(otherValue);
 	if (!otherType) {
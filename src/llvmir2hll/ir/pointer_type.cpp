@@ -24,6 +24,10 @@ ShPtr<Value> PointerType::clone() {
 }
 
 bool PointerType::isEqualTo(ShPtr<Value> otherValue) const {
+	if (otherValue.get() == this) {
+		return true;
+	}
+
 	// Both types and contained types have to be equal.
 	if (ShPtr<PointerType> otherPointerType = cast<PointerType>(otherValue)) {
 		return containedType->isEqualTo(otherPointerType->containedType);
@@ -28,6 +28,10 @@ ShPtr<Value> StructType::clone() {
 }
 
 bool StructType::isEqualTo(ShPtr<Value> otherValue) const {
+	if (otherValue.get() == this) {
+		return true;
+	}
+
 	// All types have to be equal.
 	if (ShPtr<StructType> otherStruct = cast<StructType>(otherValue)) {
 		if (elementTypes == otherStruct->elementTypes &&
@@ -28,6 +28,10 @@ ShPtr<Value> Variable::clone() {
 bool Variable::isEqualTo(ShPtr<Value> otherValue) const {
 	// Both types, names, and internal status have to be equal.
 	if (ShPtr<Variable> otherVariable = cast<Variable>(otherValue)) {
+		if (otherVariable.get() == this) {
+			return true;
+		}
+
 		return initialName == otherVariable->initialName &&
 			name == otherVariable->name &&
 			type->isEqualTo(otherVariable->type) &&
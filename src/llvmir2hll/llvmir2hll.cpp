@@ -1,8 +1,12 @@
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include "retdec/llvmir2hll/llvmir2hll.h"
 #include "retdec/utils/io/log.h"
 
@@ -34,10 +38,14 @@ std::string oCFGWriter = "dot";
 std::string oCGWriter = "dot";
 std::string VarNameGenPrefix = "";
 std::string oVarNameGen = "fruit"; // fruit|num|word
-std::string oAliasAnalysis = "simple"; // simple|basic
 std::string FindPatterns = ""; // all TODO: enable?
 std::string oSemantics = "";
 
+// Size of the buffer through which the generated code is written into the
+// output file. It is larger than the default one so that the code is written
+// by fewer system calls.
+const std::size_t OutputBufferSize = 1 << 20;
+
 std::unique_ptr<llvm::ToolOutputFile> getOutputStream(
 		const std::string& outputFile)
 {
@@ -53,6 +61,7 @@ std::unique_ptr<llvm::ToolOutputFile> getOutputStream(
 		Log::error() << ec.message() << '\n';
 		return {};
 	}
+	out->os().SetBufferSize(OutputBufferSize);
 	return out;
 }
 
@@ -299,11 +308,12 @@ bool LlvmIr2Hll::initialize(llvm::Module &m)
 
 	// Instantiate the requested alias analysis and make sure it exists.
 	Log::phase(
-		"creating the used alias analysis [" + oAliasAnalysis + "]",
+		"creating the used alias analysis ["
+		+ globalConfig->parameters.getBackendAliasAnalysis() + "]",
 		Log::SubPhase
 	);
 	aliasAnalysis = llvmir2hll::AliasAnalysisFactory::getInstance().createObject(
-		oAliasAnalysis
+		globalConfig->parameters.getBackendAliasAnalysis()
 	);
 	if (!aliasAnalysis)
 	{
@@ -615,7 +625,7 @@ void LlvmIr2Hll::runOptimizations()
 */
 void LlvmIr2Hll::renameVariables()
 {
-	varRenamer->renameVars(resModule);
+	varRenamer->renameVars(resModule, globalConfig->parameters.getThreads());
 }
 
 /**
@@ -705,6 +715,9 @@ void LlvmIr2Hll::cleanup()
 /**
 * @brief Emits a control-flow graph (CFG) for each function in the resulting
 *        module.
+*
+* In the @c dot format, every CFG is emitted into a separate file. In the
+* @c json-lines format, see emitCFGsIntoSingleFile().
 */
 void LlvmIr2Hll::emitCFGs()
 {
@@ -717,16 +730,28 @@ void LlvmIr2Hll::emitCFGs()
 		return;
 	}
 
+	// In the json-lines format, CFGs of all functions are emitted into a
+	// single file by the JSON writer.
+	bool singleFile =
+		globalConfig->parameters.getBackendCfgFormat() == "json-lines";
+	std::string cfgWriterId(singleFile ? "json" : oCFGWriter);
+
 	// Make sure that the requested CFG writer exists.
 	llvmir2hll::StringVector availCFGWriters(
 		llvmir2hll::CFGWriterFactory::getInstance().getRegisteredObjects());
-	if (!hasItem(availCFGWriters, oCFGWriter))
+	if (!hasItem(availCFGWriters, cfgWriterId))
 	{
 		printErrorUnsupportedObject<llvmir2hll::CFGWriterFactory>(
 			"CFG writer", "CFG writers");
 		return;
 	}
 
+	if (singleFile)
+	{
+		emitCFGsIntoSingleFile(cfgWriterId);
+		return;
+	}
+
 	// Instantiate a CFG builder.
 	ShPtr<llvmir2hll::CFGBuilder> cfgBuilder(
 			llvmir2hll::NonRecursiveCFGBuilder::create()
@@ -774,6 +799,81 @@ void LlvmIr2Hll::emitCFGs()
 	}
 }
 
+/**
+* @brief Emits a control-flow graph (CFG) for each function in the resulting
+*        module into a single file in the JSON Lines format.
+*
+* @param[in] cfgWriterId ID of the used CFG writer (it has to emit every CFG on
+*                        a single line).
+*
+* Every line of the file contains the CFG of a single function. The last line
+* is an index of the form
+* <tt>{"index":[{"function":"name","offset":offset},...]}</tt>, where @c offset
+* is the position of the line with the function's CFG in the file, so the CFG
+* of a particular function can be read without parsing the whole file. CFGs
+* are built and written one at a time, so at most one of them is kept in
+* memory.
+*/
+void LlvmIr2Hll::emitCFGsIntoSingleFile(const std::string &cfgWriterId)
+{
+	std::string fileName(
+			globalConfig->parameters.getOutputFile() + ".cfg.jsonl"
+	);
+	std::ofstream out(fileName.c_str(), std::ios::binary);
+	if (!out)
+	{
+		Log::error() << Log::Error
+			<< "Cannot open " + fileName + " for writing."
+			<< std::endl;
+		return;
+	}
+
+	ShPtr<llvmir2hll::CFGBuilder> cfgBuilder(
+			llvmir2hll::NonRecursiveCFGBuilder::create()
+	);
+	auto& cfgwf = llvmir2hll::CFGWriterFactory::getInstance();
+
+	rapidjson::StringBuffer index;
+	rapidjson::Writer<rapidjson::StringBuffer> indexWriter(index);
+	indexWriter.StartObject();
+	indexWriter.Key("index");
+	indexWriter.StartArray();
+	for (auto i = resModule->func_definition_begin(),
+			e = resModule->func_definition_end();
+			i != e;
+			++i)
+	{
+		auto offset = static_cast<std::uint64_t>(out.tellp());
+
+		ShPtr<llvmir2hll::CFGWriter> writer(
+				cfgwf.createObject<ShPtr<llvmir2hll::CFG>, std::ostream &>(
+						cfgWriterId,
+						cfgBuilder->getCFG(*i),
+						out
+				)
+		);
+		ASSERT_MSG(
+				writer,
+				"instantiation of the requested CFG writer `"
+				<< cfgWriterId << "` failed"
+		);
+		writer->emitCFG();
+		out << '\n';
+
+		indexWriter.StartObject();
+		indexWriter.Key("function");
+		indexWriter.String((*i)->getName());
+		indexWriter.Key("offset");
+		indexWriter.Uint64(offset);
+		indexWriter.EndObject();
+	}
+	indexWriter.EndArray();
+	indexWriter.EndObject();
+
+	out.write(index.GetString(), index.GetSize());
+	out << '\n';
+}
+
 /**
 * @brief Emits a call graph (CG) for the resulting module.
 */
@@ -190,6 +190,16 @@ void OptimCallInfoObtainer::computeAllFuncInfos() {
 	// Obtain the order in which function information should be computed.
 	ShPtr<FuncInfoCompOrder> fico(getFuncInfoCompOrder(cg));
 
+	// SCCs are disjoint, so every function is in at most one of them. Map
+	// functions to their SCCs so we do not have to search through all the
+	// SCCs for every function in the order.
+	std::map<ShPtr<Function>, const FuncSet *> funcSCCMap;
+	for (const auto &scc : fico->sccs) {
+		for (const auto &func : scc) {
+			funcSCCMap[func] = &scc;
+		}
+	}
+
 	// Compute the information from the obtained order.
 	for (const auto &func : fico->order) {
 		// Based on the description of CallInfoObtainer::FuncInfoOrder, we
@@ -197,11 +207,9 @@ void OptimCallInfoObtainer::computeAllFuncInfos() {
 		// SCC that contains it.
 		computeFuncInfo(func);
 
-		// For each SCC in the order...
-		for (const auto &scc : fico->sccs) {
-			if (hasItem(scc, func)) {
-				computeFuncInfos(scc);
-			}
+		auto sccIter = funcSCCMap.find(func);
+		if (sccIter != funcSCCMap.end()) {
+			computeFuncInfos(*sccIter->second);
 		}
 	}
 }
@@ -223,21 +231,40 @@ void OptimCallInfoObtainer::computeFuncInfo(ShPtr<Function> func) {
 * The computation is iterative. The function keeps computing @c funcInfoMap[f]
 * for every function @c f from @a funcs until there is no change (i.e. it
 * performs a fixed-point computation).
+*
+* The info of a function depends only on the infos of the functions it calls.
+* Therefore, in every iteration, only functions that call a function whose
+* info has changed since their last computation are computed again. The
+* result is the same as if all the functions were computed in every iteration.
 */
 void OptimCallInfoObtainer::computeFuncInfos(const FuncSet &funcs) {
-	FuncInfoMap oldFuncInfoMap;
-	do {
-		// Store the current FuncInfo for each function from funcs so we can
-		// check whether it has changed after the iteration.
-		for (const auto &func : funcs) {
-			oldFuncInfoMap[func] = funcInfoMap[func];
+	// Callers of every function from funcs that are also in funcs.
+	std::map<ShPtr<Function>, FuncSet> callersInFuncs;
+	for (const auto &func : funcs) {
+		ShPtr<CG::CalledFuncs> calledFuncs(cg->getCalledFuncs(func));
+		const FuncSet &callees(calledFuncs ? calledFuncs->callees : funcs);
+		for (const auto &callee : callees) {
+			if (hasItem(funcs, callee)) {
+				callersInFuncs[callee].insert(func);
+			}
 		}
+	}
 
-		// Compute a new FuncInfo for every function in funcs.
+	// At first, all the functions have to be computed.
+	FuncSet funcsToCompute(funcs);
+	while (!funcsToCompute.empty()) {
 		for (const auto &func : funcs) {
+			if (funcsToCompute.erase(func) == 0) {
+				continue;
+			}
+
+			ShPtr<OptimFuncInfo> oldFuncInfo(funcInfoMap[func]);
 			computeFuncInfo(func);
+			if (areDifferent(oldFuncInfo, funcInfoMap[func])) {
+				addToSet(callersInFuncs[func], funcsToCompute);
+			}
 		}
-	} while (hasChanged(oldFuncInfoMap, funcInfoMap));
+	}
 }
 
 /**
@@ -433,24 +460,5 @@ bool OptimCallInfoObtainer::areDifferent(ShPtr<OptimFuncInfo> fi1,
 		fi1->varsAlwaysModifiedBeforeRead != fi2->varsAlwaysModifiedBeforeRead;
 }
 
-/**
-* @brief Returns @c true if the FuncInfos in @a newInfo for functions that are
-*        also in @a oldInfo have changed, @c false otherwise.
-*/
-bool OptimCallInfoObtainer::hasChanged(const FuncInfoMap &oldInfo,
-		const FuncInfoMap &newInfo) {
-	// For every FuncInfo in oldInfo... (It may contain a less number of
-	// functions that newInfo.)
-	for (const auto &p : oldInfo) {
-		auto i = newInfo.find(p.first);
-		ASSERT_MSG(i != newInfo.end(), "oldInfo contains info for a function `" <<
-			p.first->getName() << "`that is not in newInfo");
-		if (areDifferent(p.second, i->second)) {
-			return true;
-		}
-	}
-	return false;
-}
-
 } // namespace llvmir2hll
 } // namespace retdec
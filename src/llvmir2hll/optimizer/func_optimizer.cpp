@@ -28,7 +28,8 @@ FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
 /**
 * @brief Performs the optimization on all functions in the module.
 *
-* This function calls runOnFunction() for each function in the module.
+* This function calls runOnFunction() for each function in the module that
+* should not be skipped (see shouldBeSkipped()).
 *
 * Only redefine if you want to prescribe the order in which functions are
 * optimized; otherwise, just override runOnFunction().
@@ -36,7 +37,9 @@ FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
 void FuncOptimizer::doOptimization() {
 	// For each function in the module...
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
-		runOnFunction(*i);
+		if (!shouldBeSkipped(*i)) {
+			runOnFunction(*i);
+		}
 	}
 }
 
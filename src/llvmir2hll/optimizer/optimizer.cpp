@@ -7,6 +7,9 @@
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::hasItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -20,7 +23,7 @@ namespace llvmir2hll {
 *  - @a module is non-null
 */
 Optimizer::Optimizer(ShPtr<Module> module):
-	OrderedAllVisitor(), module(module) {
+	OrderedAllVisitor(), module(module), funcsToSkip() {
 		PRECONDITION_NON_NULL(module);
 	}
 
@@ -43,6 +46,33 @@ ShPtr<Module> Optimizer::optimize() {
 	return module;
 }
 
+/**
+* @brief Returns @c true if the optimizer can be told to skip functions that
+*        have not changed since its previous run, @c false otherwise.
+*
+* Optimizers returning @c true have to satisfy the following conditions:
+*  - they check shouldBeSkipped() before optimizing a function;
+*  - the optimization of a function depends only on the function, functions
+*    called from it, and global variables;
+*  - running the optimizer on a function it has just optimized does not change
+*    the function.
+*
+* By default, this function returns @c false.
+*/
+bool Optimizer::canSkipUnchangedFuncs() const {
+	return false;
+}
+
+/**
+* @brief Sets functions that should not be optimized.
+*
+* The functions are skipped only if canSkipUnchangedFuncs() returns @c true.
+* Otherwise, this function has no effect.
+*/
+void Optimizer::setFuncsToSkip(const FuncSet &funcs) {
+	funcsToSkip = funcs;
+}
+
 /**
 * @brief Performs pre-optimization matters.
 *
@@ -72,5 +102,15 @@ void Optimizer::doOptimization() {}
 */
 void Optimizer::doFinalization() {}
 
+/**
+* @brief Returns @c true if the given function should not be optimized, @c
+*        false otherwise.
+*
+* See setFuncsToSkip() for more details.
+*/
+bool Optimizer::shouldBeSkipped(ShPtr<Function> func) const {
+	return hasItem(funcsToSkip, func);
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
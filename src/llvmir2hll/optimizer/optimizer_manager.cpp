@@ -8,8 +8,11 @@
 #include <thread>
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/graphs/cg/cg.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
 #include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/bit_op_to_log_op_optimizer.h"
@@ -45,6 +48,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_ufor_loop_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/func_fingerprinter.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
@@ -122,7 +126,9 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableDebug(enableDebug),
-		recoverFromOutOfMemory(true), backendRunOpts() {
+		recoverFromOutOfMemory(true), backendRunOpts(), lastOptRuns(),
+		numOfFuncOptimizations(0), numOfSkippedFuncOptimizations(0),
+		savedTime(0) {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
@@ -248,6 +254,8 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	//
 	run<CCastOptimizer>(m);
 	run<CArrayArgOptimizer>(m);
+
+	printSkippedFuncsStatistics();
 }
 
 /**
@@ -269,9 +277,13 @@ bool OptimizerManager::optShouldBeRun(const std::string &optId) const {
 }
 
 /**
-* @brief Runs the given optimizer provided that it should be run.
+* @brief Runs the given optimizer over @a m provided that it should be run.
+*
+* If the optimizer can skip functions that have not changed since its last run
+* (see Optimizer::canSkipUnchangedFuncs()), it is told to skip them.
 */
-void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer) {
+void OptimizerManager::runOptimizerProvidedItShouldBeRun(
+		ShPtr<Optimizer> optimizer, ShPtr<Module> m) {
 	const std::string OPT_ID = optimizer->getId();
 	if (!optShouldBeRun(OPT_ID)) {
 		return;
@@ -279,6 +291,15 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 
 	printOptimization(OPT_ID);
 
+	const bool SKIP_UNCHANGED_FUNCS = optimizer->canSkipUnchangedFuncs();
+	FuncSet funcsToSkip;
+	if (SKIP_UNCHANGED_FUNCS) {
+		funcsToSkip = getFuncsUnchangedSinceLastRun(OPT_ID, m);
+		optimizer->setFuncsToSkip(funcsToSkip);
+	}
+
+	bool optimizationFinished = true;
+	auto startTime = std::chrono::steady_clock::now();
 	if (recoverFromOutOfMemory) {
 		// Some optimizations, most notable CopyPropagation, may run out of
 		// memory on huge inputs. We try to recover from such situations by
@@ -291,15 +312,130 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		} catch (const std::bad_alloc &) {
 			Log::error() << Log::Warning << "out of memory; trying to recover" << std::endl;
 			std::this_thread::sleep_for(std::chrono::seconds(1));
+			optimizationFinished = false;
 		}
 	} else {
 		// Just run the optimizer and let std::bad_alloc propagate.
 		optimizer->optimize();
 	}
+	std::chrono::duration<double> runTime(
+		std::chrono::steady_clock::now() - startTime);
+
+	if (SKIP_UNCHANGED_FUNCS) {
+		if (optimizationFinished) {
+			recordRunOfOptimizer(OPT_ID, m, funcsToSkip.size(), runTime.count());
+		} else {
+			// Functions may have been left partially optimized, so they have
+			// to be optimized again in the next run.
+			lastOptRuns.erase(OPT_ID);
+		}
+	}
 
 	backendRunOpts.insert(OPT_ID);
 }
 
+/**
+* @brief Returns functions from @a m that can be skipped in the next run of the
+*        optimization with @a optId.
+*
+* A function can be skipped if neither the function, nor any function it
+* (directly or indirectly) calls, nor global variables have changed since the
+* end of the last run of the optimization. Functions calling functions by a
+* pointer are never skipped.
+*/
+FuncSet OptimizerManager::getFuncsUnchangedSinceLastRun(
+		const std::string &optId, ShPtr<Module> m) const {
+	auto lastRunIt = lastOptRuns.find(optId);
+	if (lastRunIt == lastOptRuns.end()) {
+		// The optimization has not been run yet.
+		return FuncSet();
+	}
+	const auto &lastRun = lastRunIt->second;
+
+	if (FuncFingerprinter::getGlobalVarsFingerprint(m) !=
+			lastRun.globalVarsFingerprint) {
+		return FuncSet();
+	}
+
+	FuncSet unchangedFuncs;
+	for (auto i = m->func_begin(), e = m->func_end(); i != e; ++i) {
+		auto fingerprintIt = lastRun.funcFingerprints.find(*i);
+		if (fingerprintIt != lastRun.funcFingerprints.end() &&
+				fingerprintIt->second == FuncFingerprinter::getFingerprint(*i)) {
+			unchangedFuncs.insert(*i);
+		}
+	}
+	if (unchangedFuncs.empty()) {
+		return unchangedFuncs;
+	}
+
+	// Optimizations may utilize information about called functions, so a
+	// function can be skipped only if all the functions it calls are
+	// unchanged.
+	ShPtr<CG> cg(CGBuilder::getCG(m));
+	FuncSet funcsToSkip;
+	for (const auto &func : unchangedFuncs) {
+		auto calledFuncs = cg->getCalledFuncs(func, true);
+		bool calleesUnchanged = !calledFuncs->callsByPointer;
+		for (const auto &callee : calledFuncs->callees) {
+			if (!calleesUnchanged) {
+				break;
+			}
+			calleesUnchanged = hasItem(unchangedFuncs, callee) &&
+				!cg->getCalledFuncs(callee)->callsByPointer;
+		}
+		if (calleesUnchanged) {
+			funcsToSkip.insert(func);
+		}
+	}
+	return funcsToSkip;
+}
+
+/**
+* @brief Records the fingerprints of functions and global variables in @a m
+*        after a run of the optimization with @a optId.
+*
+* @param[in] optId ID of the optimization.
+* @param[in] m Optimized module.
+* @param[in] numOfSkippedFuncs Number of functions skipped during the run.
+* @param[in] runTime Duration of the run (in seconds).
+*/
+void OptimizerManager::recordRunOfOptimizer(const std::string &optId,
+		ShPtr<Module> m, std::size_t numOfSkippedFuncs, double runTime) {
+	auto &lastRun = lastOptRuns[optId];
+	lastRun.funcFingerprints.clear();
+	for (auto i = m->func_begin(), e = m->func_end(); i != e; ++i) {
+		lastRun.funcFingerprints[*i] = FuncFingerprinter::getFingerprint(*i);
+	}
+	lastRun.globalVarsFingerprint = FuncFingerprinter::getGlobalVarsFingerprint(m);
+
+	// The time needed to optimize a skipped function is estimated by the
+	// average time needed to optimize the functions that were not skipped.
+	auto numOfFuncs = lastRun.funcFingerprints.size();
+	if (numOfFuncs > numOfSkippedFuncs) {
+		lastRun.timePerFunc = runTime / (numOfFuncs - numOfSkippedFuncs);
+	}
+
+	numOfFuncOptimizations += numOfFuncs;
+	numOfSkippedFuncOptimizations += numOfSkippedFuncs;
+	savedTime += numOfSkippedFuncs * lastRun.timePerFunc;
+}
+
+/**
+* @brief Prints debug information about functions that were skipped by
+*        optimizations because they were unchanged.
+*
+* If @c enableDebug is @c false, this function does nothing.
+*/
+void OptimizerManager::printSkippedFuncsStatistics() const {
+	if (enableDebug) {
+		Log::phase("skipped "s + std::to_string(numOfSkippedFuncOptimizations) +
+			" out of " + std::to_string(numOfFuncOptimizations) +
+			" function optimizations of unchanged functions (estimated time"
+			" saved: " + std::to_string(savedTime) + " s)", Log::SubPhase);
+	}
+}
+
 /**
 * @brief Prints debug information about the currently run optimization with @a
 *        optId.
@@ -353,7 +489,7 @@ template<typename Optimization, typename... Args>
 void OptimizerManager::run(ShPtr<Module> m, Args &&... args) {
 	auto optimizer = std::make_shared<Optimization>(m,
 		std::forward<Args>(args)...);
-	runOptimizerProvidedItShouldBeRun(optimizer);
+	runOptimizerProvidedItShouldBeRun(optimizer, m);
 }
 
 } // namespace llvmir2hll
@@ -113,12 +113,12 @@ void BoolComparisonSubOptimizer::optimizeNestedComparisons(ExprType expr) {
 }
 
 void BoolComparisonSubOptimizer::replaceWithFirstOperand(ShPtr<BinaryOpExpr> expr) {
-	Expression::replaceExpression(expr, expr->getFirstOperand());
+	optimizeExpr(expr, expr->getFirstOperand());
 }
 
 void BoolComparisonSubOptimizer::replaceWithNegationOfFirstOperand(
 		ShPtr<BinaryOpExpr> expr) {
-	Expression::replaceExpression(
+	optimizeExpr(
 		expr,
 		ExpressionNegater::negate(expr->getFirstOperand())
 	);
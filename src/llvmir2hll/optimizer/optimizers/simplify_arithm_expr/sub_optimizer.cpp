@@ -40,6 +40,17 @@ bool SubOptimizer::tryOptimize(ShPtr<Expression> expr) {
 	return tryOptimizeAndReturnIfCodeChanged(expr);
 }
 
+/**
+* @brief Returns the expression that has replaced the expression passed to the
+*        last call of tryOptimize().
+*
+* If the expression itself has not been replaced (it may still have been
+* modified), it is returned.
+*/
+ShPtr<Expression> SubOptimizer::getOptimizedExpr() const {
+	return optimizedExpr;
+}
+
 /**
 * @brief Optimize expression from @a oldExpr to @a newExpr.
 *
@@ -55,6 +66,9 @@ void SubOptimizer::optimizeExpr(ShPtr<Expression> oldExpr,
 
 	Expression::replaceExpression(oldExpr, newExpr);
 	codeChanged = true;
+	if (oldExpr == optimizedExpr) {
+		optimizedExpr = newExpr;
+	}
 }
 
 /**
@@ -66,6 +80,7 @@ void SubOptimizer::optimizeExpr(ShPtr<Expression> oldExpr,
 */
 bool SubOptimizer::tryOptimizeAndReturnIfCodeChanged(ShPtr<Expression> expr) {
 	codeChanged = false;
+	optimizedExpr = expr;
 	expr->accept(this);
 	return codeChanged;
 }
@@ -55,27 +55,26 @@ SimplifyArithmExprOptimizer::SimplifyArithmExprOptimizer(ShPtr<Module> module,
 }
 
 void SimplifyArithmExprOptimizer::doOptimization() {
+	// Every expression is optimized until there are no changes in it (see
+	// tryOptimizeInSubOptimizations()), so a single traversal suffices.
+
 	// Visit the initializer of all global variables.
 	for (auto i = module->global_var_begin(), e = module->global_var_end();
 			i != e; ++i) {
-		// Keep optimizing until there are no changes.
-		do {
-			codeChanged = false;
-			if (ShPtr<Expression> init = (*i)->getInitializer()) {
-				init->accept(this);
-			}
-		} while (codeChanged);
+		if (ShPtr<Expression> init = (*i)->getInitializer()) {
+			init->accept(this);
+		}
 	}
 
 	// Visit all functions.
 	for (auto i = module->func_definition_begin(),
 			e = module->func_definition_end(); i != e; ++i) {
-		// Keep optimizing until there are no changes.
-		do {
-			codeChanged = false;
-			restart();
-			(*i)->accept(this);
-		} while (codeChanged);
+		if (shouldBeSkipped(*i)) {
+			continue;
+		}
+
+		restart();
+		(*i)->accept(this);
 	}
 }
 
@@ -150,16 +149,25 @@ void SimplifyArithmExprOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
 /**
 * @brief Iterate through all sub-optimizers and try optimize @a expr.
 *
-* If something was optimized in sub-optimizations, @c codeChanged is set to
-* @c true.
+* The sub-optimizers are run repeatedly until none of them changes the
+* expression. When a sub-optimizer replaces @a expr, the next ones continue
+* with the replacement. Therefore, only the changed expression is traversed
+* again, not the whole function.
 *
 * @param[in] expr An expression to optimize.
 */
 void SimplifyArithmExprOptimizer::tryOptimizeInSubOptimizations(
 		ShPtr<Expression> expr) {
-	for (const auto &subOptim : subOptims) {
-		codeChanged |= subOptim->tryOptimize(expr);
-	}
+	bool exprChanged;
+	do {
+		exprChanged = false;
+		for (const auto &subOptim : subOptims) {
+			if (subOptim->tryOptimize(expr)) {
+				exprChanged = true;
+				expr = subOptim->getOptimizedExpr();
+			}
+		}
+	} while (exprChanged);
 }
 
 /**
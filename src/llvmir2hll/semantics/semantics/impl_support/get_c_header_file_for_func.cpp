@@ -15,9 +15,9 @@ namespace semantics {
 */
 std::optional<std::string> getCHeaderFileForFuncFromMap(
 		const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
+		const FuncCHeaderMap &map) {
+	auto header = map.find(funcName);
+	return header ? std::optional<std::string>(*header) : std::nullopt;
 }
 
 } // namespace semantics
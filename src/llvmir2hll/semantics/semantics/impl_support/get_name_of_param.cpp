@@ -15,9 +15,8 @@ namespace semantics {
 */
 std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
 		unsigned paramPos, const FuncParamNamesMap &map) {
-	auto funcParamIter = map.find(FuncParamPosPair(funcName, paramPos));
-	return funcParamIter != map.end() ?
-		std::optional<std::string>(funcParamIter->second) : std::nullopt;
+	auto paramName = map.find(FuncParamPosPair(funcName, paramPos));
+	return paramName ? std::optional<std::string>(*paramName) : std::nullopt;
 }
 
 } // namespace semantics
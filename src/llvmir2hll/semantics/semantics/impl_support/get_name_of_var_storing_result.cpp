@@ -15,9 +15,9 @@ namespace semantics {
 *        function from the given map.
 */
 std::optional<std::string> getNameOfVarStoringResultFromMap(const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? std::optional<std::string>(i->second) : std::nullopt;
+		const FuncVarNameMap &map) {
+	auto varName = map.find(funcName);
+	return varName ? std::optional<std::string>(*varName) : std::nullopt;
 }
 
 } // namespace semantics
@@ -16,14 +16,14 @@ namespace semantics {
 std::optional<IntStringMap> getSymbolicNamesForParamFromMap(const std::string &funcName,
 		unsigned paramPos, const FuncParamsMap &map) {
 	// Try to find the function.
-	auto funcIter = map.find(funcName);
-	if (funcIter == map.end()) {
+	auto paramSymbolsMap = map.find(funcName);
+	if (!paramSymbolsMap) {
 		return std::nullopt;
 	}
 
 	// Try to find the parameter by its position.
-	auto paramIter = funcIter->second.find(paramPos);
-	return paramIter != funcIter->second.end() ?
+	auto paramIter = paramSymbolsMap->find(paramPos);
+	return paramIter != paramSymbolsMap->end() ?
 		std::optional<IntStringMap>(paramIter->second) : std::nullopt;
 }
 
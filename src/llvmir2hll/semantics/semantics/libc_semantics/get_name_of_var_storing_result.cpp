@@ -19,8 +19,8 @@ namespace {
 * @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
 *        file.
 */
-const StringStringUMap &initFuncVarNameMap() {
-	static StringStringUMap m;
+const FuncVarNameMap &initFuncVarNameMap() {
+	static FuncVarNameMap m;
 
 	// The following list is based on
 	//
@@ -470,7 +470,7 @@ const StringStringUMap &initFuncVarNameMap() {
 }
 
 /// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+const FuncVarNameMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 
 } // anonymous namespace
 
@@ -19,8 +19,8 @@ namespace {
 * @brief This function is used to initialize FUNC_C_HEADER_MAP later in the
 *        file.
 */
-const StringStringUMap &initFuncCHeaderMap() {
-	static StringStringUMap m;
+const FuncCHeaderMap &initFuncCHeaderMap() {
+	static FuncCHeaderMap m;
 
 	// ctype.h
 	static const char *CTYPE_H_FUNCS[] = {
@@ -3863,7 +3863,7 @@ const StringStringUMap &initFuncCHeaderMap() {
 }
 
 /// Mapping of function names to their corresponding header files.
-const StringStringUMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
+const FuncCHeaderMap &FUNC_C_HEADER_MAP(initFuncCHeaderMap());
 
 } // anonymous namespace
 
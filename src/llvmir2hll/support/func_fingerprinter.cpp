@@ -0,0 +1,448 @@
+/**
+* @file src/llvmir2hll/support/func_fingerprinter.cpp
+* @brief Implementation of FuncFingerprinter.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <functional>
+#include <string>
+#include <typeinfo>
+
+#include <llvm/ADT/Hashing.h>
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/address_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
+#include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_cast_expr.h"
+#include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shl_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shr_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/break_stmt.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/call_stmt.h"
+#include "retdec/llvmir2hll/ir/comma_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_array.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_float.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/const_null_pointer.h"
+#include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/const_struct.h"
+#include "retdec/llvmir2hll/ir/const_symbol.h"
+#include "retdec/llvmir2hll/ir/continue_stmt.h"
+#include "retdec/llvmir2hll/ir/deref_op_expr.h"
+#include "retdec/llvmir2hll/ir/div_op_expr.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/ext_cast_expr.h"
+#include "retdec/llvmir2hll/ir/for_loop_stmt.h"
+#include "retdec/llvmir2hll/ir/fp_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/global_var_def.h"
+#include "retdec/llvmir2hll/ir/goto_stmt.h"
+#include "retdec/llvmir2hll/ir/gt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/gt_op_expr.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_to_fp_cast_expr.h"
+#include "retdec/llvmir2hll/ir/int_to_ptr_cast_expr.h"
+#include "retdec/llvmir2hll/ir/lt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/mod_op_expr.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/neg_op_expr.h"
+#include "retdec/llvmir2hll/ir/neq_op_expr.h"
+#include "retdec/llvmir2hll/ir/not_op_expr.h"
+#include "retdec/llvmir2hll/ir/or_op_expr.h"
+#include "retdec/llvmir2hll/ir/ptr_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/switch_stmt.h"
+#include "retdec/llvmir2hll/ir/ternary_op_expr.h"
+#include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
+#include "retdec/llvmir2hll/ir/type.h"
+#include "retdec/llvmir2hll/ir/ufor_loop_stmt.h"
+#include "retdec/llvmir2hll/ir/unreachable_stmt.h"
+#include "retdec/llvmir2hll/ir/var_def_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/ir/while_loop_stmt.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/func_fingerprinter.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new fingerprinter.
+*/
+FuncFingerprinter::FuncFingerprinter(): OrderedAllVisitor(), fingerprint(0) {}
+
+/**
+* @brief Returns the fingerprint of the given function.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+std::size_t FuncFingerprinter::getFingerprint(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+
+	FuncFingerprinter fingerprinter;
+	func->accept(&fingerprinter);
+	return fingerprinter.fingerprint;
+}
+
+/**
+* @brief Returns a fingerprint of all global variables in the given module,
+*        including their initializers.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+std::size_t FuncFingerprinter::getGlobalVarsFingerprint(ShPtr<Module> module) {
+	PRECONDITION_NON_NULL(module);
+
+	FuncFingerprinter fingerprinter;
+	for (auto i = module->global_var_begin(), e = module->global_var_end();
+			i != e; ++i) {
+		(*i)->accept(&fingerprinter);
+	}
+	return fingerprinter.fingerprint;
+}
+
+/**
+* @brief Combines the current fingerprint with the given hash.
+*
+* The order in which hashes are added matters.
+*/
+void FuncFingerprinter::addToFingerprint(std::size_t hash) {
+	fingerprint ^= hash + 0x9e3779b9 + (fingerprint << 6) + (fingerprint >> 2);
+}
+
+/**
+* @brief Adds the identity and the kind of the given value to the fingerprint.
+*/
+void FuncFingerprinter::addValueToFingerprint(ShPtr<Value> value) {
+	// The kind is needed because a new value may be allocated at the address
+	// of a value that no longer exists.
+	addToFingerprint(std::hash<Value *>()(value.get()));
+	addToFingerprint(typeid(*value).hash_code());
+}
+
+void FuncFingerprinter::visit(ShPtr<GlobalVarDef> varDef) {
+	addValueToFingerprint(varDef);
+	OrderedAllVisitor::visit(varDef);
+}
+
+void FuncFingerprinter::visit(ShPtr<Function> func) {
+	addValueToFingerprint(func);
+	addToFingerprint(std::hash<Type *>()(func->getRetType().get()));
+	addToFingerprint(func->isVarArg());
+	addToFingerprint(std::hash<Statement *>()(func->getBody().get()));
+	OrderedAllVisitor::visit(func);
+}
+
+void FuncFingerprinter::visit(ShPtr<AssignStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<BreakStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<CallStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<ContinueStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<EmptyStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<ForLoopStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<UForLoopStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<GotoStmt> stmt) {
+	addValueToFingerprint(stmt);
+	addToFingerprint(std::hash<Statement *>()(stmt->getTarget().get()));
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<IfStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<ReturnStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<SwitchStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<UnreachableStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<VarDefStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<WhileLoopStmt> stmt) {
+	addValueToFingerprint(stmt);
+	OrderedAllVisitor::visit(stmt);
+}
+
+void FuncFingerprinter::visit(ShPtr<AddOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<AddressOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<AndOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<ArrayIndexOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<AssignOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitAndOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitOrOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitShlOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitShrOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitXorOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<CallExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<CommaOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<DerefOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<DivOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<EqOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<GtEqOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<GtOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<LtEqOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<LtOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<ModOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<MulOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<NegOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<NeqOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<NotOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<OrOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<StructIndexOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<SubOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<TernaryOpExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<Variable> var) {
+	addValueToFingerprint(var);
+	addToFingerprint(std::hash<std::string>()(var->getName()));
+	addToFingerprint(std::hash<Type *>()(var->getType().get()));
+	OrderedAllVisitor::visit(var);
+}
+
+void FuncFingerprinter::visit(ShPtr<BitCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<ExtCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<FPToIntCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<IntToFPCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<IntToPtrCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<PtrToIntCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<TruncCastExpr> expr) {
+	addValueToFingerprint(expr);
+	OrderedAllVisitor::visit(expr);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstArray> constant) {
+	addValueToFingerprint(constant);
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstBool> constant) {
+	addValueToFingerprint(constant);
+	addToFingerprint(constant->getValue());
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstFloat> constant) {
+	addValueToFingerprint(constant);
+	addToFingerprint(llvm::hash_value(constant->getValue()));
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstInt> constant) {
+	addValueToFingerprint(constant);
+	addToFingerprint(llvm::hash_value(constant->getValue()));
+	addToFingerprint(constant->isSigned());
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstNullPointer> constant) {
+	addValueToFingerprint(constant);
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstString> constant) {
+	addValueToFingerprint(constant);
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstStruct> constant) {
+	addValueToFingerprint(constant);
+	OrderedAllVisitor::visit(constant);
+}
+
+void FuncFingerprinter::visit(ShPtr<ConstSymbol> constant) {
+	addValueToFingerprint(constant);
+	OrderedAllVisitor::visit(constant);
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
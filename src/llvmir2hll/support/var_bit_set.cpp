@@ -0,0 +1,153 @@
+/**
+* @file src/llvmir2hll/support/var_bit_set.cpp
+* @brief Implementation of VarBitSet.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <bitset>
+
+#include "retdec/llvmir2hll/support/var_bit_set.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs an empty set.
+*/
+VarBitSet::VarBitSet(): firstWord(0), otherWords() {}
+
+/**
+* @brief Returns @c true if both sets contain the same indexes, @c false
+*        otherwise.
+*/
+bool VarBitSet::operator==(const VarBitSet &other) const {
+	if (firstWord != other.firstWord) {
+		return false;
+	}
+
+	// Trailing zero words do not change the set.
+	auto words = std::max(otherWords.size(), other.otherWords.size());
+	for (std::size_t i = 1; i <= words; ++i) {
+		if (getWord(i) != other.getWord(i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* @brief Returns @c true if the sets differ, @c false otherwise.
+*/
+bool VarBitSet::operator!=(const VarBitSet &other) const {
+	return !(*this == other);
+}
+
+/**
+* @brief Adds all indexes from @a other into the set.
+*/
+VarBitSet &VarBitSet::operator|=(const VarBitSet &other) {
+	firstWord |= other.firstWord;
+	if (otherWords.size() < other.otherWords.size()) {
+		otherWords.resize(other.otherWords.size(), 0);
+	}
+	for (std::size_t i = 0, e = other.otherWords.size(); i != e; ++i) {
+		otherWords[i] |= other.otherWords[i];
+	}
+	return *this;
+}
+
+/**
+* @brief Removes all indexes that are not in @a other from the set.
+*/
+VarBitSet &VarBitSet::operator&=(const VarBitSet &other) {
+	firstWord &= other.firstWord;
+	for (std::size_t i = 0, e = otherWords.size(); i != e; ++i) {
+		otherWords[i] &= other.getWord(i + 1);
+	}
+	return *this;
+}
+
+/**
+* @brief Inserts the given index into the set.
+*/
+void VarBitSet::insert(std::size_t index) {
+	auto bit = std::uint64_t(1) << (index % BitsPerWord);
+	if (index < BitsPerWord) {
+		firstWord |= bit;
+		return;
+	}
+
+	auto i = index / BitsPerWord - 1;
+	if (i >= otherWords.size()) {
+		otherWords.resize(i + 1, 0);
+	}
+	otherWords[i] |= bit;
+}
+
+/**
+* @brief Removes all indexes from the set.
+*/
+void VarBitSet::clear() {
+	firstWord = 0;
+	otherWords.clear();
+}
+
+/**
+* @brief Returns @c true if the set contains the given index, @c false
+*        otherwise.
+*/
+bool VarBitSet::contains(std::size_t index) const {
+	return getWord(index / BitsPerWord) &
+		(std::uint64_t(1) << (index % BitsPerWord));
+}
+
+/**
+* @brief Returns @c true if the set and @a other have at least one common
+*        index, @c false otherwise.
+*/
+bool VarBitSet::intersects(const VarBitSet &other) const {
+	if (firstWord & other.firstWord) {
+		return true;
+	}
+
+	auto words = std::min(otherWords.size(), other.otherWords.size());
+	for (std::size_t i = 0; i < words; ++i) {
+		if (otherWords[i] & other.otherWords[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+* @brief Returns @c true if the set is empty, @c false otherwise.
+*/
+bool VarBitSet::empty() const {
+	return firstWord == 0 && std::all_of(otherWords.begin(), otherWords.end(),
+		[](auto word) { return word == 0; });
+}
+
+/**
+* @brief Returns the number of indexes in the set.
+*/
+std::size_t VarBitSet::size() const {
+	auto result = std::bitset<BitsPerWord>(firstWord).count();
+	for (auto word : otherWords) {
+		result += std::bitset<BitsPerWord>(word).count();
+	}
+	return result;
+}
+
+/**
+* @brief Returns the @a i-th word of the set (zero if it is not stored).
+*/
+std::uint64_t VarBitSet::getWord(std::size_t i) const {
+	if (i == 0) {
+		return firstWord;
+	}
+	return i <= otherWords.size() ? otherWords[i - 1] : 0;
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
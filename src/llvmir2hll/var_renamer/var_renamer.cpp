@@ -4,7 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
 #include <cctype>
+#include <functional>
+#include <vector>
 
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/global_var_def.h"
@@ -16,15 +19,62 @@
 #include "retdec/llvmir2hll/utils/ir.h"
 #include "retdec/llvmir2hll/utils/string.h"
 #include "retdec/llvmir2hll/var_renamer/var_renamer.h"
+#include "retdec/llvmir2hll/var_renamer/var_renamer_factory.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/parallel.h"
 
+using retdec::utils::addToSet;
 using retdec::utils::hasItem;
 using retdec::utils::mapGetValueOrDefault;
 
 namespace retdec {
 namespace llvmir2hll {
 
+namespace {
+
+/**
+* @brief Finds out whether a function uses a variable that does not belong to
+*        it.
+*/
+class ForeignVarFinder: private OrderedAllVisitor {
+public:
+	/// Returns @c true if the given variable may be used in the function.
+	using VarPredicate = std::function<bool (ShPtr<Variable>)>;
+
+public:
+	/**
+	* @brief Returns @c true if the body of @a func uses a variable for which
+	*        @a isOwnVar returns @c false, @c false otherwise.
+	*/
+	static bool usesForeignVar(ShPtr<Function> func,
+			const VarPredicate &isOwnVar) {
+		ForeignVarFinder finder(isOwnVar);
+		finder.visitStmt(func->getBody());
+		return finder.foundForeignVar;
+	}
+
+private:
+	ForeignVarFinder(const VarPredicate &isOwnVar):
+		OrderedAllVisitor(), isOwnVar(isOwnVar), foundForeignVar(false) {}
+
+	using OrderedAllVisitor::visit;
+	virtual void visit(ShPtr<Variable> var) override {
+		if (!isOwnVar(var)) {
+			foundForeignVar = true;
+		}
+	}
+
+private:
+	/// Returns @c true if the given variable may be used in the function.
+	const VarPredicate &isOwnVar;
+
+	/// Has a variable not belonging to the function been found?
+	bool foundForeignVar;
+};
+
+} // anonymous namespace
+
 /**
 * @brief Constructs a new variable renamer.
 *
@@ -38,7 +88,7 @@ namespace llvmir2hll {
 VarRenamer::VarRenamer(ShPtr<VarNameGen> varNameGen, bool useDebugNames):
 	varNameGen(varNameGen), useDebugNames(useDebugNames), module(),
 	globalVars(), renamedVars(), globalVarsNames(), localVarsNames(),
-	currFunc() {
+	currFunc(), threads(1) {
 		PRECONDITION_NON_NULL(varNameGen);
 	}
 
@@ -47,14 +97,18 @@ VarRenamer::VarRenamer(ShPtr<VarNameGen> varNameGen, bool useDebugNames):
 *        when constructing the renamer.
 *
 * @param[in,out] module Module whose variables are renamed.
+* @param[in] threads Maximal number of threads used to rename variables in
+*                    functions (@c 0 means all hardware threads). The result
+*                    does not depend on it.
 *
 * Before that, however, it restarts the variable name generator passed when
 * creating the renamer.
 *
 * Function names are not renamed.
 */
-void VarRenamer::renameVars(ShPtr<Module> module) {
+void VarRenamer::renameVars(ShPtr<Module> module, std::size_t threads) {
 	this->module = module;
+	this->threads = threads;
 	globalVars = module->getGlobalVars();
 	storeFuncsByName();
 	varNameGen->restart();
@@ -209,6 +263,23 @@ ShPtr<Function> VarRenamer::getFuncByName(const std::string &name) const {
 	return mapGetValueOrDefault(funcsByName, name);
 }
 
+/**
+* @brief Returns @c true if the names assigned to variables in a function do not
+*        depend on other functions, @c false otherwise.
+*
+* More precisely, the names may depend only on the function itself, on the
+* names of global variables and functions, and on names assigned before
+* renameVarsInFuncs() is called. In such a case, renameVarsInFuncs() may
+* rename the functions in parallel, where each thread uses its own instance
+* of the renamer obtained from VarRenamerFactory.
+*
+* By default, it returns @c false because renameFuncParam() and
+* renameFuncLocalVar() use the generator of names shared by all functions.
+*/
+bool VarRenamer::canRenameFuncsIndependently() const {
+	return false;
+}
+
 /**
 * @brief Populates the @c funcsByName map.
 */
@@ -405,14 +476,119 @@ void VarRenamer::renameGlobalVar(ShPtr<Variable> var) {
 * @brief Renames the variables in all functions.
 *
 * By default, it calls renameVarsInFunc() on every function in the module,
-* including function declarations.
+* including function declarations. If more than one thread may be used and
+* canRenameFuncsIndependently() returns @c true, the functions are renamed in
+* parallel.
 */
 void VarRenamer::renameVarsInFuncs() {
+	if (utils::getThreadCount(threads) > 1 && canRenameFuncsIndependently() &&
+			renameVarsInFuncsInParallel()) {
+		return;
+	}
+
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		renameVarsInFunc(*i);
 	}
 }
 
+/**
+* @brief Renames the variables in all functions in parallel.
+*
+* The functions are split into consecutive chunks. Every chunk is renamed by a
+* new instance of the renamer that starts from the current state of this
+* renamer. Since functions are renamed independently of each other (see
+* canRenameFuncsIndependently()), the assigned names are the same as when
+* renaming the functions one after another. There are more chunks than
+* threads so that the threads are kept busy when functions differ in size.
+*
+* If some function uses a variable of another function, or if a new instance
+* of the renamer cannot be created, nothing is renamed and @c false is
+* returned.
+*/
+bool VarRenamer::renameVarsInFuncsInParallel() {
+	FuncVector funcs(module->func_begin(), module->func_end());
+	if (!funcsUseOnlyOwnVars(funcs)) {
+		return false;
+	}
+
+	auto threadCount = utils::getThreadCount(threads);
+	auto chunkCount = std::min(funcs.size(), 4 * threadCount);
+	auto chunkBegin = [&](std::size_t chunk) {
+		return chunk * funcs.size() / chunkCount;
+	};
+	std::vector<ShPtr<VarRenamer>> renamers;
+	for (std::size_t i = 0; i < chunkCount; ++i) {
+		ShPtr<VarRenamer> renamer(VarRenamerFactory::getInstance().createObject(
+			getId(), varNameGen, useDebugNames));
+		if (!renamer) {
+			return false;
+		}
+
+		renamer->module = module;
+		renamer->globalVars = globalVars;
+		renamer->funcsByName = funcsByName;
+		renamer->renamedVars = renamedVars;
+		renamer->globalVarsNames = globalVarsNames;
+		for (auto j = chunkBegin(i), e = chunkBegin(i + 1); j < e; ++j) {
+			auto it = localVarsNames.find(funcs[j]);
+			if (it != localVarsNames.end()) {
+				renamer->localVarsNames[funcs[j]] = it->second;
+			}
+		}
+		renamers.push_back(renamer);
+	}
+
+	utils::parallelFor(chunkCount, threadCount, [&](std::size_t i) {
+		for (auto j = chunkBegin(i), e = chunkBegin(i + 1); j < e; ++j) {
+			renamers[i]->renameVarsInFunc(funcs[j]);
+		}
+	});
+
+	// Make the state the same as after renaming the functions serially.
+	for (std::size_t i = 0; i < chunkCount; ++i) {
+		addToSet(renamers[i]->renamedVars, renamedVars);
+		for (auto j = chunkBegin(i), e = chunkBegin(i + 1); j < e; ++j) {
+			localVarsNames[funcs[j]] = std::move(
+				renamers[i]->localVarsNames[funcs[j]]);
+		}
+	}
+	return true;
+}
+
+/**
+* @brief Returns @c true if every function in @a funcs uses only its own local
+*        variables and parameters, global variables, and functions, @c false
+*        otherwise.
+*/
+bool VarRenamer::funcsUseOnlyOwnVars(const FuncVector &funcs) const {
+	// No variable may be a local variable of several functions.
+	VarSet allLocalVars;
+	for (const auto &func : funcs) {
+		for (const auto &var : func->getLocalVars(true)) {
+			if (!allLocalVars.insert(var).second) {
+				return false;
+			}
+		}
+	}
+
+	// Bodies are only read, so they can be checked in parallel.
+	std::vector<char> usesOnlyOwnVars(funcs.size(), true);
+	utils::parallelFor(funcs.size(), threads, [&](std::size_t i) {
+		if (!funcs[i]->isDefinition()) {
+			return;
+		}
+
+		VarSet localVars(funcs[i]->getLocalVars(true));
+		usesOnlyOwnVars[i] = !ForeignVarFinder::usesForeignVar(funcs[i],
+			[&](ShPtr<Variable> var) {
+				return hasItem(localVars, var) || isGlobalVar(var) ||
+					getFuncByName(var->getName()) != nullptr;
+			});
+	});
+	return std::all_of(usesOnlyOwnVars.begin(), usesOnlyOwnVars.end(),
+		[](char usesOnlyOwn) { return usesOnlyOwn; });
+}
+
 /**
 * @brief Renames variables in the given function.
 *
@@ -75,6 +75,12 @@ std::string AddressVarRenamer::getId() const {
 	return ADDRESS_VAR_RENAMER_ID;
 }
 
+bool AddressVarRenamer::canRenameFuncsIndependently() const {
+	// Addresses come from the original names of variables and the numbering
+	// of parameters and local variables starts anew in every function.
+	return true;
+}
+
 void AddressVarRenamer::renameGlobalVar(ShPtr<Variable> var) {
 	PRECONDITION_NON_NULL(var);
 
@@ -96,6 +96,11 @@ std::string HungarianVarRenamer::getId() const {
 	return HUNGARIAN_VAR_RENAMER_ID;
 }
 
+bool HungarianVarRenamer::canRenameFuncsIndependently() const {
+	// Parameters and local variables are numbered anew in every function.
+	return true;
+}
+
 void HungarianVarRenamer::renameGlobalVar(ShPtr<Variable> var) {
 	PRECONDITION_NON_NULL(var);
 
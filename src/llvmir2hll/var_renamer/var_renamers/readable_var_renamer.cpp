@@ -29,7 +29,6 @@
 
 using namespace std::string_literals;
 
-using retdec::utils::addToSet;
 using retdec::utils::arraySize;
 
 namespace retdec {
@@ -90,6 +89,12 @@ std::string ReadableVarRenamer::getId() const {
 	return READABLE_VAR_RENAMER_ID;
 }
 
+bool ReadableVarRenamer::canRenameFuncsIndependently() const {
+	// Parameters are named by their positions and the numbering of local
+	// variables starts anew in every function.
+	return true;
+}
+
 void ReadableVarRenamer::renameGlobalVar(ShPtr<Variable> var) {
 	PRECONDITION_NON_NULL(var);
 
@@ -182,7 +187,8 @@ void ReadableVarRenamer::renameInductionVars(ShPtr<Function> func) {
 	// We have to insert the names of induction variables to the set of
 	// assigned names of local variables in the current function to prevent
 	// name clashes.
-	addToSet(indVarsNamesInCurrFunc, localVarsNames[func]);
+	localVarsNames[func].insert(indVarsNamesInCurrFunc.begin(),
+		indVarsNamesInCurrFunc.end());
 	renamingInductionVars = false;
 }
 
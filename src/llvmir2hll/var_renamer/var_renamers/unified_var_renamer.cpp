@@ -48,6 +48,11 @@ std::string UnifiedVarRenamer::getId() const {
 	return UNIFIED_VAR_RENAMER_ID;
 }
 
+bool UnifiedVarRenamer::canRenameFuncsIndependently() const {
+	// Parameters and local variables are numbered anew in every function.
+	return true;
+}
+
 void UnifiedVarRenamer::renameGlobalVar(ShPtr<Variable> var) {
 	PRECONDITION_NON_NULL(var);
 
@@ -76,6 +76,27 @@ std::unique_ptr<Image> createImage(const std::string& filePath, bool isRaw)
 	return createImageImpl(fileFormatShared);
 }
 
+/**
+ * Create instance of Image class from file content in memory.
+ * If the input data cannot be loaded, function will return @c nullptr.
+ * Data must outlive the returned image.
+ *
+ * @param data Content of input file.
+ * @param size Size of @a data.
+ * @param isRaw Is the input a raw binary file format?
+ *
+ * @return Pointer to instance of Image class or @c nullptr if any error
+ */
+std::unique_ptr<Image> createImage(const std::uint8_t* data, std::size_t size, bool isRaw)
+{
+	std::unique_ptr<retdec::fileformat::FileFormat> fileFormat = retdec::fileformat::createFileFormat(
+			data,
+			size,
+			isRaw);
+	std::shared_ptr<retdec::fileformat::FileFormat> fileFormatShared(std::move(fileFormat)); // Obtain ownership.
+	return createImageImpl(fileFormatShared);
+}
+
 /**
  * Create instance of Image class from existing file format instance.
  * If the input file cannot be loaded, function will return @c nullptr,
@@ -396,6 +396,7 @@ bool Image::setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& va
 		return false;
 	}
 
+	invalidatePointerMap();
 	return seg->setBytes(val, address - seg->getAddress());
 }
 
@@ -408,6 +409,12 @@ bool Image::setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& va
  */
 bool Image::isPointer(std::uint64_t address, std::uint64_t* pointer) const
 {
+	bool isPtr = false;
+	if (getPointerMap().isPointer(address, isPtr, pointer))
+	{
+		return isPtr;
+	}
+
 	std::uint64_t val = 0;
 	if (getWord(address, val) && hasDataOnAddress(val))
 	{
@@ -420,6 +427,29 @@ bool Image::isPointer(std::uint64_t address, std::uint64_t* pointer) const
 	return false;
 }
 
+/**
+ * Returns the map of pointers in the data segments. The map is built on the
+ * first call and kept until the image changes. It is safe to call this from
+ * several threads at once as long as the image is not modified meanwhile.
+ *
+ * @return Pointer map of the image.
+ */
+const PointerMap& Image::getPointerMap() const
+{
+	std::lock_guard<std::mutex> lock(_pointerMapMutex);
+	if (!_pointerMap)
+	{
+		_pointerMap = std::make_unique<PointerMap>(*this);
+	}
+	return *_pointerMap;
+}
+
+void Image::invalidatePointerMap()
+{
+	std::lock_guard<std::mutex> lock(_pointerMapMutex);
+	_pointerMap.reset();
+}
+
 const std::string& Image::getStatusMessage() const
 {
 	return _statusMessage;
@@ -437,6 +467,7 @@ const retdec::fileformat::LoaderErrorInfo & Image::getLoaderErrorInfo() const
 
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
+	invalidatePointerMap();
 	_segments.push_back(std::move(segment));
 
 	// We have used move constructor, segment is no longer valid pointer
@@ -452,6 +483,7 @@ void Image::removeSegment(Segment* segment)
 	{
 		if (itr->get() == segment)
 		{
+			invalidatePointerMap();
 			_segments.erase(itr);
 			return;
 		}
@@ -468,6 +500,7 @@ void Image::nameSegment(Segment* segment)
 
 void Image::sortSegments()
 {
+	invalidatePointerMap();
 	std::stable_sort(_segments.begin(), _segments.end(), [](const std::unique_ptr<Segment>& seg1, const std::unique_ptr<Segment>& seg2)
 			{
 				return seg1->getAddress() < seg2->getAddress();
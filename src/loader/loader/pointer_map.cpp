@@ -0,0 +1,298 @@
+/**
+ * @file src/loader/loader/pointer_map.cpp
+ * @brief Implementation of pointer map class.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/loader/pointer_map.h"
+
+namespace retdec {
+namespace loader {
+
+/**
+ * Builds the map for all the data segments of the given image.
+ * If the image's words can not be read directly (unknown endianness, unusual
+ * byte or word size, unsorted segments), nothing is mapped and all queries
+ * are left to the caller.
+ *
+ * @param image Image to build the map for.
+ */
+PointerMap::PointerMap(const Image& image) : _image(&image)
+{
+	_wordSize = image.getBytesPerWord();
+	if (image.getByteLength() != 8
+			|| _wordSize == 0
+			|| _wordSize > sizeof(std::uint64_t)
+			|| image.getEndianness() == retdec::utils::Endianness::UNKNOWN)
+	{
+		return;
+	}
+	_bigEndian = image.getEndianness() == retdec::utils::Endianness::BIG;
+
+	const auto& segments = image.getSegments();
+	bool sorted = std::is_sorted(segments.begin(), segments.end(),
+			[](const std::unique_ptr<Segment>& s1, const std::unique_ptr<Segment>& s2)
+			{
+				return s1->getAddress() < s2->getAddress();
+			});
+	if (!sorted)
+	{
+		return;
+	}
+
+	buildIntervals(image);
+
+	_regions.resize(segments.size());
+	for (std::size_t i = 0; i < segments.size(); ++i)
+	{
+		auto* secSeg = segments[i]->getSecSeg();
+		if (secSeg == nullptr || secSeg->isSomeData())
+		{
+			buildRegion(image, i);
+		}
+	}
+}
+
+/**
+ * Splits the address space covered by segments into disjoint intervals.
+ * Where segments overlap, the address belongs to the first segment that
+ * contains it -- the same one @c Image::getSegmentFromAddress() returns.
+ */
+void PointerMap::buildIntervals(const Image& image)
+{
+	const auto& segments = image.getSegments();
+
+	std::uint64_t coveredEnd = 0;
+	bool first = true;
+	for (std::size_t i = 0; i < segments.size(); ++i)
+	{
+		const auto& seg = segments[i];
+		auto start = first ? seg->getAddress() : std::max(seg->getAddress(), coveredEnd);
+		auto end = seg->getEndAddress();
+		if (start >= end)
+		{
+			continue;
+		}
+
+		Kind kind = Kind::None;
+		if (auto* secSeg = seg->getSecSeg())
+		{
+			if (!secSeg->isDebug())
+			{
+				kind = secSeg->isSomeCode() ? Kind::Code : Kind::Data;
+			}
+		}
+
+		_intervals.push_back({start, end, i, kind});
+		coveredEnd = first ? end : std::max(coveredEnd, end);
+		first = false;
+
+		if (kind != Kind::None)
+		{
+			_lowest = _highest == 0 ? start : std::min(_lowest, start);
+			_highest = std::max(_highest, end);
+		}
+	}
+}
+
+/**
+ * Classifies all the words of the given segment.
+ */
+void PointerMap::buildRegion(const Image& image, std::size_t segment)
+{
+	const auto& seg = image.getSegments()[segment];
+
+	Region& r = _regions[segment];
+	r.segment = segment;
+	r.start = seg->getAddress();
+	r.size = seg->getSize();
+
+	auto raw = seg->getRawData();
+	r.dataSize = raw.first ? std::min(raw.second, r.size) : 0;
+
+	// Words that can be read as a whole.
+	std::uint64_t words = r.size / _wordSize;
+	// Words that overlap the raw data, the rest is zero-filled.
+	std::uint64_t dataWords = std::min(
+			words,
+			(r.dataSize + _wordSize - 1) / _wordSize);
+
+	r.kinds.resize(dataWords, Kind::None);
+	for (std::uint64_t i = 0; i < dataWords; ++i)
+	{
+		auto value = readWord(raw.first, r.dataSize, i * _wordSize);
+
+		// Most of the words are not pointers at all -> cheap range test first.
+		if (value < _lowest || value >= _highest)
+		{
+			continue;
+		}
+		r.kinds[i] = classify(value);
+	}
+
+	r.zeroKind = classify(0);
+}
+
+/**
+ * Reads the word at the given offset in the raw data of a segment. Bytes
+ * beyond the raw data are zeros.
+ */
+std::uint64_t PointerMap::readWord(const std::uint8_t* data, std::uint64_t dataSize, std::uint64_t offset) const
+{
+	std::uint64_t value = 0;
+	for (std::size_t i = 0; i < _wordSize; ++i)
+	{
+		std::uint64_t b = offset + i < dataSize ? data[offset + i] : 0;
+		value |= b << (8 * (_bigEndian ? _wordSize - i - 1 : i));
+	}
+	return value;
+}
+
+/**
+ * Classifies the given value as if it was a pointer.
+ *
+ * @param value Value to classify.
+ *
+ * @return Kind of the segment the value points into.
+ */
+PointerMap::Kind PointerMap::classify(std::uint64_t value) const
+{
+	auto* i = findInterval(value);
+	return i ? i->kind : Kind::None;
+}
+
+const PointerMap::Interval* PointerMap::findInterval(std::uint64_t address) const
+{
+	auto it = std::upper_bound(_intervals.begin(), _intervals.end(), address,
+			[](std::uint64_t a, const Interval& i)
+			{
+				return a < i.start;
+			});
+	if (it == _intervals.begin())
+	{
+		return nullptr;
+	}
+	--it;
+	return address < it->end ? &(*it) : nullptr;
+}
+
+/**
+ * @param address Address of the queried word.
+ * @param index   Set to the index of the word in the returned region.
+ *
+ * @return Mapped region which has a word starting at the given address, or
+ *         @c nullptr.
+ */
+const PointerMap::Region* PointerMap::findRegion(std::uint64_t address, std::uint64_t& index) const
+{
+	auto* i = findInterval(address);
+	if (i == nullptr)
+	{
+		return nullptr;
+	}
+
+	const Region& r = _regions[i->segment];
+	if (r.size == 0 || (address - r.start) % _wordSize)
+	{
+		return nullptr;
+	}
+
+	index = (address - r.start) / _wordSize;
+	return &r;
+}
+
+/**
+ * Checks whether the map knows the word at the given address.
+ *
+ * @param address The address to check.
+ *
+ * @return True if queries for this address are answered by the map.
+ */
+bool PointerMap::isCovered(std::uint64_t address) const
+{
+	std::uint64_t index = 0;
+	return findRegion(address, index) != nullptr;
+}
+
+/**
+ * Gets the kind of the word at the given address.
+ *
+ * @param address Address of the word.
+ * @param kind    Set to the kind of the word.
+ *
+ * @return True if the address is covered by the map, otherwise false.
+ */
+bool PointerMap::getKind(std::uint64_t address, Kind& kind) const
+{
+	std::uint64_t index = 0;
+	auto* r = findRegion(address, index);
+	if (r == nullptr)
+	{
+		return false;
+	}
+
+	if ((index + 1) * _wordSize > r->size)
+	{
+		// Word reaches beyond the segment -> can not be read.
+		kind = Kind::None;
+	}
+	else
+	{
+		kind = index < r->kinds.size() ? r->kinds[index] : r->zeroKind;
+	}
+	return true;
+}
+
+/**
+ * Answers @c Image::isPointer() query for the given address.
+ *
+ * @param address Address of the word.
+ * @param isPtr   Set to true if the word is a pointer into some segment.
+ * @param pointer If not @c nullptr and the word is a pointer, set to its value.
+ *
+ * @return True if the address is covered by the map, otherwise false.
+ */
+bool PointerMap::isPointer(std::uint64_t address, bool& isPtr, std::uint64_t* pointer) const
+{
+	Kind kind = Kind::None;
+	if (!getKind(address, kind))
+	{
+		return false;
+	}
+
+	isPtr = kind != Kind::None;
+	if (isPtr && pointer)
+	{
+		getWord(address, *pointer);
+	}
+	return true;
+}
+
+/**
+ * Reads the word at the given address.
+ *
+ * @param address Address of the word.
+ * @param word    Set to the word value.
+ *
+ * @return True if the address is covered by the map and the word can be read.
+ */
+bool PointerMap::getWord(std::uint64_t address, std::uint64_t& word) const
+{
+	std::uint64_t index = 0;
+	auto* r = findRegion(address, index);
+	if (r == nullptr || (index + 1) * _wordSize > r->size)
+	{
+		return false;
+	}
+
+	auto raw = _image->getSegments()[r->segment]->getRawData();
+	auto dataSize = raw.first ? std::min(raw.second, r->dataSize) : 0;
+	word = readWord(raw.first, dataSize, index * _wordSize);
+	return true;
+}
+
+} // namespace loader
+} // namespace retdec
@@ -196,6 +196,22 @@ bool BreakMachOUniversal::extract(
 	return false;
 }
 
+/**
+ * Extract object by iterator into memory
+ * @param it object iterator
+ * @param result content of the object
+ * @return @c true if object was extracted successfully, @c false otherwise
+ */
+bool BreakMachOUniversal::extract(
+		llvm::object::MachOUniversalBinary::object_iterator &it,
+		std::vector<std::uint8_t> &result)
+{
+	auto start = reinterpret_cast<const std::uint8_t*>(
+			getFileBufferStart() + it->getOffset());
+	result.assign(start, start + it->getSize());
+	return true;
+}
+
 /**
  * Get file names of objects stored in archive
  * @param archOffset start of archive in Mach-O Universal Binary
@@ -454,6 +470,25 @@ bool BreakMachOUniversal::extractAllArchives()
 	return true;
 }
 
+/**
+ * Find archive with best architecture for decompilation
+ * @param res iterator to the first object, set to the found archive
+ * @return @c true if archive was found, @c false otherwise
+ */
+bool BreakMachOUniversal::getBestArchive(
+		llvm::object::MachOUniversalBinary::object_iterator &res)
+{
+	if(!getByArchFamily(CPU_TYPE_X86, res)
+			&& !getByArchFamily(CPU_TYPE_ARM, res)
+			&& !getByArchFamily(CPU_TYPE_POWERPC, res))
+	{
+		// If none of above, just pick first.
+		res = file->begin_objects();
+	}
+
+	return true;
+}
+
 /**
  * Extract archive with best architecture for decompilation
  * @param outPath output file path
@@ -468,15 +503,24 @@ bool BreakMachOUniversal::extractBestArchive(
 	}
 
 	auto obj = file->begin_objects();
-	if(getByArchFamily(CPU_TYPE_X86, obj)
-			|| getByArchFamily(CPU_TYPE_ARM, obj)
-			|| getByArchFamily(CPU_TYPE_POWERPC, obj))
+	return getBestArchive(obj) && extract(obj, outPath);
+}
+
+/**
+ * Extract archive with best architecture for decompilation into memory
+ * @param result content of the archive
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractBestArchive(
+		std::vector<std::uint8_t> &result)
+{
+	if(!file)
 	{
-		return extract(obj, outPath);
+		return false;
 	}
 
-	// If none of above, just pick first.
-	return extract(obj, outPath);
+	auto obj = file->begin_objects();
+	return getBestArchive(obj) && extract(obj, result);
 }
 
 /**
@@ -507,82 +551,114 @@ bool BreakMachOUniversal::extractArchiveWithIndex(
 }
 
 /**
- * Extract archive by architecture family
- * @param familyName  family name
- * @param outPath path to output file
- * @return @c true if extraction was successful, @c false otherwise
+ * Find archive by architecture family
+ * @param familyName family name
+ * @param res iterator to the first object, set to the found archive
+ * @return @c true if archive was found, @c false otherwise
  */
-bool BreakMachOUniversal::extractArchiveForFamily(
+bool BreakMachOUniversal::getArchiveForFamily(
 		const std::string &familyName,
-		const std::string &outPath)
+		llvm::object::MachOUniversalBinary::object_iterator &res)
 {
-	if(!file)
-	{
-		return false;
-	}
-
-	auto obj = file->begin_objects();
 	if(familyName == "x86")
 	{
-		if(getByArchFamily(CPU_TYPE_X86, obj))
+		if(getByArchFamily(CPU_TYPE_X86, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "arm" || familyName == "thumb")
 	{
 		// Same family
-		if(getByArchFamily(CPU_TYPE_ARM, obj))
+		if(getByArchFamily(CPU_TYPE_ARM, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "powerpc")
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC, obj))
+		if(getByArchFamily(CPU_TYPE_POWERPC, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "x86-64")
 	{
-		if(getByArchFamily(CPU_TYPE_X86_64, obj))
+		if(getByArchFamily(CPU_TYPE_X86_64, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "arm64")
 	{
-		if(getByArchFamily(CPU_TYPE_ARM64, obj))
+		if(getByArchFamily(CPU_TYPE_ARM64, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "powerpc64")
 	{
-		if(getByArchFamily(CPU_TYPE_POWERPC64, obj))
+		if(getByArchFamily(CPU_TYPE_POWERPC64, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "sparc")
 	{
-		if(getByArchFamily(CPU_TYPE_SPARC, obj))
+		if(getByArchFamily(CPU_TYPE_SPARC, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 	else if(familyName == "mc98000")
 	{
-		if(getByArchFamily(CPU_TYPE_MC98000, obj))
+		if(getByArchFamily(CPU_TYPE_MC98000, res))
 		{
-			return extract(obj, outPath);
+			return true;
 		}
 	}
 
 	return false;
 }
 
+/**
+ * Extract archive by architecture family
+ * @param familyName  family name
+ * @param outPath path to output file
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractArchiveForFamily(
+		const std::string &familyName,
+		const std::string &outPath)
+{
+	if(!file)
+	{
+		return false;
+	}
+
+	auto obj = file->begin_objects();
+	return getArchiveForFamily(familyName, obj) && extract(obj, outPath);
+}
+
+/**
+ * Extract archive by architecture family into memory
+ * @param familyName  family name
+ * @param result content of the archive
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractArchiveForFamily(
+		const std::string &familyName,
+		std::vector<std::uint8_t> &result)
+{
+	if(!file)
+	{
+		return false;
+	}
+
+	auto obj = file->begin_objects();
+	return getArchiveForFamily(familyName, obj) && extract(obj, result);
+}
+
 /**
  * Extract archive by architecture
  * @param machoArchName Mach-O specific architecture string
@@ -4,6 +4,9 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <string>
+#include <unordered_map>
+
 #include "pat2yara/compare.h"
 #include "pat2yara/utils.h"
 #include "yaramod/types/hex_string.h"
@@ -13,6 +16,9 @@ using namespace yaramod;
 
 namespace {
 
+/// Number of pattern units (nibbles) used as a key for grouping of rules.
+const std::size_t PATTERN_KEY_SIZE = 16;
+
 /**
  * Compare references.
  *
@@ -191,6 +197,45 @@ bool sortNamesPredicate(
 	return first < other;
 }
 
+/**
+ * Get key of rule pattern for grouping of rules with same patterns.
+ *
+ * Key is the beginning of the pattern. Patterns that are same in the sense of
+ * @c comparePatterns() and both have a key, have the same key.
+ *
+ * @param rule input rule
+ * @param key will be set to the key if @c true is returned
+ *
+ * @return @c true if key was created, @c false if pattern is missing, is
+ *         shorter than key, or there is a wild-card in its beginning
+ */
+bool getPatternKey(
+	const Rule* rule,
+	std::string &key)
+{
+	const auto pattern = getHexPattern(rule, "$1");
+	if (!pattern) {
+		return false;
+	}
+
+	const auto &units = pattern->getUnits();
+	if (units.size() < PATTERN_KEY_SIZE) {
+		return false;
+	}
+
+	key.clear();
+	for (std::size_t i = 0; i < PATTERN_KEY_SIZE; ++i) {
+		if (units[i]->isWildcard() || units[i]->isJump() || units[i]->isOr()) {
+			return false;
+		}
+
+		key += static_cast<char>(
+			std::static_pointer_cast<HexStringNibble>(units[i])->getValue());
+	}
+
+	return true;
+}
+
 } // anonymous namespace
 
 /**
@@ -350,19 +395,59 @@ std::vector<RuleRelations> getRuleRelationsFromRules(
 {
 	std::vector<RuleRelations> results;
 
+	// Indexes of relations grouped by keys of their base rules. A rule with
+	// a key can only be related to relations with the same key and relations
+	// without a key. The candidates are tried in the order of creation, so
+	// the result is the same as if all the relations were tried.
+	std::unordered_map<std::string, std::vector<std::size_t>> withKey;
+	std::vector<std::size_t> withoutKey;
+	const std::vector<std::size_t> noRelations;
+
+	std::string key;
 	for (const auto &rule : rules) {
 		// Look for related rules.
 		bool foundRelation = false;
-		for (auto &relation : results) {
-			if (relation.add(rule.get())) {
-				// Related rule was found.
-				foundRelation = true;
-				break;
+		bool hasKey = getPatternKey(rule.get(), key);
+		if (hasKey) {
+			auto it = withKey.find(key);
+			const auto &same = it != withKey.end() ? it->second : noRelations;
+
+			std::size_t i = 0, j = 0;
+			while (i < same.size() || j < withoutKey.size()) {
+				std::size_t index = 0;
+				if (j == withoutKey.size()
+						|| (i < same.size() && same[i] < withoutKey[j])) {
+					index = same[i++];
+				}
+				else {
+					index = withoutKey[j++];
+				}
+
+				if (results[index].add(rule.get())) {
+					// Related rule was found.
+					foundRelation = true;
+					break;
+				}
+			}
+		}
+		else {
+			for (auto &relation : results) {
+				if (relation.add(rule.get())) {
+					// Related rule was found.
+					foundRelation = true;
+					break;
+				}
 			}
 		}
 
 		// Create new entry if no related rule was found.
 		if (!foundRelation) {
+			if (hasKey) {
+				withKey[key].push_back(results.size());
+			}
+			else {
+				withoutKey.push_back(results.size());
+			}
 			results.emplace_back(RuleRelations(rule.get()));
 		}
 	}
@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -20,7 +21,8 @@ namespace pdbparser {
 // =================================================================
 
 /**
- * Loads PDB file into memory and separates all streams.
+ * Maps PDB file into memory and finds all streams.
+ * Stream data are extracted when they are needed for the first time.
  * Must be called before using of any method.
  * Can be called only once.
  * @param filename Name of PDB file to load.
@@ -31,22 +33,23 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 	if (pdb_loaded)
 		return PDB_STATE_ALREADY_LOADED;
 
-	// Load PDB file into memory
+	// Map PDB file into memory, pages are read by the system when accessed
 	pdb_filename = filename;
-	FILE *fp = fopen(filename,"rb");
-	if (fp == nullptr)
+	auto buffer = llvm::WritableMemoryBuffer::getFile(llvm::Twine(filename));
+	if (!buffer)
 	{
 		return PDB_STATE_ERR_FILE_OPEN;
 	}
-	fseek(fp, 0, SEEK_END);  // Determine file size
-	pdb_file_size = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	pdb_file_data = new char[pdb_file_size]; // Allocate memory
-	size_t result = fread(pdb_file_data,1,pdb_file_size,fp); // Read the file
-	fclose(fp);
-	if (result != pdb_file_size)
+	pdb_file_buffer = std::move(buffer.get());
+	if (pdb_file_buffer->getBufferSize() > UINT_MAX)
 	{
-		return PDB_STATE_ERR_FILE_OPEN;
+		return PDB_STATE_INVALID_FILE;
+	}
+	pdb_file_size = pdb_file_buffer->getBufferSize();
+	pdb_file_data = pdb_file_buffer->getBufferStart();
+	if (pdb_file_size < sizeof(PDB_HEADER))
+	{
+		return PDB_STATE_INVALID_FILE;
 	}
 
 	// Get the version of PDB file and parse it
@@ -64,9 +67,9 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 		pdb_version = PDB_VERSION_700;
 		state = load_pdb_v700();
 		// Get pointer to PDB info header
-		if (streams.size() > PDB_STREAM_PDB)
+		if (state == PDB_STATE_OK && streams.size() > PDB_STREAM_PDB)
 		{
-			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].data);
+			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(get_stream(PDB_STREAM_PDB)->data);
 		}
 		else
 		{
@@ -83,7 +86,8 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 }
 
 /**
- * Processes all PDB file streams and fills data containers.
+ * Processes DBI stream and fills modules and sections containers.
+ * Types and symbols are parsed later, when they are asked for.
  * Must be called after load_pdb_file() and before any getting and printing or dumping method.
  * Can be called only once.
  * @param image_base Base address of program's virtual memory.
@@ -95,10 +99,6 @@ void PDBFile::initialize(uint64_t image_base)
 		return;
 	}
 
-	// Initialize types
-	pdb_types = new PDBTypes(&streams[PDB_STREAM_TPI]);
-	pdb_types->parse_types();
-
 	// Check if DBI stream is present
 	bool dbi_present = (num_streams > PDB_STREAM_DBI && streams[PDB_STREAM_DBI].unused == false);
 
@@ -106,7 +106,7 @@ void PDBFile::initialize(uint64_t image_base)
 	{
 		// Get DBI stream
 		unsigned int pdb_dbi_size = streams[PDB_STREAM_DBI].size;
-		char * pdb_dbi_data = streams[PDB_STREAM_DBI].data;
+		char * pdb_dbi_data = get_stream(PDB_STREAM_DBI)->data;
 
 		// Get pointer to DBI header
 		dbi_header_v700 = reinterpret_cast<NewDBIHdr *>(pdb_dbi_data);
@@ -124,17 +124,46 @@ void PDBFile::initialize(uint64_t image_base)
 		if (image_base == 0)
 			image_base = 0x400000; // Default image base
 		parse_sections(image_base);
-
-		// Initialize symbols
-		int pdb_gsi_num = dbi_header_v700->snGSSyms;
-		int pdb_psi_num = dbi_header_v700->snPSSyms;
-		int pdb_sym_num = dbi_header_v700->snSymRecs;
-		pdb_symbols = new PDBSymbols(&streams[pdb_gsi_num],&streams[pdb_psi_num],&streams[pdb_sym_num],modules,sections,pdb_types);
-		pdb_symbols->parse_symbols();
 	}
 	pdb_initialized = true;
 }
 
+/**
+ * Gets stream with the given number. Data of a stream which is not linear in
+ * PDB file are extracted by the first call.
+ * Can be called after load_pdb_file() was executed
+ * @param num Stream number
+ * @return Stream or @c nullptr if there is no such stream
+ */
+PDBStream * PDBFile::get_stream(unsigned int num)
+{
+	if (num >= num_streams)
+		return nullptr;
+
+	PDBStream &stream = streams[num];
+	if (!stream.unused && stream.data == nullptr)
+	{
+		int pages_per_stream = (stream.size + page_size - 1) / page_size;
+		stream.data = extract_stream(stream.pages, pages_per_stream);
+	}
+	return &stream;
+}
+
+/**
+ * Gets records of IPI stream (function ids, build info, source lines of types).
+ * Records are not parsed, their offsets are found by the first request for a record.
+ * Can be called after initialize() was executed
+ * @return IPI records or @c nullptr if there is no IPI stream
+ */
+PDBTypeRecords * PDBFile::get_ipi_records(void)
+{
+	if (!pdb_initialized)
+		return nullptr;
+	if (pdb_ipi_records == nullptr && num_streams > PDB_STREAM_IPI && !streams[PDB_STREAM_IPI].unused)
+		pdb_ipi_records = new PDBTypeRecords(get_stream(PDB_STREAM_IPI));
+	return pdb_ipi_records;
+}
+
 /**
  * Saves all streams into separate files.
  * File names consist of input PDB file name and extension .xxx as stream number
@@ -154,7 +183,7 @@ bool PDBFile::save_streams_to_files(void)
 		if (fs == nullptr)
 			return false;
 		if (!streams[i].unused)
-			fwrite(streams[i].data,1,streams[i].size,fs);
+			fwrite(get_stream(i)->data,1,streams[i].size,fs);
 		fclose(fs);
 	}
 	return true;
@@ -240,7 +269,7 @@ void PDBFile::dump_FPO(void)
 		return;
 	}
 
-	PDBStream *pdb_fpo_stream = &streams[pdb_fpo_num];
+	PDBStream *pdb_fpo_stream = get_stream(pdb_fpo_num);
 	int fpoSize = pdb_fpo_stream->size;
 	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->data);
 
@@ -282,7 +311,7 @@ void PDBFile::dump_PE_sections(void)
 		return;
 	}
 
-	PDBStream *pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream *pdb_sect_stream = get_stream(pdb_sec_num);
 	PDB_PVOID pSect = pdb_sect_stream->data;
 	unsigned long sectSize = pdb_sect_stream->size;
 
@@ -305,8 +334,6 @@ void PDBFile::dump_PE_sections(void)
  */
 PDBFile::~PDBFile()
 {
-	if (pdb_file_data)
-		delete [] pdb_file_data;
 	// Delete all non-linear (copied) streams
 	for (unsigned int i = 0; i < num_streams;i++)
 		if (!streams[i].unused && !streams[i].linear)
@@ -315,6 +342,8 @@ PDBFile::~PDBFile()
 		delete pdb_types;
 	if (pdb_symbols)
 		delete pdb_symbols;
+	if (pdb_ipi_records)
+		delete pdb_ipi_records;
 }
 
 // =================================================================
@@ -396,10 +425,11 @@ PDBFileState PDBFile::load_pdb_v700(void)
 	streams.resize(num_streams);
 	int cur_pagedir_index = num_streams + 0;  // Skip dwords with stream sizes
 
-	// Extract each stream
+	// Find each stream
 	for (unsigned int i = 0; i < num_streams;i++)
 	{
 		streams[i].size = pdb_root_dir->V700.adStreamSizes[i];
+		streams[i].pages = nullptr;
 		// Stream is empty
 		if (streams[i].size <= 0)
 		{
@@ -412,16 +442,17 @@ PDBFileState PDBFile::load_pdb_v700(void)
 		{
 			streams[i].unused = false;
 			int pages_per_stream = (streams[i].size + page_size - 1) / page_size;
+			streams[i].pages = &pdb_root_dir->V700.adStreamSizes[cur_pagedir_index];
 			// Stream is linear in pdb file, we just get a pointer to it
-			if (stream_is_linear(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream))
+			if (stream_is_linear(streams[i].pages, pages_per_stream))
 			{
-				streams[i].data = pdb_file_data + pdb_root_dir->V700.adStreamSizes[cur_pagedir_index] * page_size;
+				streams[i].data = pdb_file_data + streams[i].pages[0] * page_size;
 				streams[i].linear = true;
 			}
-			// Stream is not linear in pdb file, we must copy it to linear memory
+			// Stream is not linear in pdb file, it is copied to linear memory by get_stream()
 			else
 			{
-				streams[i].data = extract_stream(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream);
+				streams[i].data = nullptr;
 				streams[i].linear = false;
 			}
 			cur_pagedir_index += pages_per_stream;  // Increase index to next stream
@@ -437,7 +468,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 void PDBFile::parse_modules(void)
 {
 	// Get DBI stream size and data
-	PDBStream * pdb_dbi_stream = &streams[PDB_STREAM_DBI];
+	PDBStream * pdb_dbi_stream = get_stream(PDB_STREAM_DBI);
 	unsigned int pdb_dbi_size = pdb_dbi_stream->size;
 	char * pdb_dbi_data = pdb_dbi_stream->data;
 
@@ -497,7 +528,7 @@ void PDBFile::parse_sections(uint64_t image_base)
 		return;
 
 	// Get stream with section info
-	PDBStream * pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream * pdb_sect_stream = get_stream(pdb_sec_num);
 	unsigned int pdb_sect_size = pdb_sect_stream->size;
 	char * pdb_sect_data = pdb_sect_stream->data;
 
@@ -527,5 +558,64 @@ void PDBFile::parse_sections(uint64_t image_base)
 	sections[0].file_address = max_code_sect;
 }
 
+/**
+ * Creates types container. Types are parsed when they are asked for.
+ */
+void PDBFile::create_types(void)
+{
+	if (!pdb_initialized || pdb_types != nullptr)
+		return;
+
+	pdb_types = new PDBTypes(get_stream(PDB_STREAM_TPI));
+}
+
+/**
+ * Creates symbols container. Symbols are parsed when they are asked for.
+ */
+void PDBFile::create_symbols(void)
+{
+	if (!pdb_initialized || pdb_symbols != nullptr || dbi_header_v700 == nullptr)
+		return;
+
+	// Symbols refer to types
+	create_types();
+
+	int pdb_gsi_num = dbi_header_v700->snGSSyms;
+	int pdb_psi_num = dbi_header_v700->snPSSyms;
+	int pdb_sym_num = dbi_header_v700->snSymRecs;
+	if (get_stream(pdb_sym_num) == nullptr)
+		return;
+	pdb_symbols = new PDBSymbols(get_stream(pdb_gsi_num),get_stream(pdb_psi_num),get_stream(pdb_sym_num),modules,sections,pdb_types);
+}
+
+/**
+ * Parses all types in TPI stream when all types are needed for the first time.
+ */
+void PDBFile::load_types(void)
+{
+	create_types();
+	if (pdb_types != nullptr)
+		pdb_types->parse_types();
+}
+
+/**
+ * Parses symbol and module streams when all symbols are needed for the first time.
+ * Types used by symbols are parsed on demand.
+ */
+void PDBFile::load_symbols(void)
+{
+	create_symbols();
+	if (pdb_symbols == nullptr || symbols_loaded)
+		return;
+
+	// Extract streams used by symbols
+	for (auto &module : modules)
+		if (module.stream != nullptr)
+			get_stream(module.stream_num);
+
+	pdb_symbols->parse_symbols();
+	symbols_loaded = true;
+}
+
 } // namespace pdbparser
 } // namespace retdec
@@ -403,6 +403,57 @@ void PDBSymbols::parse_symbols(void)
 	parsed = true;
 }
 
+/**
+ * Finds public symbol with the given name.
+ * Public and global symbols are indexed by the first lookup, nothing else is parsed.
+ * @param name Decorated name of symbol
+ * @param pub Found symbol is stored here
+ * @return Symbol was found
+ */
+bool PDBSymbols::find_public_symbol(const std::string &name, PDBPublicSymbol &pub)
+{
+	index_symbols();
+	PDBSymbolNameIndex::iterator it = public_symbols.find(name);
+	if (it == public_symbols.end())
+		return false;
+
+	PUBSYM32 * sym = reinterpret_cast<PUBSYM32 *>(pdb_sym_data + it->second);
+	pub.name = reinterpret_cast<char *>(sym->name);
+	pub.address = get_virtual_address(sym->seg, sym->off);
+	pub.offset = sym->off;
+	pub.section = sym->seg;
+	pub.is_function = sym->pubsymflags.fFunction;
+	return true;
+}
+
+/**
+ * Finds global variable with the given name.
+ * Public and global symbols are indexed by the first lookup, only the type of
+ * found variable is parsed.
+ * @param name Name of variable
+ * @param var Found variable is stored here
+ * @return Variable was found
+ */
+bool PDBSymbols::find_global_variable(const std::string &name, PDBGlobalVariable &var)
+{
+	index_symbols();
+	PDBSymbolNameIndex::iterator it = global_symbols.find(name);
+	if (it == global_symbols.end())
+		return false;
+
+	DATASYM32 * sym = reinterpret_cast<DATASYM32 *>(pdb_sym_data + it->second);
+	var =
+	{reinterpret_cast<char *>(sym->name),  // Name
+	        get_virtual_address(sym->seg, sym->off),  // Address
+	        sym->off,  // Offset
+	        sym->seg,  // Section
+	        -1,  // Module index
+	        sym->typind,  // Type index
+	        types->get_type_by_index(sym->typind),  // Type definition
+	        };
+	return true;
+}
+
 void PDBSymbols::dump_global_symbols(void)
 {
 	unsigned int position = 0;
@@ -798,6 +849,37 @@ PDBSymbols::~PDBSymbols(void)
 // PRIVATE METHODS
 // =================================================================
 
+/**
+ * Indexes public symbols and global variables in SYM stream by their names.
+ * Only headers and names of symbols are read.
+ */
+void PDBSymbols::index_symbols(void)
+{
+	if (indexed)
+		return;
+	indexed = true;
+
+	unsigned int position = 0;
+	while (position + 4 <= pdb_sym_size)
+	{
+		PDBGeneralSymbol *symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_sym_data + position);
+		if (symbol->size == 0 || position + symbol->size + 2 > pdb_sym_size)
+			break;  // Corrupted stream
+		const char * end = pdb_sym_data + position + symbol->size + 2;
+		if (symbol->type == S_PUB32 && unsigned(symbol->size) + 2 > PUBSYM32_ - 1)
+		{
+			const char * name = reinterpret_cast<char *>(reinterpret_cast<PUBSYM32 *>(symbol)->name);
+			public_symbols.emplace(std::string_view(name, strnlen(name, end - name)), position);
+		}
+		else if (symbol->type == S_GDATA32 && unsigned(symbol->size) + 2 > DATASYM32_ - 1)
+		{
+			const char * name = reinterpret_cast<char *>(reinterpret_cast<DATASYM32 *>(symbol)->name);
+			global_symbols.emplace(std::string_view(name, strnlen(name, end - name)), position);
+		}
+		position += symbol->size + 2;
+	}
+}
+
 void PDBSymbols::dump_symbol(PSYM Sym)
 {
 	switch (Sym->Sym.rectyp)
@@ -1063,15 +1063,160 @@ bool DisplayTypes(char * ptSource, int ptSize)
 	return fOk;
 }
 
+// =================================================================
+//
+// CLASS PDBTypeRecords
+//
+// =================================================================
+
+PDBTypeRecords::PDBTypeRecords(PDBStream *s) :
+		stream_size(0), stream_data(nullptr), min_index(0), max_index(0), indexed(false)
+{
+	if (s == nullptr || s->data == nullptr || s->size < int(sizeof(HDR)))
+		return;
+
+	HDR * header = reinterpret_cast<HDR *>(s->data);
+	stream_size = s->size;
+	stream_data = s->data;
+	min_index = header->tiMin;
+	max_index = header->tiMac;
+}
+
+/**
+ * Gets number of records in the stream.
+ * Offsets of all records are found by the first call.
+ */
+unsigned int PDBTypeRecords::get_records_count(void)
+{
+	index_records();
+	return offsets.size();
+}
+
+/**
+ * Gets record with the given type index.
+ * Offsets of all records are found by the first call.
+ * @param index Type index
+ * @param size If not @c nullptr, set to size of record data
+ * @return Record or @c nullptr if there is no such record
+ */
+lfRecord * PDBTypeRecords::get_record(unsigned int index, unsigned int *size)
+{
+	index_records();
+	if (index < min_index || index - min_index >= offsets.size())
+		return nullptr;
+
+	unsigned int offset = offsets[index - min_index];
+	PDBGeneralSymbol * symbol = reinterpret_cast<PDBGeneralSymbol *>(stream_data + offset);
+	if (size != nullptr)
+		*size = symbol->size;
+	return reinterpret_cast<lfRecord *>(stream_data + offset + 2);
+}
+
+/**
+ * Finds offsets of all records in the stream. Only sizes of records are read.
+ */
+void PDBTypeRecords::index_records(void)
+{
+	if (indexed)
+		return;
+	indexed = true;
+
+	if (max_index > min_index)
+		offsets.reserve(max_index - min_index);
+	unsigned int position = sizeof(HDR);
+	while (position + 4 <= stream_size && min_index + offsets.size() < max_index)
+	{  // Find all records in stream, each begins with its size
+		PDBGeneralSymbol * symbol = reinterpret_cast<PDBGeneralSymbol *>(stream_data + position);
+		if (position + symbol->size + 2 > stream_size)
+			break;  // Truncated record
+		offsets.push_back(position);
+		position += symbol->size + 2;  // Go to next record
+	}
+}
+
+// =================================================================
+//
+// MAIN CLASS PDBTypes
+//
+// =================================================================
+
 // =================================================================
 // PUBLIC METHODS
 // =================================================================
 
+/**
+ * Parses all type records in TPI stream.
+ * Types already parsed by get_type_by_index() are kept.
+ */
 void PDBTypes::parse_types(void)
 {
 	if (parsed)
 		return;
-	// Base types
+
+	init_base_types();
+
+	// User-defined types
+	unsigned int count = records.get_records_count();
+	for (unsigned int i = 0; i < count; i++)
+	{  // Process all data-type records in TPI stream
+		int index = records.get_min_index() + i;
+		PDBTypeDefIndexMap::iterator it = types.find(index);
+		if (it != types.end() && it->second != nullptr)
+			continue;  // Already parsed
+		unsigned int size = 0;
+		lfRecord * record = records.get_record(index, &size);
+		parse_type(index, record, size);
+	}
+	parsed = true;
+}
+
+void PDBTypes::dump_types(void)
+{
+	puts("******* TPI list of types (dump) *******");
+	DisplayTypes(pdb_tpi_data, pdb_tpi_size);
+	puts("");
+}
+
+void PDBTypes::print_types(void)
+{
+	puts("******* TPI list of types (parsed types) *******");
+	if (!parsed)
+	{
+		puts("Types not parsed yet!\n");
+		return;
+	}
+	for (PDBTypeDefIndexMap::iterator it = types_fully_defined.begin(); it != types_fully_defined.end(); ++it)
+	{
+		if (it->second != nullptr)
+		{
+			it->second->dump();
+			puts("");
+		}
+	}
+	puts("");
+}
+
+PDBTypes::~PDBTypes(void)
+{
+	for (PDBTypeDefIndexMap::iterator it = types.begin(); it != types.end(); ++it)
+	{  // Delete all parsed types
+		if (it->second != nullptr)
+			delete it->second;
+	}
+}
+
+// =================================================================
+// PRIVATE METHODS
+// =================================================================
+
+/**
+ * Creates definitions of base types (type indexes below the first record).
+ */
+void PDBTypes::init_base_types(void)
+{
+	if (types.find(T_VOID) != types.end())
+		return;
+
 	types[T_NOTYPE] = new PDBTypeBase(0x00000000, PDBBASETYPE_VARIADIC, false, 0, "...");
 	types[T_VOID] = new PDBTypeBase(0x00000003, PDBBASETYPE_VOID, false, 0, "void");
 	types[T_32PVOID] = new PDBTypeBase(0x00000403, PDBBASETYPE_VOID, true, 0, "void *");
@@ -1134,156 +1279,236 @@ void PDBTypes::parse_types(void)
 	types[T_BOOL64] = new PDBTypeBase(0x00000033, PDBBASETYPE_BOOL, false, 64, "bool");
 	types[T_32PBOOL64] = new PDBTypeBase(0x00000433, PDBBASETYPE_BOOL, true, 64, "bool *");
 	// NCVPTR
+}
 
-	// User-defined types
-	unsigned int position = sizeof(HDR);
-	int index = tpi_header->tiMin;
-	while (position < pdb_tpi_size)
-	{  // Process all data-type records in TPI stream
-		PDBGeneralSymbol * symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_tpi_data + position);
-		lfRecord * record = reinterpret_cast<lfRecord *>(pdb_tpi_data + position + 2);
-
-		switch (record->leaf)
+/**
+ * Parses type with the given index without parsing all types.
+ * Types the type refers to are parsed first, so that the result is the same
+ * as if all types were parsed by parse_types().
+ * @param index Type index
+ * @return Type definition or @c nullptr if there is no such type
+ */
+PDBTypeDef * PDBTypes::load_type(int index)
+{
+	init_base_types();
+	PDBTypeDefIndexMap::iterator it = types.find(index);
+	if (it != types.end() && it->second != nullptr)
+		return it->second;
+	if (index < int(records.get_min_index()) || records.get_record(index) == nullptr)
+		return nullptr;
+
+	// Depth-first walk over referenced types, the second visit of a type
+	// parses it (all types it refers to are parsed by then)
+	std::vector<std::pair<int, bool>> stack = {{index, false}};
+	while (!stack.empty())
+	{
+		int cur = stack.back().first;
+		it = types.find(cur);
+		if (it != types.end() && it->second != nullptr)
+		{  // Already parsed
+			stack.pop_back();
+			continue;
+		}
+		unsigned int size = 0;
+		lfRecord * record = records.get_record(cur, &size);
+		if (!stack.back().second)
 		{
-			case LF_FIELDLIST:
-			{
-				PDBTypeFieldList *new_type = new PDBTypeFieldList(index);
-				new_type->parse(&record->FieldList, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_ENUM:
-			{
-				PDBTypeEnum *new_type = new PDBTypeEnum(index);
-				new_type->parse(&record->Enum, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->enum_name] = new_type;
-				}
-				break;
+			stack.back().second = true;
+			std::vector<int> refs;
+			get_referenced_types(cur, record, size, refs);
+			for (int ref : refs)
+			{  // Records may refer only to the preceding records
+				if (ref >= int(records.get_min_index()) && ref < cur)
+					stack.push_back({ref, false});
 			}
-			case LF_ARRAY:
-			{
-				PDBTypeArray *new_type = new PDBTypeArray(index);
-				new_type->parse(&record->Array, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_POINTER:
-			{
-				PDBTypePointer *new_type = new PDBTypePointer(index);
-				new_type->parse(&record->Pointer, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_MODIFIER:
-			{
-				PDBTypeConst *new_type = new PDBTypeConst(index);
-				new_type->parse(&record->Modifier, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_ARGLIST:
-			{
-				PDBTypeArglist *new_type = new PDBTypeArglist(index);
-				new_type->parse(&record->ArgList, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_PROCEDURE:
-			{
-				PDBTypeFunction *new_type = new PDBTypeFunction(index);
-				new_type->parse(&record->Proc, symbol->size, types);
-				types[index] = new_type;
-				break;
-			}
-			case LF_MFUNCTION:
+		}
+		else
+		{
+			stack.pop_back();
+			parse_type(cur, record, size);
+		}
+	}
+
+	it = types.find(index);
+	return (it != types.end()) ? it->second : nullptr;
+}
+
+/**
+ * Parses one type record and adds it into containers.
+ * @param index Type index
+ * @param record Type record
+ * @param size Size of record data
+ */
+void PDBTypes::parse_type(int index, lfRecord *record, int size)
+{
+	if (record == nullptr)
+		return;
+
+	switch (record->leaf)
+	{
+		case LF_FIELDLIST:
+		{
+			PDBTypeFieldList *new_type = new PDBTypeFieldList(index);
+			new_type->parse(&record->FieldList, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_ENUM:
+		{
+			PDBTypeEnum *new_type = new PDBTypeEnum(index);
+			new_type->parse(&record->Enum, size, types);
+			types[index] = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeFunction *new_type = new PDBTypeFunction(index);
-				new_type->parse_mfunc(&record->MFunc, symbol->size, types);
-				types[index] = new_type;
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->enum_name] = new_type;
 			}
-			case LF_STRUCTURE:
+			break;
+		}
+		case LF_ARRAY:
+		{
+			PDBTypeArray *new_type = new PDBTypeArray(index);
+			new_type->parse(&record->Array, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_POINTER:
+		{
+			PDBTypePointer *new_type = new PDBTypePointer(index);
+			new_type->parse(&record->Pointer, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_MODIFIER:
+		{
+			PDBTypeConst *new_type = new PDBTypeConst(index);
+			new_type->parse(&record->Modifier, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_ARGLIST:
+		{
+			PDBTypeArglist *new_type = new PDBTypeArglist(index);
+			new_type->parse(&record->ArgList, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_PROCEDURE:
+		{
+			PDBTypeFunction *new_type = new PDBTypeFunction(index);
+			new_type->parse(&record->Proc, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_MFUNCTION:
+		{
+			PDBTypeFunction *new_type = new PDBTypeFunction(index);
+			new_type->parse_mfunc(&record->MFunc, size, types);
+			types[index] = new_type;
+			break;
+		}
+		case LF_STRUCTURE:
+		{
+			PDBTypeStruct *new_type = new PDBTypeStruct(index);
+			new_type->parse(&record->Structure, size, types);
+			types[index] = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeStruct *new_type = new PDBTypeStruct(index);
-				new_type->parse(&record->Structure, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->struct_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->struct_name] = new_type;
 			}
-			case LF_UNION:
+			break;
+		}
+		case LF_UNION:
+		{
+			PDBTypeUnion *new_type = new PDBTypeUnion(index);
+			new_type->parse(&record->Union, size, types);
+			types[index] = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeUnion *new_type = new PDBTypeUnion(index);
-				new_type->parse(&record->Union, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->union_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->union_name] = new_type;
 			}
-			case LF_CLASS:
+			break;
+		}
+		case LF_CLASS:
+		{
+			PDBTypeClass *new_type = new PDBTypeClass(index);
+			new_type->parse(&record->Class, size, types);
+			types[index] = new_type;
+			if (new_type->is_fully_defined())
 			{
-				PDBTypeClass *new_type = new PDBTypeClass(index);
-				new_type->parse(&record->Class, symbol->size, types);
-				types[index] = new_type;
-				if (new_type->is_fully_defined())
-				{
-					types_fully_defined[index] = new_type;
-					types_byname[new_type->class_name] = new_type;
-				}
-				break;
+				types_fully_defined[index] = new_type;
+				types_byname[new_type->class_name] = new_type;
 			}
-			default:
-				break;
+			break;
 		}
-
-		position += symbol->size + 2;  // Go to next record
-		index++;
+		default:
+			break;
 	}
-	parsed = true;
 }
 
-void PDBTypes::dump_types(void)
-{
-	puts("******* TPI list of types (dump) *******");
-	DisplayTypes(pdb_tpi_data, pdb_tpi_size);
-	puts("");
-}
-
-void PDBTypes::print_types(void)
+/**
+ * Gets indexes of types the given type record refers to.
+ * @param index Type index
+ * @param record Type record
+ * @param size Size of record data
+ * @param refs Indexes of referenced types are added here
+ */
+void PDBTypes::get_referenced_types(int index, lfRecord *record, int size, std::vector<int> &refs)
 {
-	puts("******* TPI list of types (parsed types) *******");
-	if (!parsed)
-	{
-		puts("Types not parsed yet!\n");
+	if (record == nullptr)
 		return;
-	}
-	for (PDBTypeDefIndexMap::iterator it = types_fully_defined.begin(); it != types_fully_defined.end(); ++it)
+
+	switch (record->leaf)
 	{
-		if (it->second != nullptr)
-		{
-			it->second->dump();
-			puts("");
+		case LF_FIELDLIST:
+		{  // Types of struct members, parsed into an auxiliary field list
+			PDBTypeDefIndexMap no_types;
+			PDBTypeFieldList fieldlist(index);
+			fieldlist.parse(&record->FieldList, size, no_types);
+			for (auto &field : fieldlist.fields)
+				if (field.field_type == PDBFIELD_MEMBER)
+					refs.push_back(field.Member.type_index);
+			break;
 		}
-	}
-	puts("");
-}
-
-PDBTypes::~PDBTypes(void)
-{
-	for (PDBTypeDefIndexMap::iterator it = types.begin(); it != types.end(); ++it)
-	{  // Delete all parsed types
-		if (it->second != nullptr)
-			delete it->second;
+		case LF_ENUM:
+			refs.push_back(record->Enum.utype);
+			refs.push_back(record->Enum.field);
+			break;
+		case LF_ARRAY:
+			refs.push_back(record->Array.elemtype);
+			refs.push_back(record->Array.idxtype);
+			break;
+		case LF_POINTER:
+			refs.push_back(record->Pointer.body.utype);
+			break;
+		case LF_MODIFIER:
+			refs.push_back(record->Modifier.utype);
+			break;
+		case LF_ARGLIST:
+			for (unsigned int i = 0; i < record->ArgList.count && 6 + 4 * i + 4 <= unsigned(size); i++)
+				refs.push_back(record->ArgList.arg[i]);
+			break;
+		case LF_PROCEDURE:
+			refs.push_back(record->Proc.rvtype);
+			refs.push_back(record->Proc.arglist);
+			break;
+		case LF_MFUNCTION:
+			refs.push_back(record->MFunc.rvtype);
+			refs.push_back(record->MFunc.classtype);
+			refs.push_back(record->MFunc.thistype);
+			refs.push_back(record->MFunc.arglist);
+			break;
+		case LF_STRUCTURE:
+		case LF_CLASS:
+			refs.push_back(record->Structure.field);
+			break;
+		case LF_UNION:
+			refs.push_back(record->Union.field);
+			break;
+		default:
+			break;
 	}
 }
 
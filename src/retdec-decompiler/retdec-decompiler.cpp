@@ -4,6 +4,9 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <fstream>
 #include <future>
 #include <chrono>
@@ -43,12 +46,19 @@
 #include "retdec/macho-extractor/break_fat.h"
 #include "retdec/unpackertool/unpackertool.h"
 #include "retdec/utils/binary_path.h"
+#include "retdec/utils/file_io.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/io/log.h"
 #include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
+#include "retdec/utils/parallel.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/version.h"
 
+#ifdef OS_POSIX
+#include <sys/wait.h>
+#endif
+
 using namespace retdec::utils::io;
 
 const int EXIT_TIMEOUT = 137;
@@ -73,8 +83,11 @@ class ProgramOptions
 		std::string arExtractPath;
 		std::string arName;
 		std::optional<uint64_t> arIdx;
+		bool arAll = false;
+		std::string arMembersPath;
 
 		bool cleanup = false;
+		bool keepExtracted = false;
 		std::set<std::string> toClean;
 
 	public:
@@ -265,7 +278,10 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	else if (isParam(i, "-f", "--output-format"))
 	{
 		auto of = getParamOrDie(i);
-		if (!(of == "plain" || of == "json" || of == "json-human"))
+		if (!(of == "plain"
+				|| of == "json"
+				|| of == "json-human"
+				|| of == "json-lines"))
 		{
 			throw std::runtime_error(
 				"[-f|--output-format] unknown output format: " + of
@@ -309,6 +325,7 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 		params.setOutputConfigFile(out + ".config.json");
 		params.setOutputUnpackedFile(out + "-unpacked");
 		arExtractPath = out + "-extracted";
+		arMembersPath = out + "-members";
 	}
 	else if (isParam(i, "-k", "--keep-unreachable-funcs"))
 	{
@@ -383,6 +400,10 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	{
 		cleanup = true;
 	}
+	else if (isParam(i, "", "--keep-extracted"))
+	{
+		keepExtracted = true;
+	}
 	else if (isParam(i, "", "--config"))
 	{
 		getParamOrDie(i);
@@ -392,6 +413,10 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	{
 		params.setIsDetectStaticCode(false);
 	}
+	else if (isParam(i, "", "--pre-disassemble"))
+	{
+		params.setIsPreDisassemble(true);
+	}
 	else if (isParam(i, "", "--backend-disabled-opts"))
 	{
 		params.setBackendDisabledOpts(getParamOrDie(i));
@@ -426,6 +451,17 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 		}
 		params.setBackendVarRenamer(s);
 	}
+	else if (isParam(i, "", "--backend-alias-analysis"))
+	{
+		auto a = getParamOrDie(i);
+		if (!(a == "simple" || a == "basic" || a == "steensgaard"))
+		{
+			throw std::runtime_error(
+				"[--backend-alias-analysis] unknown analysis: " + a
+			);
+		}
+		params.setBackendAliasAnalysis(a);
+	}
 	else if (isParam(i, "", "--backend-no-opts"))
 	{
 		params.setIsBackendNoOpts(true);
@@ -434,6 +470,17 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	{
 		params.setIsBackendEmitCfg(true);
 	}
+	else if (isParam(i, "", "--backend-cfg-format"))
+	{
+		auto f = getParamOrDie(i);
+		if (!(f == "dot" || f == "json-lines"))
+		{
+			throw std::runtime_error(
+				"[--backend-cfg-format] unknown format: " + f
+			);
+		}
+		params.setBackendCfgFormat(f);
+	}
 	else if (isParam(i, "", "--backend-emit-cg"))
 	{
 		params.setIsBackendEmitCg(true);
@@ -496,6 +543,10 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 
 		arName = getParamOrDie(i);
 	}
+	else if (isParam(i, "", "--ar-all"))
+	{
+		arAll = true;
+	}
 	else if (isParam(i, "", "--static-code-sigfile"))
 	{
 		auto file = checkFile(getParamOrDie(i), "[--static-code-sigfile]");
@@ -515,6 +566,20 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 			);
 		}
 	}
+	else if (isParam(i, "-j", "--threads"))
+	{
+		auto t = getParamOrDie(i);
+		try
+		{
+			params.setThreads(std::stoull(t));
+		}
+		catch (...)
+		{
+			throw std::runtime_error(
+				"[--threads] invalid number of threads: " + t
+			);
+		}
+	}
 	else if (isParam(i, "-s", "--silent"))
 	{
 		params.setIsVerboseOutput(false);
@@ -549,6 +614,8 @@ void ProgramOptions::afterLoad()
 	{
 		if (params.getOutputFormat() == "plain")
 			params.setOutputFile(in + ".c");
+		else if (params.getOutputFormat() == "json-lines")
+			params.setOutputFile(in + ".c.jsonl");
 		else
 			params.setOutputFile(in + ".c.json");
 	}
@@ -556,6 +623,15 @@ void ProgramOptions::afterLoad()
 		params.setOutputUnpackedFile(in + "-unpacked");
 	if (arExtractPath.empty())
 		arExtractPath = in + "-extracted";
+	if (arMembersPath.empty())
+		arMembersPath = in + "-members";
+
+	if (arAll && (arIdx.has_value() || !arName.empty()))
+	{
+		throw std::runtime_error(
+			"[--ar-all] cannot be used together with [--ar-index] or [--ar-name]"
+		);
+	}
 
 	if (mode == "raw")
 	{
@@ -616,15 +692,17 @@ void ProgramOptions::printHelpAndDie()
 Mandatory arguments:
 	INPUT_FILE File to decompile.
 General arguments:
-	[-o|--output FILE] Output file (default: INPUT_FILE.c if OUTPUT_FORMAT is plain, INPUT_FILE.c.json if OUTPUT_FORMAT is json|json-human).
+	[-o|--output FILE] Output file (default: INPUT_FILE.c if OUTPUT_FORMAT is plain, INPUT_FILE.c.json if OUTPUT_FORMAT is json|json-human, INPUT_FILE.c.jsonl if OUTPUT_FORMAT is json-lines).
 	[-s|--silent] Turns off informative output of the decompilation.
-	[-f|--output-format OUTPUT_FORMAT] Output format [plain|json|json-human] (default: plain).
+	[-f|--output-format OUTPUT_FORMAT] Output format [plain|json|json-human|json-lines] (default: plain).
+		json-lines emits one JSON object per line: declarations, each function, and the rest.
 	[-m|--mode MODE] Force the type of decompilation mode [bin|raw] (default: bin).
 	[-p|--pdb FILE] File with PDB debug information.
 	[-k|--keep-unreachable-funcs] Keep functions that are unreachable from the main function.
 	[--cleanup] Removes temporary files created during the decompilation.
 	[--config] Specify JSON decompilation configuration file.
 	[--disable-static-code-detection] Prevents detection of statically linked code.
+	[--pre-disassemble] Disassembles all code in parallel before decoding (uses --threads threads).
 Selective decompilation arguments:
 	[--select-ranges RANGES] Specify a comma separated list of ranges to decompile (example: 0x100-0x200,0x300-0x400,0x500-0x600).
 	[--select-functions FUNCS] Specify a comma separated list of functions to decompile (example: fnc1,fnc2,fnc3).
@@ -641,14 +719,26 @@ Raw or Intel HEX decompilation arguments:
 Archive decompilation arguments:
 	[--ar-index INDEX] Pick file from archive for decompilation by its zero-based index.
 	[--ar-name NAME] Pick file from archive for decompilation by its name.
+	[--ar-all] Decompile all files from archive, each one in a separate process (runs up to --threads processes at once).
+	           Outputs, logs, and an index (index.txt) are stored into the directory named as the output file
+	           without its extension with the -members suffix (default: INPUT_FILE-members).
+	           The memory limit is divided among the running processes.
+	[--keep-extracted] Stores the extracted Mach-O slice and archive file to the disk (by default, they are decompiled from memory).
+	                   Packed files are an exception: they are always unpacked through temporary files
+	                   (INPUT_FILE-extracted_packed and INPUT_FILE-unpacked) because the unpacker works with files.
 	[--static-code-sigfile FILE] Adds additional signature file for static code detection.
 Backend arguments:
 	[--backend-disabled-opts LIST] Prevents the optimizations from the given comma-separated list of optimizations to be run.
 	[--backend-enabled-opts LIST] Runs only the optimizations from the given comma-separated list of optimizations.
 	[--backend-call-info-obtainer NAME] Name of the obtainer of information about function calls [optim|pessim] (Default: optim).
 	[--backend-var-renamer STYLE] Used renamer of variables [address|hungarian|readable|simple|unified] (Default: readable).
+	[--backend-alias-analysis ANALYSIS] Used alias analysis [simple|basic|steensgaard] (Default: simple).
 	[--backend-no-opts] Disables backend optimizations.
 	[--backend-emit-cfg] Emits a CFG for each function in the backend IR (in the .dot format).
+	[--backend-cfg-format FORMAT] Format of the emitted CFGs [dot|json-lines] (Default: dot).
+	                              dot: a file OUTPUT_FILE.cfg.FUNCTION.dot for each function.
+	                              json-lines: a single file OUTPUT_FILE.cfg.jsonl with one JSON object per function,
+	                              followed by an index line with the byte offset of each function's object.
 	[--backend-emit-cg] Emits a CG for the decompiled module in the backend IR (in the .dot format).
 	[--backend-keep-all-brackets] Keeps all brackets in the generated code.
 	[--backend-keep-library-funcs] Keep functions from standard libraries.
@@ -658,6 +748,7 @@ Backend arguments:
 	[--backend-no-symbolic-names] Disables the conversion of constant arguments to their symbolic names.
 Decompilation process arguments:
 	[--timeout SECONDS]
+	[-j|--threads N] Maximal number of threads used by parallelized phases, 0 means all hardware threads (default: 1).
 	[--max-memory MAX_MEMORY] Limits the maximal memory used by the given number of bytes.
 	[--no-memory-limit] Disables the default memory limit (half of system RAM).
 LLVM IR debug arguments:
@@ -790,10 +881,220 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
+/**
+ * Store the content of an extracted file to the disk.
+ */
+void storeExtracted(
+		const std::string& path,
+		const std::vector<std::uint8_t>& data,
+		ProgramOptions& po)
+{
+	if (!retdec::utils::writeFile(path, data))
+	{
+		throw std::runtime_error("failed to write extracted file: " + path);
+	}
+	po.toClean.insert(path);
+}
+
+/**
+ * Unpack \p inputFile into \p outputFile.
+ * \return \c true if the file was unpacked, \c false otherwise.
+ */
+bool unpack(const std::string& inputFile, const std::string& outputFile)
+{
+	std::vector<std::string> unpackArgs;
+	unpackArgs.push_back("whatever_program_name");
+	unpackArgs.push_back(inputFile);
+	unpackArgs.push_back("--output");
+	unpackArgs.push_back(outputFile);
+	char* uargv[4] = {
+			unpackArgs[0].data(),
+			unpackArgs[1].data(),
+			unpackArgs[2].data(),
+			unpackArgs[3].data()
+	};
+	auto unpackCode = retdec::unpackertool::_main(4, uargv);
+	return unpackCode == 0; // EXIT_CODE_OK
+}
+
+/**
+ * Quote \p arg so that it is passed as a single argument to a program run by
+ * \c std::system().
+ */
+std::string quoteArgument(const std::string& arg)
+{
+#ifdef OS_WINDOWS
+	return retdec::utils::quoteWindowsShellArgument(arg);
+#else
+	return retdec::utils::quotePosixShellArgument(arg);
+#endif
+}
+
+/**
+ * Run \p command by the system shell.
+ * \return Exit code of the command, or \c -1 if it could not be run.
+ */
+int runCommand(const std::string& command)
+{
+	// On Windows, the command does not start with a plain double quote
+	// (see quoteArgument()), so cmd.exe does not strip any quotes from it.
+	auto status = std::system(command.c_str());
+#ifdef OS_POSIX
+	if (status == -1 || !WIFEXITED(status))
+	{
+		return -1;
+	}
+	status = WEXITSTATUS(status);
+#endif
+	return status;
+}
+
+/**
+ * Get a name of an archive member that can be used in a file name.
+ */
+std::string getMemberFileName(const std::string& name)
+{
+	std::string result;
+	for (unsigned char c : name)
+	{
+		result += std::isalnum(c) || c == '.' || c == '-' ? char(c) : '_';
+	}
+	return result;
+}
+
+/**
+ * Decompile all members of the archive \p arw.
+ *
+ * The decompiler keeps its state in global objects, so the members are not
+ * decompiled in threads of this process. Each member is decompiled by a new
+ * instance of this program instead, which is run with the same arguments plus
+ * \c --ar-index. At most \c --threads instances run at once and the memory
+ * limit is divided among them. Outputs and logs of the members are stored to
+ * \c ProgramOptions::arMembersPath together with an index of the members.
+ *
+ * \return \c EXIT_SUCCESS if all the members were decompiled.
+ */
+int decompileArchiveMembers(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		const retdec::ar_extractor::ArchiveWrapper& arw)
+{
+	Log::phase("Archive decompilation");
+
+	if (arw.isThinArchive())
+	{
+		throw std::runtime_error(
+				"File is a thin archive and cannot be decompiled."
+		);
+	}
+
+	std::string errMsg;
+	std::vector<std::string> names;
+	if (!arw.getNames(names, errMsg))
+	{
+		throw std::runtime_error("failed to read archive: " + errMsg);
+	}
+	if (names.empty())
+	{
+		throw std::runtime_error("The input archive is empty.");
+	}
+
+	std::error_code ec;
+	fs::create_directories(po.arMembersPath, ec);
+	if (ec)
+	{
+		throw std::runtime_error(
+				"failed to create directory: " + po.arMembersPath
+		);
+	}
+
+	auto& params = config.parameters;
+	std::size_t jobs = std::min(
+			retdec::utils::getThreadCount(params.getThreads()),
+			names.size()
+	);
+	std::uint64_t memory = params.isMaxMemoryLimitHalfRam()
+			? retdec::utils::getTotalSystemMemory() / 2
+			: params.getMaxMemoryLimit();
+
+	std::string outputSuffix = ".c";
+	if (params.getOutputFormat() == "json-lines")
+		outputSuffix = ".c.jsonl";
+	else if (params.getOutputFormat() != "plain")
+		outputSuffix = ".c.json";
+
+	// Arguments given later override the original ones. The instances do not
+	// run parallelized phases, the members themselves are run in parallel.
+	std::string command = quoteArgument(
+			retdec::utils::getThisBinaryPath().string()
+	);
+	for (auto& arg : po._argv)
+	{
+		if (arg != "--ar-all")
+		{
+			command += " " + quoteArgument(arg);
+		}
+	}
+	command += " --threads 1";
+	if (memory > 0)
+	{
+		command += " --max-memory " + std::to_string(memory / jobs);
+	}
+
+	Log::info() << "Decompiling " << names.size()
+			<< " files using " << jobs << " processes" << std::endl;
+
+	std::vector<std::string> outputs(names.size());
+	std::vector<int> results(names.size());
+	retdec::utils::parallelFor(names.size(), jobs, [&](std::size_t i)
+	{
+		auto base = po.arMembersPath + "/" + std::to_string(i)
+				+ "-" + getMemberFileName(names[i]);
+		outputs[i] = base + outputSuffix;
+		results[i] = runCommand(command
+				+ " --ar-index " + std::to_string(i)
+				+ " -o " + quoteArgument(outputs[i])
+				+ " > " + quoteArgument(base + ".log") + " 2>&1"
+		);
+	});
+
+	auto indexFile = po.arMembersPath + "/index.txt";
+	std::ofstream index(indexFile);
+	std::size_t failed = 0;
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		index << i << "\t" << names[i] << "\t" << results[i]
+				<< "\t" << outputs[i] << "\n";
+		if (results[i] != EXIT_SUCCESS)
+		{
+			++failed;
+			Log::error() << "Decompilation of file " << i << " ("
+					<< names[i] << ") failed with exit code "
+					<< results[i] << std::endl;
+		}
+	}
+	if (!index)
+	{
+		throw std::runtime_error("failed to write index: " + indexFile);
+	}
+
+	Log::info() << "Decompiled "
+			<< names.size() - failed << " of " << names.size()
+			<< " files, index: " << indexFile << std::endl;
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int decompile(retdec::config::Config& config, ProgramOptions& po)
 {
 	setLogsFrom(config.parameters);
 
+	// Mach-O slices and archive members extracted from the input file are
+	// kept in memory and decompiled from there. They are stored to the disk
+	// only if it was requested.
+	//
+	std::optional<std::vector<std::uint8_t>> inputData;
+
 	// Macho-O extraction.
 	//
 	retdec::macho_extractor::BreakMachOUniversal fat(
@@ -803,13 +1104,13 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 	{
 		Log::phase("Mach-O extraction");
 
-		auto extractedFile = po.arExtractPath + "_m";
+		std::vector<std::uint8_t> extracted;
 
 		if (config.architecture.isKnown())
 		{
 			if (!fat.extractArchiveForFamily(
 					config.architecture.getName(),
-					extractedFile))
+					extracted))
 			{
 				std::stringstream ss;
 				ss << "Invalid --arch option '"
@@ -822,7 +1123,7 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 		}
 		else
 		{
-			if (!fat.extractBestArchive(extractedFile))
+			if (!fat.extractBestArchive(extracted))
 			{
 				throw std::runtime_error(
 						"Mach-O extraction: extractBestArchive() failed."
@@ -831,23 +1132,49 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			}
 		}
 
-		config.parameters.setInputFile(extractedFile);
-		po.toClean.insert(extractedFile);
+		if (po.keepExtracted)
+		{
+			storeExtracted(po.arExtractPath + "_m", extracted, po);
+		}
+		inputData = std::move(extracted);
 	}
 
+	auto createArchiveWrapper = [&](bool& ok, std::string& errMsg)
+	{
+		return inputData
+			? std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+					*inputData,
+					ok,
+					errMsg)
+			: std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+					config.parameters.getInputFile(),
+					ok,
+					errMsg);
+	};
+
 	// Archive extraction.
 	//
-	if (po.arIdx || !po.arName.empty())
+	if (po.arAll)
+	{
+		bool ok = true;
+		std::string errMsg;
+		auto arw = createArchiveWrapper(ok, errMsg);
+		if (!ok)
+		{
+			throw std::runtime_error(
+					"failed to create archive wrapper: " + errMsg
+			);
+		}
+
+		return decompileArchiveMembers(config, po, *arw);
+	}
+	else if (po.arIdx || !po.arName.empty())
 	{
 		Log::phase("Archive extraction");
 
 		bool ok = true;
 		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
-		);
+		auto arw = createArchiveWrapper(ok, errMsg);
 
 		if (!ok)
 		{
@@ -856,9 +1183,10 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			);
 		}
 
+		std::vector<std::uint8_t> extracted;
 		if (po.arIdx)
 		{
-			if (!arw.extractByIndex(po.arIdx.value(), errMsg, po.arExtractPath))
+			if (!arw->extractByIndex(po.arIdx.value(), errMsg, extracted))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -866,14 +1194,14 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 						+ std::to_string(po.arIdx.value())
 						+ "' was not found in the input archive."
 						  " Valid indexes are 0-"
-						+ std::to_string(arw.getNumberOfObjects()-1)
+						+ std::to_string(arw->getNumberOfObjects()-1)
 						+ ".\n"
 				);
 			}
 		}
 		else if (!po.arName.empty())
 		{
-			if (!arw.extractByName(po.arName, errMsg, po.arExtractPath))
+			if (!arw->extractByName(po.arName, errMsg, extracted))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -883,25 +1211,27 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			}
 		}
 
-		config.parameters.setInputFile(po.arExtractPath);
-		po.toClean.insert(po.arExtractPath);
+		// The wrapper may refer to the data replaced below.
+		arw.reset();
+
+		if (po.keepExtracted)
+		{
+			storeExtracted(po.arExtractPath, extracted, po);
+		}
+		inputData = std::move(extracted);
 	}
 	else
 	{
 		bool ok = true;
 		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
-		);
-		if (ok && arw.isThinArchive())
+		auto arw = createArchiveWrapper(ok, errMsg);
+		if (ok && arw->isThinArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: File is a thin archive and cannot be decompiled." << std::endl;
 			return EXIT_FAILURE;
 		}
-		else if (ok && arw.isEmptyArchive())
+		else if (ok && arw->isEmptyArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive is empty." << std::endl;
@@ -912,14 +1242,17 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			Log::error() << "This file is an archive!" << std::endl;
 
 			std::string result;
-			if (arw.getPlainTextList(result, errMsg, false, true))
+			if (arw->getPlainTextList(result, errMsg, false, true))
 			{
 				Log::error() << result << std::endl;
 			}
 			return EXIT_FAILURE;
 		}
 
-		if (!ok && retdec::ar_extractor::isArchive(config.parameters.getInputFile()))
+		bool isArchive = inputData
+				? retdec::ar_extractor::isArchive(*inputData)
+				: retdec::ar_extractor::isArchive(config.parameters.getInputFile());
+		if (!ok && isArchive)
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive has invalid format." << std::endl;
@@ -929,21 +1262,34 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 
 	// Unpacking
 	//
-
 	Log::phase("Unpacking");
-	std::vector<std::string> unpackArgs;
-	unpackArgs.push_back("whatever_program_name");
-	unpackArgs.push_back(config.parameters.getInputFile());
-	unpackArgs.push_back("--output");
-	unpackArgs.push_back(config.parameters.getOutputUnpackedFile());
-	char* uargv[4] = {
-			unpackArgs[0].data(),
-			unpackArgs[1].data(),
-			unpackArgs[2].data(),
-			unpackArgs[3].data()
-	};
-	auto unpackCode = retdec::unpackertool::_main(4, uargv);
-	if (unpackCode == 0) // EXIT_CODE_OK
+	if (inputData)
+	{
+		// Packed inputs are not decompiled from memory. The unpacker is run
+		// on a file and its plugins write the unpacked output to a file
+		// (PeLib, std::ofstream). Therefore, if some plugin can unpack the
+		// extracted input, it is written to a temporary file, unpacked into
+		// another temporary file, and the unpacked file is decompiled.
+		// Inputs that are not packed never go to the disk.
+		if (retdec::unpackertool::isUnpackable(
+				inputData->data(),
+				inputData->size()))
+		{
+			auto packedFile = po.arExtractPath + "_packed";
+			storeExtracted(packedFile, *inputData, po);
+			if (unpack(packedFile, config.parameters.getOutputUnpackedFile()))
+			{
+				config.parameters.setInputFile(
+						config.parameters.getOutputUnpackedFile()
+				);
+				po.toClean.insert(config.parameters.getOutputUnpackedFile());
+				inputData.reset();
+			}
+		}
+	}
+	else if (unpack(
+			config.parameters.getInputFile(),
+			config.parameters.getOutputUnpackedFile()))
 	{
 		config.parameters.setInputFile(
 				config.parameters.getOutputUnpackedFile()
@@ -953,7 +1299,9 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 
 	// Decompilation.
 	//
-	return retdec::decompile(config);
+	return inputData
+			? retdec::decompile(config, *inputData)
+			: retdec::decompile(config);
 }
 
 //
@@ -1028,7 +1376,8 @@ int main(int argc, char **argv)
 	try
 	{
 		std::stringstream buffer;
-		if (config.parameters.isTimeout())
+		// Members of archives are run with their own timeouts.
+		if (config.parameters.isTimeout() && !po.arAll)
 		{
 			std::packaged_task<
 					int(retdec::config::Config&,
@@ -460,7 +460,13 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
-bool decompile(retdec::config::Config& config, std::string* outString)
+/**
+ * Run a decompilation, read the input from \p inputData if it is set.
+ */
+bool runDecompilation(
+		retdec::config::Config& config,
+		const std::vector<std::uint8_t>* inputData,
+		std::string* outString)
 {
 	setLogsFrom(config.parameters);
 
@@ -498,6 +504,7 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 			{
 				auto* p = static_cast<bin2llvmir::ProviderInitialization*>(pass);
 				p->setConfig(&config);
+				p->setInputData(inputData);
 			}
 			if (info->getTypeInfo() == &llvmir2hll::LlvmIr2Hll::ID)
 			{
@@ -518,4 +525,17 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 	return EXIT_SUCCESS;
 }
 
+bool decompile(retdec::config::Config& config, std::string* outString)
+{
+	return runDecompilation(config, nullptr, outString);
+}
+
+bool decompile(
+		retdec::config::Config& config,
+		const std::vector<std::uint8_t>& inputData,
+		std::string* outString)
+{
+	return runDecompilation(config, &inputData, outString);
+}
+
 } // namespace retdec
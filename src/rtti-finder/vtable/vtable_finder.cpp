@@ -27,6 +27,14 @@ void findPossibleVtables(
 {
 	auto wordSz = img->getBytesPerWord();
 
+	// Words in data segments are read from the pointer map, which is much
+	// faster than generic reads through the image.
+	auto& pm = img->getPointerMap();
+	auto getWord = [img, &pm](std::uint64_t a, std::uint64_t& val)
+	{
+		return pm.getWord(a, val) || (!pm.isCovered(a) && img->getWord(a, val));
+	};
+
 	for (auto& seg : img->getSegments())
 	{
 		if (seg->getSecSeg() && !seg->getSecSeg()->isSomeData())
@@ -39,7 +47,7 @@ void findPossibleVtables(
 		while (addr + wordSz < end)
 		{
 			std::uint64_t val = 0;
-			if (!img->getWord(addr, val))
+			if (!getWord(addr, val))
 			{
 				addr += wordSz;
 				continue;
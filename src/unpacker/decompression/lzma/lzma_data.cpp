@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "retdec/unpacker/decompression/lzma/lzma_data.h"
+#include "retdec/unpacker/decompression/output_buffer.h"
 
 namespace retdec {
 namespace unpacker {
@@ -36,6 +37,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 	if (!checkProperties())
 		return false;
 
+	OutputBuffer output(outputBuffer);
+
 	// Reset just in case decompress() is called more times in row
 	_readPos = 0;
 	_rangeDecoder.reset();
@@ -53,7 +56,7 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 	for (uint8_t i = 0; i < 5; ++i)
 		_rangeDecoder.code = (_rangeDecoder.code << 8) | _buffer.read<uint8_t>(_readPos++);
 
-	while (pos < outputBuffer.getCapacity() && _readPos < _buffer.getRealDataSize())
+	while (pos < output.getCapacity() && _readPos < _buffer.getRealDataSize())
 	{
 		uint32_t bit;
 		uint32_t posState = pos & posStateMask;
@@ -74,12 +77,12 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 			else
 			{
 				// 42d322
-				if (!decodeLiteral(literalPos, previousByte, true, outputBuffer.read<uint8_t>(pos - rep[0])))
+				if (!decodeLiteral(literalPos, previousByte, true, output.read(pos - rep[0])))
 					return false;
 			}
 
 			// 42d45d
-			outputBuffer.write<uint8_t>(previousByte, pos++);
+			output.write(previousByte, pos++);
 			state = (state <= 3) ? 0 : ((state <= 9) ? (state - 3) : (state - 6));
 		}
 		else
@@ -126,11 +129,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 						return false;
 
 					len += 2;
-					do
-					{
-						previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-						outputBuffer.write<uint8_t>(previousByte, pos++);
-					} while (--len && pos < outputBuffer.getCapacity());
+					pos += output.copy(pos - rep[0], pos, len);
+					previousByte = output.read(pos - 1);
 				}
 				// 42d5aa
 				else
@@ -153,11 +153,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 							return false;
 
 						len += 2;
-						do
-						{
-							previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-							outputBuffer.write<uint8_t>(previousByte, pos++);
-						} while (--len && pos < outputBuffer.getCapacity());
+						pos += output.copy(pos - rep[0], pos, len);
+						previousByte = output.read(pos - 1);
 					}
 					// 42d614
 					else
@@ -166,8 +163,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 							return false;
 
 						state = (state <= 6) ? 9 : 11;
-						previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-						outputBuffer.write<uint8_t>(previousByte, pos++);
+						previousByte = output.read(pos - rep[0]);
+						output.write(previousByte, pos++);
 					}
 				}
 			}
@@ -219,11 +216,8 @@ bool LzmaData::decompress(DynamicBuffer& outputBuffer)
 					return false;
 
 				len += 2;
-				do
-				{
-					previousByte = outputBuffer.read<uint8_t>(pos - rep[0]);
-					outputBuffer.write<uint8_t>(previousByte, pos++);
-				} while (--len && pos < outputBuffer.getCapacity());
+				pos += output.copy(pos - rep[0], pos, len);
+				previousByte = output.read(pos - 1);
 			}
 		}
 	}
@@ -15,6 +15,12 @@ Nrv2dData::Nrv2dData(const DynamicBuffer& buffer, BitParser* bitParser) : NrvDat
 }
 
 bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
+{
+	OutputBuffer output(outputBuffer);
+	return withBitParser([&](auto& bitParser) { return decompress(bitParser, output); });
+}
+
+template <typename T> bool Nrv2dData::decompress(T& bitParser, OutputBuffer& output)
 {
 	// Reset just in case decompress() is called more times in row
 	reset();
@@ -24,35 +30,35 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 	while (true)
 	{
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitParser.getBit(bit, _buffer, _readPos))
 			return false;
 
 		while (bit == 1)
 		{
-			if (_writePos >= outputBuffer.getCapacity() || _readPos >= _buffer.getRealDataSize())
+			if (_writePos >= output.getCapacity() || _readPos >= _buffer.getRealDataSize())
 				return false;
 
-			outputBuffer.write<uint8_t>(_buffer.read<uint8_t>(_readPos++), _writePos++);
+			output.write(_buffer.read<uint8_t>(_readPos++), _writePos++);
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitParser.getBit(bit, _buffer, _readPos))
 				return false;
 		}
 
 		int32_t dist = 1;
 		while (true)
 		{
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitParser.getBit(bit, _buffer, _readPos))
 				return false;
 
 			dist += dist + bit;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitParser.getBit(bit, _buffer, _readPos))
 				return false;
 
 			if (bit == 1)
 				break;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitParser.getBit(bit, _buffer, _readPos))
 				return false;
 
 			dist = ((dist - 1) << 1) + bit;
@@ -63,7 +69,7 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 		{
 			dist = lastDist;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitParser.getBit(bit, _buffer, _readPos))
 				return false;
 
 			count = bit;
@@ -83,7 +89,7 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 			lastDist = ++dist;
 		}
 
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitParser.getBit(bit, _buffer, _readPos))
 			return false;
 
 		count += count + bit;
@@ -94,12 +100,12 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 			do
 			{
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitParser.getBit(bit, _buffer, _readPos))
 					return false;
 
 				count += count + bit;
 
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitParser.getBit(bit, _buffer, _readPos))
 					return false;
 			} while (bit == 0);
 
@@ -109,14 +115,10 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 		count += (dist > 0x500) + 1;
 
 		uint32_t srcPos = static_cast<int32_t>(_writePos) - dist;
-		do
-		{
-			if (_writePos >= outputBuffer.getCapacity())
-				return false;
-
-			outputBuffer.write<uint8_t>(outputBuffer.read<uint8_t>(srcPos++), _writePos++);
-		}
-		while (--count);
+		uint32_t copied = output.copy(srcPos, _writePos, count);
+		_writePos += copied;
+		if (copied < static_cast<uint32_t>(count))
+			return false;
 	}
 }
 
@@ -12,6 +12,7 @@
 #include "retdec/utils/alignment.h"
 #include "retdec/utils/file_io.h"
 #include "retdec/loader/loader.h"
+#include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "unpackertool/plugins/upx/decompressors/decompressors.h"
 #include "unpackertool/plugins/upx/elf/elf_upx_stub.h"
 #include "unpackertool/plugins/upx/unfilter.h"
@@ -148,8 +149,9 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 	// Especially content that is not needed during the runtime, but is
 	// important for original file reconstruction such as section headers,
 	// string tables, etc.
-	// Thus there is no way we can get this data through fileformat nor elfio
-	std::string inputFilePath = _file->getFileFormat()->getPathToFile();
+	// Thus there is no way we can get this data through fileformat nor elfio,
+	// we read them from the bytes of the whole input file.
+	const auto& inputBytes = _file->getFileFormat()->getBytes();
 
 	std::uint64_t ep;
 	_file->getFileFormat()->getEpAddress(ep);
@@ -163,10 +165,8 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 	// If there is enough data between the last packed block and EP to store
 	// packed block header, we check whether it is a valid block
 	// If it isn't, we assume that these additional data are located at the end
-	std::ifstream additionalDataFile(
-			inputFilePath,
-			std::ios::in | std::ios::binary
-	);
+	retdec::fileformat::byte_array_buffer inputBuffer(inputBytes.data(), inputBytes.size());
+	std::istream additionalDataFile(&inputBuffer);
 	AddressType additionalDataPos = 0, additionalDataSize = 0;
 	bool additionalDataBehindStub = false;
 
@@ -265,7 +265,6 @@ template <int bits> void ElfUpxStub<bits>::unpack(const std::string& outputFile)
 			additionalDataPos,
 			additionalDataSize
 	);
-	additionalDataFile.close();
 
 	DynamicBuffer additionalData(
 			additionalDataBytes,
@@ -7,9 +7,12 @@
 #ifndef UNPACKERTOOL_PLUGINS_UPX_PE_PE_UPX_STUB_H
 #define UNPACKERTOOL_PLUGINS_UPX_PE_PE_UPX_STUB_H
 
+#include <istream>
+#include <memory>
 #include <unordered_set>
 
 #include "unpackertool/plugins/upx/upx_stub.h"
+#include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "retdec/pelib/PeFile.h"
 #include "retdec/utils/dynamic_buffer.h"
 #include "retdec/unpacker/signature.h"
@@ -108,6 +111,8 @@ private:
 			const DynamicBuffer& uncompressedRsrcs, const DynamicBuffer& unpackedData, std::unordered_set<std::uint32_t>& visitedNodes);
 	std::uint8_t getPackingMethod(bool trustMetadata) const;
 
+	std::unique_ptr<retdec::fileformat::byte_array_buffer> _inputBuffer; ///< Bytes of the packed input file.
+	std::unique_ptr<std::istream> _inputStream; ///< Stream over @ref _inputBuffer read by @ref _newPeFile.
 	PeLib::PeFileT * _newPeFile;    ///< Unpacked output file.
 	std::uint32_t _rvaShift;        ///< Size of sections UPX1 and UPX2 which are deleted and virtual addresses are shifted.
 	bool _exportsCompressed;        ///< True if the exports are compressed in the packed file, otherwise false
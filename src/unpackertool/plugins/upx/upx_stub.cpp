@@ -5,6 +5,7 @@
  */
 
 #include "retdec/fileformat/fileformat.h"
+#include "retdec/fileformat/utils/byte_array_buffer.h"
 #include "unpackertool/plugins/upx/decompressors/decompressors.h"
 #include "unpackertool/plugins/upx/elf/elf_upx_stub.h"
 #include "unpackertool/plugins/upx/macho/macho_upx_stub.h"
@@ -36,7 +37,9 @@ UpxMetadata UpxMetadata::read(retdec::loader::Image* file)
 	UpxMetadata metadata;
 
 	std::vector<std::uint8_t> dataBuffer(1024);
-	std::ifstream inputFile(file->getFileFormat()->getPathToFile(), std::ios::binary | std::ios::in);
+	const auto& inputBytes = file->getFileFormat()->getBytes();
+	retdec::fileformat::byte_array_buffer inputBuffer(inputBytes.data(), inputBytes.size());
+	std::istream inputFile(&inputBuffer);
 
 	bool useChecksum = true;
 	bool usePackingMethod = true;
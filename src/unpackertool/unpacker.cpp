@@ -39,14 +39,23 @@ enum ExitCode
 	EXIT_CODE_MEMORY_LIMIT_ERROR ///< There was an error when setting the memory limit.
 };
 
-bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+void detectPackers(retdec::fileformat::FileFormat& file, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	using namespace retdec::cpdetect;
-	using namespace retdec::fileformat;
 
 	DetectParams detectionParams(SearchType::MOST_SIMILAR, true, false);
 
 	ToolInformation toolInfo;
+	CompilerDetector compilerDetector(file, detectionParams, toolInfo);
+	compilerDetector.getAllInformation();
+
+	detectedPackers = toolInfo.detectedTools;
+}
+
+bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+{
+	using namespace retdec::fileformat;
+
 	switch (detectFileFormat(inputFile))
 	{
 		case Format::UNDETECTABLE:
@@ -64,24 +73,10 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 				return false;
 			}
 
-			auto compilerDetector = std::make_unique<CompilerDetector>(
-					*(fileParser.get()),
-					detectionParams,
-					toolInfo
-			);
-			if (!compilerDetector)
-			{
-				Log::error() << "No compiler detector was found! Please, report this." << std::endl;
-				return false;
-			}
-
-			compilerDetector->getAllInformation();
-			break;
+			detectPackers(*fileParser, detectedPackers);
+			return true;
 		}
 	}
-
-	detectedPackers = toolInfo.detectedTools;
-	return true;
 }
 
 ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
@@ -204,6 +199,32 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	return EXIT_CODE_OK;
 }
 
+/**
+ * Checks whether a packer which can be unpacked by some of the plugins is
+ * detected in the given file content. Nothing is written to the disk.
+ *
+ * @param data Content of the file.
+ * @param size Size of @a data.
+ *
+ * @return True if the file should be unpacked, otherwise false.
+ */
+bool isUnpackable(const std::uint8_t* data, std::size_t size)
+{
+	auto fileParser = retdec::fileformat::createFileFormat(data, size);
+	if (!fileParser)
+		return false;
+
+	std::vector<retdec::cpdetect::DetectResult> detectedPackers;
+	detectPackers(*fileParser, detectedPackers);
+	for (const auto& detectedPacker : detectedPackers)
+	{
+		if (!PluginMgr::matchingPlugins(detectedPacker.name, detectedPacker.versionInfo).empty())
+			return true;
+	}
+
+	return false;
+}
+
 int _main(int argc, char** argv)
 {
 	ArgHandler handler("unpacker options [PACKED_FILE] [optional]");
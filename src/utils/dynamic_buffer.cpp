@@ -52,6 +52,22 @@ DynamicBuffer::DynamicBuffer(
 {
 }
 
+/**
+ * Creates the DynamicBuffer object and moves specified data into it with
+ * specified endianness.
+ *
+ * @param data The bytes to initialize the buffer with.
+ * @param endianness Endiannes of the bytes in the buffer.
+ */
+DynamicBuffer::DynamicBuffer(
+		std::vector<uint8_t>&& data,
+		Endianness endianness)
+		: _data(std::move(data))
+		, _endianness(endianness)
+		, _capacity(static_cast<uint32_t>(_data.size()))
+{
+}
+
 /**
  * Creates the copy of the DynamicBuffer object.
  *
@@ -0,0 +1,33 @@
+/**
+* @file src/utils/parallel.cpp
+* @brief Simple helpers for running independent work items in parallel.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <thread>
+
+#include "retdec/utils/parallel.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Returns the number of threads to use for the given requested number
+*        of threads.
+*
+* @c 0 means "use all hardware threads". If the number of hardware threads
+* cannot be determined, a single thread is used.
+*/
+std::size_t getThreadCount(std::size_t requested)
+{
+	if (requested != 0)
+	{
+		return requested;
+	}
+
+	auto hw = std::thread::hardware_concurrency();
+	return hw != 0 ? hw : 1;
+}
+
+} // namespace utils
+} // namespace retdec
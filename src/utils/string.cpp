@@ -645,6 +645,63 @@ std::string addSlashes(const std::string &str, const std::string &toBackslash) {
 	return result;
 }
 
+/**
+* @brief Returns @a arg quoted so that a POSIX shell passes it to a program as
+*        a single argument.
+*
+* The argument is put into single quotes. Single quotes in it are closed,
+* backslashed, and opened again.
+*/
+std::string quotePosixShellArgument(const std::string &arg) {
+	std::string result = "'";
+	for (const auto &c : arg) {
+		if (c == '\'') {
+			result += "'\\''";
+		} else {
+			result += c;
+		}
+	}
+	return result + "'";
+}
+
+/**
+* @brief Returns @a arg quoted so that @c cmd.exe passes it to a program as a
+*        single argument.
+*
+* The argument is quoted by the rules of the Microsoft C runtime (and
+* @c CommandLineToArgvW()). Double quotes are backslashed. Backslashes are
+* doubled if they precede a double quote or the closing quote, otherwise they
+* are kept as they are. Then, all characters special for @c cmd.exe, including
+* the double quotes, are escaped by a caret, so @c cmd.exe neither interprets
+* them nor expands variables.
+*/
+std::string quoteWindowsShellArgument(const std::string &arg) {
+	std::string quoted = "\"";
+	std::size_t backslashes = 0;
+	for (const auto &c : arg) {
+		if (c == '\\') {
+			++backslashes;
+			continue;
+		}
+
+		quoted.append(c == '"' ? 2 * backslashes + 1 : backslashes, '\\');
+		quoted += c;
+		backslashes = 0;
+	}
+	quoted.append(2 * backslashes, '\\');
+	quoted += '"';
+
+	const std::string cmdSpecialChars = "()%!^\"<>&|";
+	std::string result;
+	for (const auto &c : quoted) {
+		if (cmdSpecialChars.find(c) != std::string::npos) {
+			result += '^';
+		}
+		result += c;
+	}
+	return result;
+}
+
 /**
 * @brief Replaces all occurrences of @a what with @a withWhat in @a str and
 *        returns the resulting string.
@@ -0,0 +1,162 @@
+/**
+ * @file tests/ar-extractor/archive_wrapper_tests.cpp
+ * @brief Tests for the @c ArchiveWrapper class and archive detection.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ar-extractor/archive_wrapper.h"
+#include "retdec/ar-extractor/detection.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ar_extractor {
+namespace tests {
+
+class ArchiveWrapperTests : public Test
+{
+	protected:
+		/**
+		 * Append a member in the GNU format to the archive.
+		 */
+		void addMember(const std::string &name, const std::string &content)
+		{
+			char header[61];
+			std::snprintf(header, sizeof(header),
+				"%-16s%-12s%-6s%-6s%-8s%-10zu`\n",
+				(name + "/").c_str(), "0", "0", "0", "644", content.size());
+			archive.insert(archive.end(), header, header + 60);
+			archive.insert(archive.end(), content.begin(), content.end());
+			if (content.size() % 2) {
+				archive.push_back('\n');
+			}
+		}
+
+		std::vector<std::uint8_t> toBytes(const std::string &s)
+		{
+			return std::vector<std::uint8_t>(s.begin(), s.end());
+		}
+
+	protected:
+		std::vector<std::uint8_t> archive = toBytes("!<arch>\n");
+};
+
+TEST_F(ArchiveWrapperTests,
+ArchiveInMemoryIsDetected)
+{
+	addMember("a.o", "first");
+
+	EXPECT_TRUE(isArchive(archive));
+	EXPECT_FALSE(isArchive(toBytes("\x7f" "ELF")));
+	EXPECT_FALSE(isArchive(std::vector<std::uint8_t>()));
+}
+
+TEST_F(ArchiveWrapperTests,
+ArchiveInMemoryIsParsed)
+{
+	addMember("a.o", "first");
+	addMember("b.o", "second");
+
+	bool ok = false;
+	std::string errorMessage;
+	ArchiveWrapper arw(archive, ok, errorMessage);
+
+	ASSERT_TRUE(ok) << errorMessage;
+	EXPECT_FALSE(arw.isThinArchive());
+	EXPECT_FALSE(arw.isEmptyArchive());
+	EXPECT_EQ(2, arw.getNumberOfObjects());
+
+	std::vector<std::string> names;
+	ASSERT_TRUE(arw.getNames(names, errorMessage));
+	EXPECT_EQ(std::vector<std::string>({"a.o", "b.o"}), names);
+}
+
+TEST_F(ArchiveWrapperTests,
+InvalidArchiveInMemoryIsRejected)
+{
+	auto data = toBytes("!<arch>\nnot a member header");
+
+	bool ok = true;
+	std::string errorMessage;
+	ArchiveWrapper arw(data, ok, errorMessage);
+
+	EXPECT_FALSE(ok);
+	EXPECT_FALSE(errorMessage.empty());
+}
+
+TEST_F(ArchiveWrapperTests,
+MemberIsExtractedByIndexIntoMemory)
+{
+	addMember("a.o", "first");
+	addMember("b.o", "second");
+	bool ok = false;
+	std::string errorMessage;
+	ArchiveWrapper arw(archive, ok, errorMessage);
+	ASSERT_TRUE(ok) << errorMessage;
+
+	std::vector<std::uint8_t> member;
+	ASSERT_TRUE(arw.extractByIndex(1, errorMessage, member)) << errorMessage;
+	EXPECT_EQ(toBytes("second"), member);
+
+	ASSERT_TRUE(arw.extractByIndex(0, errorMessage, member)) << errorMessage;
+	EXPECT_EQ(toBytes("first"), member);
+
+	EXPECT_FALSE(arw.extractByIndex(2, errorMessage, member));
+}
+
+TEST_F(ArchiveWrapperTests,
+MemberIsExtractedByNameIntoMemory)
+{
+	addMember("a.o", "first");
+	addMember("b.o", "second");
+	bool ok = false;
+	std::string errorMessage;
+	ArchiveWrapper arw(archive, ok, errorMessage);
+	ASSERT_TRUE(ok) << errorMessage;
+
+	std::vector<std::uint8_t> member;
+	ASSERT_TRUE(arw.extractByName("b.o", errorMessage, member)) << errorMessage;
+	EXPECT_EQ(toBytes("second"), member);
+
+	EXPECT_FALSE(arw.extractByName("c.o", errorMessage, member));
+	EXPECT_EQ("Could not find desired file", errorMessage);
+}
+
+TEST_F(ArchiveWrapperTests,
+MemberExtractedIntoMemoryEqualsMemberExtractedToFile)
+{
+	addMember("a.o", "first");
+	addMember("b.o", std::string("\x00\x01\x02\xff", 4));
+	bool ok = false;
+	std::string errorMessage;
+	ArchiveWrapper arw(archive, ok, errorMessage);
+	ASSERT_TRUE(ok) << errorMessage;
+
+	std::string path = ::testing::TempDir() + "retdec-ar-extractor-test-b.o";
+	ASSERT_TRUE(arw.extractByIndex(1, errorMessage, path)) << errorMessage;
+	std::ifstream file(path, std::ios::binary);
+	std::vector<std::uint8_t> onDisk(
+		(std::istreambuf_iterator<char>(file)),
+		std::istreambuf_iterator<char>());
+	file.close();
+	std::remove(path.c_str());
+
+	std::vector<std::uint8_t> inMemory;
+	ASSERT_TRUE(arw.extractByIndex(1, errorMessage, inMemory)) << errorMessage;
+
+	EXPECT_EQ(onDisk, inMemory);
+	EXPECT_EQ(4, inMemory.size());
+}
+
+} // namespace tests
+} // namespace ar_extractor
+} // namespace retdec
@@ -4,7 +4,11 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <set>
+#include <sstream>
+
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #include "bin2llvmir/utils/llvmir_tests.h"
 
 using namespace ::testing;
@@ -44,6 +48,93 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+parallelRunGivesSameResultsAsSerialRun)
+{
+	std::string ir = R"(
+		@g = global i32 0
+		@h = global i32 0
+	)";
+	for (int i = 0; i < 8; ++i)
+	{
+		auto n = std::to_string(i);
+		ir += R"(
+			define i32 @f)" + n + R"((i1 %c) {
+			entry:
+				store i32 )" + n + R"(, i32* @g
+				br i1 %c, label %left, label %right
+			left:
+				store i32 1, i32* @g
+				%a = load i32, i32* @h
+				br label %loop
+			right:
+				store i32 2, i32* @h
+				br label %loop
+			loop:
+				%x = load i32, i32* @g
+				store i32 %x, i32* @h
+				br i1 %c, label %loop, label %exit
+			exit:
+				%y = load i32, i32* @h
+				ret i32 %y
+			}
+		)";
+	}
+	parseInput(ir);
+	config::Config c;
+	auto* config = ConfigProvider::addConfig(module.get(), c);
+
+	config->getConfig().parameters.setThreads(4);
+	ParallelStatistics stats;
+	RDA.runOnModule(*module, nullptr, false, &stats);
+
+	config->getConfig().parameters.setThreads(1);
+	ReachingDefinitionsAnalysis serialRDA;
+	serialRDA.runOnModule(*module);
+
+	std::stringstream report;
+	stats.print(report, "rda");
+	EXPECT_NE(std::string::npos, report.str().find("8 functions in 1 runs, 4 threads"));
+
+	std::size_t multipleDefs = 0;
+	for (Function& F : *module)
+	for (BasicBlock& B : F)
+	for (Instruction& I : B)
+	{
+		if (isa<LoadInst>(&I))
+		{
+			std::set<Instruction*> defs;
+			for (auto* d : RDA.defsFromUse(&I))
+			{
+				defs.insert(d->def);
+			}
+			std::set<Instruction*> serialDefs;
+			for (auto* d : serialRDA.defsFromUse(&I))
+			{
+				serialDefs.insert(d->def);
+			}
+			EXPECT_EQ(serialDefs, defs) << llvmObjToString(&I);
+			multipleDefs += defs.size() > 1;
+		}
+		else if (isa<StoreInst>(&I))
+		{
+			std::set<Instruction*> uses;
+			for (auto* u : RDA.usesFromDef(&I))
+			{
+				uses.insert(u->use);
+			}
+			std::set<Instruction*> serialUses;
+			for (auto* u : serialRDA.usesFromDef(&I))
+			{
+				serialUses.insert(u->use);
+			}
+			EXPECT_EQ(serialUses, uses) << llvmObjToString(&I);
+		}
+	}
+	// In every function, %x is reached by the stores in entry and left.
+	EXPECT_EQ(8, multipleDefs);
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,180 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/disassembly_cache_tests.cpp
+* @brief Tests for the @c DisassemblyCache.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/optimizations/decoder/disassembly_cache.h"
+
+using namespace ::testing;
+using namespace retdec::common;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c DisassemblyCache.
+ */
+class DisassemblyCacheTests : public Test
+{
+	protected:
+		/**
+		 * Random bytes -> x86 instructions of many sizes and undecodable
+		 * bytes, so that instructions cross chunk boundaries.
+		 */
+		std::vector<std::uint8_t> randomBytes(std::size_t size)
+		{
+			std::mt19937 gen(42);
+			std::uniform_int_distribution<int> byte(0, 0xff);
+			std::vector<std::uint8_t> bytes(size);
+			for (auto& b : bytes)
+			{
+				b = byte(gen);
+			}
+			return bytes;
+		}
+
+		DisassemblyCache::Region region(
+				Address start,
+				const std::vector<std::uint8_t>& bytes)
+		{
+			DisassemblyCache::Region r;
+			r.start = start;
+			r.bytes = bytes.data();
+			r.size = bytes.size();
+			return r;
+		}
+
+		/**
+		 * Serial linear sweep with a single Capstone engine, the way the
+		 * cache should see the region.
+		 */
+		std::vector<CachedInstruction> sweep(
+				const DisassemblyCache::Region& r,
+				unsigned alignment)
+		{
+			csh ce = 0;
+			EXPECT_EQ(CS_ERR_OK, cs_open(CS_ARCH_X86, CS_MODE_32, &ce));
+			cs_insn* insn = cs_malloc(ce);
+
+			std::vector<CachedInstruction> res;
+			const std::uint8_t* bytes = r.bytes;
+			std::size_t size = r.size;
+			std::uint64_t addr = r.start;
+			while (size > 0)
+			{
+				if (cs_disasm_iter(ce, &bytes, &size, &addr, insn))
+				{
+					CachedInstruction ci;
+					ci.address = insn->address;
+					ci.id = insn->id;
+					ci.size = insn->size;
+					res.push_back(ci);
+				}
+				else if (size > alignment)
+				{
+					bytes += alignment;
+					size -= alignment;
+					addr += alignment;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			cs_free(insn, 1);
+			cs_close(&ce);
+			return res;
+		}
+
+		void build(
+				DisassemblyCache& cache,
+				const std::vector<DisassemblyCache::Region>& regions,
+				std::size_t threads)
+		{
+			cache.build(
+					CS_ARCH_X86,
+					CS_MODE_32,
+					regions,
+					1,
+					threads,
+					[](cs_insn* insn, CachedInstruction& ci)
+					{
+						if (insn->id == X86_INS_RET)
+						{
+							ci.flags |= CachedInstruction::RETURN;
+						}
+					});
+		}
+};
+
+TEST_F(DisassemblyCacheTests,
+CachedInstructionsMatchSerialSweepAcrossChunkBoundaries)
+{
+	// Several 64 KiB chunks in each region.
+	auto bytes1 = randomBytes(3 * 0x10000 + 0x123);
+	auto bytes2 = randomBytes(0x10000 + 0x10);
+	auto r1 = region(0x401000, bytes1);
+	auto r2 = region(0x501000, bytes2);
+	auto expected = sweep(r1, 1);
+	auto expected2 = sweep(r2, 1);
+	expected.insert(expected.end(), expected2.begin(), expected2.end());
+
+	for (std::size_t threads : {1, 4})
+	{
+		DisassemblyCache cache;
+		build(cache, {r1, r2}, threads);
+
+		ASSERT_EQ(expected.size(), cache.size()) << "threads " << threads;
+		for (auto& e : expected)
+		{
+			auto* ci = cache.get(e.address);
+			ASSERT_NE(nullptr, ci) << std::hex << e.address;
+			EXPECT_EQ(e.id, ci->id) << std::hex << e.address;
+			EXPECT_EQ(e.size, ci->size) << std::hex << e.address;
+		}
+	}
+}
+
+TEST_F(DisassemblyCacheTests,
+InstructionsAreClassified)
+{
+	// push ebp; mov ebp, esp; pop ebp; ret
+	std::vector<std::uint8_t> bytes = {0x55, 0x89, 0xe5, 0x5d, 0xc3};
+	DisassemblyCache cache;
+	build(cache, {region(0x1000, bytes)}, 1);
+
+	ASSERT_EQ(4, cache.size());
+	ASSERT_NE(nullptr, cache.get(0x1004));
+	EXPECT_EQ(X86_INS_RET, cache.get(0x1004)->id);
+	EXPECT_TRUE(cache.get(0x1004)->is(CachedInstruction::RETURN));
+	EXPECT_FALSE(cache.get(0x1000)->is(CachedInstruction::RETURN));
+}
+
+TEST_F(DisassemblyCacheTests,
+OnlyInstructionStartsAreInCache)
+{
+	// push ebp; mov ebp, esp
+	std::vector<std::uint8_t> bytes = {0x55, 0x89, 0xe5};
+	DisassemblyCache cache;
+	build(cache, {region(0x1000, bytes)}, 1);
+
+	EXPECT_NE(nullptr, cache.get(0x1001));
+	EXPECT_EQ(nullptr, cache.get(0x1002));
+	EXPECT_EQ(nullptr, cache.get(0x1003));
+	EXPECT_EQ(nullptr, cache.get(Address()));
+
+	cache.clear();
+	EXPECT_TRUE(cache.empty());
+	EXPECT_EQ(nullptr, cache.get(0x1000));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
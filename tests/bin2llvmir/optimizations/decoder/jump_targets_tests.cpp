@@ -0,0 +1,227 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/jump_targets_tests.cpp
+* @brief Tests for the @c JumpTargets queue.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+using namespace retdec::common;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c JumpTargets queue.
+ */
+class JumpTargetsTests: public LlvmIrTests
+{
+	protected:
+		void SetUp() override
+		{
+			LlvmIrTests::SetUp();
+			c.architecture.setIsX86();
+			c.architecture.setBitSize(32);
+			config = ConfigProvider::addConfig(module.get(), c);
+			JumpTarget::config = config;
+			JumpTargets::config = config;
+		}
+
+		void TearDown() override
+		{
+			JumpTarget::config = nullptr;
+			JumpTargets::config = nullptr;
+			LlvmIrTests::TearDown();
+		}
+
+		/**
+		 * Pop all the jump targets and return them in the popped order.
+		 */
+		std::vector<JumpTarget> popAll()
+		{
+			std::vector<JumpTarget> ret;
+			while (!jts.empty())
+			{
+				ret.push_back(jts.top());
+				jts.pop();
+			}
+			return ret;
+		}
+
+	protected:
+		retdec::config::Config c;
+		Config* config = nullptr;
+		JumpTargets jts;
+};
+
+//
+// push() & pop() order
+//
+
+TEST_F(JumpTargetsTests, emptyQueue)
+{
+	EXPECT_TRUE(jts.empty());
+	EXPECT_EQ(0, jts.size());
+}
+
+TEST_F(JumpTargetsTests, popOrderIsByTypeThenAddress)
+{
+	jts.push(0x3000, JumpTarget::eType::ENTRY_POINT, CS_MODE_32, 0x0);
+	jts.push(0x1000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+	jts.push(0x2000, JumpTarget::eType::CONTROL_FLOW_BR_TRUE, CS_MODE_32, 0x10);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_BR_TRUE, CS_MODE_32, 0x10);
+	jts.push(0x4000, JumpTarget::eType::CONTROL_FLOW_BR_FALSE, CS_MODE_32, 0x10);
+	jts.push(0x0500, JumpTarget::eType::LEFTOVER, CS_MODE_32, 0x0);
+	jts.push(0x2000, JumpTarget::eType::ENTRY_POINT, CS_MODE_32, 0x0);
+
+	ASSERT_EQ(7, jts.size());
+	auto popped = popAll();
+
+	ASSERT_EQ(7, popped.size());
+	EXPECT_EQ(JumpTarget::eType::CONTROL_FLOW_BR_FALSE, popped[0].getType());
+	EXPECT_EQ(0x4000, popped[0].getAddress());
+	EXPECT_EQ(JumpTarget::eType::CONTROL_FLOW_BR_TRUE, popped[1].getType());
+	EXPECT_EQ(0x1000, popped[1].getAddress());
+	EXPECT_EQ(JumpTarget::eType::CONTROL_FLOW_BR_TRUE, popped[2].getType());
+	EXPECT_EQ(0x2000, popped[2].getAddress());
+	EXPECT_EQ(JumpTarget::eType::ENTRY_POINT, popped[3].getType());
+	EXPECT_EQ(0x2000, popped[3].getAddress());
+	EXPECT_EQ(JumpTarget::eType::ENTRY_POINT, popped[4].getType());
+	EXPECT_EQ(0x3000, popped[4].getAddress());
+	EXPECT_EQ(JumpTarget::eType::SYMBOL, popped[5].getType());
+	EXPECT_EQ(0x1000, popped[5].getAddress());
+	EXPECT_EQ(JumpTarget::eType::LEFTOVER, popped[6].getType());
+	EXPECT_EQ(0x0500, popped[6].getAddress());
+	EXPECT_TRUE(jts.empty());
+}
+
+TEST_F(JumpTargetsTests, popOrderMatchesJumpTargetOrdering)
+{
+	// Many interleaved pushes -> popped sequence must be sorted by
+	// JumpTarget::operator<(), the order the former std::set had.
+	for (unsigned i = 0; i < 100; ++i)
+	{
+		auto t = static_cast<JumpTarget::eType>((i * 7) % 5);
+		jts.push(0x1000 + ((i * 37) % 100) * 4, t, CS_MODE_32, i % 3);
+	}
+	auto popped = popAll();
+
+	ASSERT_FALSE(popped.empty());
+	for (std::size_t i = 1; i < popped.size(); ++i)
+	{
+		EXPECT_FALSE(popped[i] < popped[i-1]) << "at index " << i;
+	}
+}
+
+TEST_F(JumpTargetsTests, sameAddressAndTypeIsOrderedByFromAddress)
+{
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_CALL_TARGET, CS_MODE_32, 0x30);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_CALL_TARGET, CS_MODE_32, 0x10);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_CALL_TARGET, CS_MODE_32, 0x20);
+
+	auto popped = popAll();
+
+	ASSERT_EQ(3, popped.size());
+	EXPECT_EQ(0x10, popped[0].getFromAddress());
+	EXPECT_EQ(0x20, popped[1].getFromAddress());
+	EXPECT_EQ(0x30, popped[2].getFromAddress());
+}
+
+//
+// Duplicates
+//
+
+TEST_F(JumpTargetsTests, duplicateIsNotQueuedAndExistingJumpTargetIsReturned)
+{
+	auto first = jts.push(
+			0x1000,
+			JumpTarget::eType::CONTROL_FLOW_BR_TRUE,
+			CS_MODE_32,
+			0x10,
+			4);
+	auto second = jts.push(
+			0x1000,
+			JumpTarget::eType::CONTROL_FLOW_BR_TRUE,
+			CS_MODE_32,
+			0x10);
+
+	ASSERT_TRUE(first.has_value());
+	ASSERT_TRUE(second.has_value());
+	EXPECT_EQ(1, jts.size());
+	EXPECT_EQ(0x1000, second->getAddress());
+	// The queued one, not the new one, is returned.
+	ASSERT_TRUE(second->hasSize());
+	EXPECT_EQ(4, second->getSize().value());
+}
+
+TEST_F(JumpTargetsTests, differentTypeOrFromAddressIsNotDuplicate)
+{
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_BR_TRUE, CS_MODE_32, 0x10);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_BR_FALSE, CS_MODE_32, 0x10);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_BR_TRUE, CS_MODE_32, 0x20);
+	jts.push(0x1000, JumpTarget::eType::CONTROL_FLOW_BR_TRUE, CS_MODE_32, 0x10);
+
+	EXPECT_EQ(3, jts.size());
+}
+
+TEST_F(JumpTargetsTests, duplicateOfPoppedJumpTargetCanBePushedAgain)
+{
+	jts.push(0x1000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+	jts.pop();
+	ASSERT_TRUE(jts.empty());
+
+	auto jt = jts.push(0x1000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+
+	ASSERT_TRUE(jt.has_value());
+	EXPECT_EQ(1, jts.size());
+	EXPECT_EQ(0x1000, jts.top().getAddress());
+}
+
+TEST_F(JumpTargetsTests, clearForgetsQueuedJumpTargets)
+{
+	jts.push(0x1000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+	jts.push(0x2000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+	jts.clear();
+	ASSERT_TRUE(jts.empty());
+
+	jts.push(0x1000, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+
+	EXPECT_EQ(1, jts.size());
+}
+
+//
+// Rejected jump targets
+//
+
+TEST_F(JumpTargetsTests, undefinedAddressIsNotQueued)
+{
+	auto jt = jts.push(
+			Address(),
+			JumpTarget::eType::SYMBOL,
+			CS_MODE_32,
+			0x0);
+
+	EXPECT_FALSE(jt.has_value());
+	EXPECT_TRUE(jts.empty());
+}
+
+TEST_F(JumpTargetsTests, misalignedAddressIsNotQueuedOnMips)
+{
+	config->getConfig().architecture.setIsMips();
+
+	auto bad = jts.push(0x1002, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+	auto good = jts.push(0x1004, JumpTarget::eType::SYMBOL, CS_MODE_32, 0x0);
+
+	EXPECT_FALSE(bad.has_value());
+	EXPECT_TRUE(good.has_value());
+	EXPECT_EQ(1, jts.size());
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,105 @@
+/**
+ * @file tests/demangler/demangle_cache_tests.cpp
+ * @brief Tests for the cache of demangled names.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/demangler/demangle_cache.h"
+#include "retdec/demangler/demangler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace demangler {
+namespace tests {
+
+class DemangleCacheTests : public Test
+{
+	public:
+		using status = retdec::demangler::Demangler::Status;
+};
+
+TEST_F(DemangleCacheTests,
+CachedDemanglingGivesSameResultAsDemangling)
+{
+	ItaniumDemangler demangler;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		EXPECT_EQ("foo<1>::foo()", demangler.demangleToStringCached("_ZN3fooILi1EEC5Ev"));
+		EXPECT_EQ(status::success, demangler.status());
+		EXPECT_EQ("", demangler.demangleToStringCached("_ZZZ"));
+		EXPECT_EQ(status::invalid_mangled_name, demangler.status());
+	}
+
+	EXPECT_EQ(2, demangler.cache().size());
+}
+
+TEST_F(DemangleCacheTests,
+EachDemanglerHasItsOwnCache)
+{
+	ItaniumDemangler itanium1;
+	ItaniumDemangler itanium2;
+	MicrosoftDemangler microsoft;
+
+	itanium1.demangleToStringCached("?foo@@YAXXZ");
+	EXPECT_EQ(status::invalid_mangled_name, itanium1.status());
+
+	EXPECT_EQ("void __cdecl foo(void)", microsoft.demangleToStringCached("?foo@@YAXXZ"));
+	EXPECT_EQ(status::success, microsoft.status());
+
+	EXPECT_EQ(1, itanium1.cache().size());
+	EXPECT_EQ(0, itanium2.cache().size());
+	EXPECT_EQ(1, microsoft.cache().size());
+}
+
+TEST_F(DemangleCacheTests,
+ClearRemovesAllNames)
+{
+	ItaniumDemangler demangler;
+	demangler.demangleToStringCached("_ZN3fooILi1EEC5Ev");
+
+	demangler.cache().clear();
+
+	EXPECT_EQ(0, demangler.cache().size());
+	EXPECT_EQ("foo<1>::foo()", demangler.demangleToStringCached("_ZN3fooILi1EEC5Ev"));
+}
+
+TEST_F(DemangleCacheTests,
+DemangleAllStoresAllNames)
+{
+	std::vector<std::string> names;
+	for (int i = 0; i < 1000; ++i)
+	{
+		names.push_back("_Z3fooILi" + std::to_string(i) + "EEvv");
+	}
+	names.push_back("_ZZZ");
+	names.push_back("_ZZZ");
+
+	ItaniumDemangler demangler;
+	demangler.cache().demangleAll(names, 4);
+	EXPECT_EQ(1001, demangler.cache().size());
+
+	for (const auto &name : names)
+	{
+		std::string demangled;
+		Demangler::Status s;
+		ASSERT_TRUE(demangler.cache().get(name, demangled, s));
+		EXPECT_EQ(demangler.demangleToString(name), demangled);
+		EXPECT_EQ(demangler.status(), s);
+	}
+}
+
+TEST_F(DemangleCacheTests,
+DemangleAllIgnoresUnknownScheme)
+{
+	DemangleCache cache("unknown");
+	cache.demangleAll({"_Z3foov"});
+	EXPECT_EQ(0, cache.size());
+}
+
+} // namespace tests
+} // namespace demangler
+} // namespace retdec
@@ -0,0 +1,83 @@
+/**
+ * @file tests/fileformat/byte_array_buffer_tests.cpp
+ * @brief Tests for the @c byte_array_buffer module.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <istream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/utils/byte_array_buffer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+class ByteArrayBufferTests : public Test
+{
+	protected:
+		std::vector<std::uint8_t> data = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+};
+
+TEST_F(ByteArrayBufferTests,
+ReadsWholeBlocks)
+{
+	byte_array_buffer buffer(data.data(), data.size());
+	std::istream stream(&buffer);
+
+	char bytes[4] = {};
+	stream.read(bytes, 4);
+
+	EXPECT_EQ(4, stream.gcount());
+	EXPECT_EQ(3, bytes[3]);
+	EXPECT_EQ(4, stream.tellg());
+}
+
+TEST_F(ByteArrayBufferTests,
+ReadStopsAtEnd)
+{
+	byte_array_buffer buffer(data.data(), data.size());
+	std::istream stream(&buffer);
+	stream.seekg(8, std::ios::beg);
+
+	char bytes[4] = {};
+	stream.read(bytes, 4);
+
+	EXPECT_EQ(2, stream.gcount());
+	EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(ByteArrayBufferTests,
+SeekFromEndUsesOffset)
+{
+	byte_array_buffer buffer(data.data(), data.size());
+	std::istream stream(&buffer);
+
+	stream.seekg(-3, std::ios::end);
+
+	EXPECT_EQ(7, stream.tellg());
+	EXPECT_EQ(7, stream.get());
+}
+
+TEST_F(ByteArrayBufferTests,
+InvalidSeekKeepsPosition)
+{
+	byte_array_buffer buffer(data.data(), data.size());
+	std::istream stream(&buffer);
+	stream.seekg(2, std::ios::beg);
+
+	stream.seekg(-20, std::ios::end);
+	EXPECT_TRUE(stream.fail());
+
+	stream.clear();
+	EXPECT_EQ(2, stream.tellg());
+	EXPECT_EQ(2, stream.get());
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -204,6 +204,36 @@ TEST_F(PeFormatTests_data, DataInterpretationDefault)
 	EXPECT_EQ(0x105d0040103805c7, res);
 }
 
+TEST_F(PeFormatTests_data, ParallelLoadGivesSameTables)
+{
+	PeFormat parallel(peBytes.data(), peBytes.size(), LoadFlags::PARALLEL_LOAD);
+
+	ASSERT_EQ(true, parallel.isInValidState());
+	ASSERT_NE(nullptr, parser->getImportTable());
+	ASSERT_NE(nullptr, parallel.getImportTable());
+	ASSERT_EQ(parser->getImportTable()->getNumberOfImports(), parallel.getImportTable()->getNumberOfImports());
+	for (std::size_t i = 0; i < parser->getImportTable()->getNumberOfImports(); ++i)
+	{
+		EXPECT_EQ(parser->getImportTable()->getImport(i)->getName(), parallel.getImportTable()->getImport(i)->getName());
+	}
+	EXPECT_EQ(parser->getImportTable()->getImphashCrc32(), parallel.getImportTable()->getImphashCrc32());
+	EXPECT_EQ(parser->getNonDecodableAddressRanges(), parallel.getNonDecodableAddressRanges());
+	EXPECT_EQ(parser->getTlsInfo() != nullptr, parallel.getTlsInfo() != nullptr);
+}
+
+TEST_F(PeFormatTests_data, LoadTimesAreStoredInOrder)
+{
+	std::vector<std::string> names;
+	for (const auto &loadTime : parser->getLoadTimes())
+	{
+		names.push_back(loadTime.first);
+		EXPECT_LE(0.0, loadTime.second);
+	}
+
+	std::vector<std::string> expected = {"imports", "exports", "pdbInfo", "resources", "certificates", "tlsInformation", "dotnetHeaders"};
+	EXPECT_EQ(expected, names);
+}
+
 } // namespace tests
 } // namespace fileformat
 } // namespace retdec
@@ -0,0 +1,175 @@
+/**
+ * @file tests/fileformat/string_scanner_tests.cpp
+ * @brief Tests for the @c string_scanner module.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/strings/character_iterator.h"
+#include "retdec/fileformat/types/strings/string_scanner.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+class StringScannerTests : public Test
+{
+	protected:
+		using Strings = std::vector<std::tuple<std::uint64_t, int, std::uint64_t>>;
+
+		Strings sorted(const std::vector<StringRecord>& records)
+		{
+			Strings result;
+			for (const auto& r : records)
+				result.emplace_back(r.offset, static_cast<int>(r.type), r.length);
+			std::sort(result.begin(), result.end());
+			return result;
+		}
+
+		std::vector<StringRecord> scan(const std::vector<std::uint8_t>& data, CharacterEndianness endian, std::size_t minLength = 4)
+		{
+			std::vector<StringRecord> result;
+			scanStrings(data.data(), data.size(), endian, minLength, result);
+			return result;
+		}
+
+		/**
+		 * Searches strings of a single type character by character.
+		 */
+		std::vector<StringRecord> scanReference(const std::vector<std::uint8_t>& data, CharacterEndianness endian, std::size_t minLength = 4)
+		{
+			std::vector<StringRecord> result;
+			for (auto type : {StringType::Ascii, StringType::Wide})
+			{
+				auto charSize = getStringCharSize(type);
+				for (auto begin = data.begin(), end = data.end(), itr = begin; itr != end;)
+				{
+					// Do not let the character iterator read behind the data.
+					if (static_cast<std::size_t>(end - itr) >= charSize
+							&& makeCharacterIterator(itr, begin, end, charSize).pointsToValidCharacter(endian))
+					{
+						auto stringEnd = itr;
+						while (static_cast<std::size_t>(end - stringEnd) >= charSize
+								&& makeCharacterIterator(stringEnd, begin, end, charSize).pointsToValidCharacter(endian))
+						{
+							stringEnd += charSize;
+						}
+
+						std::uint64_t length = (stringEnd - itr) / charSize;
+						if (length >= minLength)
+							result.push_back({type, static_cast<std::uint64_t>(itr - begin), length});
+
+						itr = stringEnd;
+					}
+					else
+						++itr;
+				}
+			}
+			return result;
+		}
+
+		std::vector<std::uint8_t> bytes(const std::string& str)
+		{
+			return std::vector<std::uint8_t>(str.begin(), str.end());
+		}
+};
+
+TEST_F(StringScannerTests,
+FindsAsciiStrings)
+{
+	auto data = bytes(std::string("\x01\x02hello\x00wor\x00longer string", 28));
+	auto result = scan(data, CharacterEndianness::Little);
+
+	ASSERT_EQ(2, result.size());
+	std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) { return a.offset < b.offset; });
+	EXPECT_EQ(StringType::Ascii, result[0].type);
+	EXPECT_EQ(2, result[0].offset);
+	EXPECT_EQ(5, result[0].length);
+	EXPECT_EQ(StringType::Ascii, result[1].type);
+	EXPECT_EQ(12, result[1].offset);
+	EXPECT_EQ(13, result[1].length);
+}
+
+TEST_F(StringScannerTests,
+FindsLittleEndianWideStrings)
+{
+	auto data = bytes(std::string("\x01w\x00i\x00""d\x00""e\x00\x01", 11));
+	auto result = scan(data, CharacterEndianness::Little);
+
+	ASSERT_EQ(1, result.size());
+	EXPECT_EQ(StringType::Wide, result[0].type);
+	EXPECT_EQ(1, result[0].offset);
+	EXPECT_EQ(4, result[0].length);
+}
+
+TEST_F(StringScannerTests,
+FindsBigEndianWideStrings)
+{
+	auto data = bytes(std::string("\x00w\x00i\x00""d\x00""e", 8));
+	auto result = scan(data, CharacterEndianness::Big);
+
+	ASSERT_EQ(1, result.size());
+	EXPECT_EQ(StringType::Wide, result[0].type);
+	EXPECT_EQ(0, result[0].offset);
+	EXPECT_EQ(4, result[0].length);
+}
+
+TEST_F(StringScannerTests,
+IgnoresIncompleteWideCharacterAtEnd)
+{
+	auto data = bytes(std::string("a\x00""b\x00""c\x00""d", 7));
+
+	EXPECT_TRUE(scan(data, CharacterEndianness::Little).empty());
+}
+
+TEST_F(StringScannerTests,
+GivesSameResultsAsCharacterIterator)
+{
+	std::mt19937 gen(42);
+	// Runs of printable characters, wide characters, random bytes and zeros,
+	// so that all kinds of strings and blocks for the fast paths are generated.
+	std::discrete_distribution<int> kind({4, 4, 2, 2});
+	std::uniform_int_distribution<int> printable(0x20, 0x7e);
+	std::uniform_int_distribution<int> any(0, 0xff);
+	std::uniform_int_distribution<int> runLength(1, 24);
+
+	for (int round = 0; round < 200; ++round)
+	{
+		std::vector<std::uint8_t> data;
+		while (data.size() < 1000)
+		{
+			auto k = kind(gen);
+			auto n = runLength(gen);
+			for (int i = 0; i < n; ++i)
+			{
+				if (k == 0)
+					data.push_back(printable(gen));
+				else if (k == 1)
+				{
+					data.push_back(printable(gen));
+					data.push_back(0);
+				}
+				else if (k == 2)
+					data.push_back(any(gen));
+				else
+					data.push_back(0);
+			}
+		}
+
+		for (auto endian : {CharacterEndianness::Little, CharacterEndianness::Big})
+		{
+			ASSERT_EQ(sorted(scanReference(data, endian)), sorted(scan(data, endian))) << "round " << round;
+		}
+	}
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -111,6 +111,28 @@ TEST_F(LlvmIrEmulatorTests, getVisitedInstructionsComplex)
 	EXPECT_TRUE(emu.wasBasicBlockVisited(f->getParent()));
 }
 
+TEST_F(LlvmIrEmulatorTests, setTracingDisablesVisitedInstructions)
+{
+	parseInput(R"(
+		define i32 @f() {
+			%a = add i32 1, 2    ; 1 + 2 = 3
+			%b = add i32 %a, 3   ; 3 + 3 = 6
+			ret i32 %b
+		}
+	)");
+	auto* f = getFunctionByName("f");
+	auto* a = getInstructionByName("a");
+
+	LlvmIrEmulator emu(module.get());
+	emu.setTracing(false);
+	emu.runFunction(f);
+
+	EXPECT_TRUE(emu.getVisitedInstructions().empty());
+	EXPECT_TRUE(emu.getVisitedBasicBlocks().empty());
+	EXPECT_FALSE(emu.wasInstructionVisited(a));
+	EXPECT_EQ(6, emu.getExitValue().IntVal.getZExtValue());
+}
+
 //
 // getExitValue()
 //
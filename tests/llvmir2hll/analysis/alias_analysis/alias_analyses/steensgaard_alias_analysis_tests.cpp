@@ -0,0 +1,377 @@
+/**
+* @file tests/llvmir2hll/analysis/alias_analysis/alias_analyses/steensgaard_alias_analysis_tests.cpp
+* @brief Tests for the @c steensgaard_alias_analysis module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analyses/steensgaard_alias_analysis.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/address_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/call_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/deref_op_expr.h"
+#include "retdec/llvmir2hll/ir/function_builder.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/pointer_type.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/var_def_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c steensgaard_alias_analysis module.
+*/
+class SteensgaardAliasAnalysisTests: public TestsWithModule {
+protected:
+	virtual void SetUp() override {
+		TestsWithModule::SetUp();
+		analysis = SteensgaardAliasAnalysis::create();
+	}
+
+	ShPtr<Variable> addLocalVar(const std::string &name, ShPtr<Type> type);
+
+protected:
+	ShPtr<AliasAnalysis> analysis;
+};
+
+/**
+* @brief Creates a local variable of @c testFunc.
+*/
+ShPtr<Variable> SteensgaardAliasAnalysisTests::addLocalVar(
+		const std::string &name, ShPtr<Type> type) {
+	ShPtr<Variable> var(Variable::create(name, type));
+	testFunc->addLocalVar(var);
+	return var;
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+AnalysisHasNonEmptyID) {
+	EXPECT_TRUE(!analysis->getId().empty()) <<
+		"the analysis should have a non-empty ID";
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+AfterCallingInitItIsInitialized) {
+	analysis->init(module);
+
+	EXPECT_TRUE(analysis->isInitialized()) <<
+		"the analysis should be initialized by now";
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+LocalNonPointerVariableDoesNotPointToAnything) {
+	// void test() {
+	//     int a;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	testFunc->setBody(VarDefStmt::create(varA));
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet(), analysis->mayPointTo(varA));
+	EXPECT_EQ(ShPtr<Variable>(), analysis->pointsTo(varA));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+PointerMayPointOnlyToVariablesWhoseAddressIsAssignedIntoIt) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;
+	//     int *q = &b;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<Variable> varQ(addLocalVar("q", PointerType::create(IntType::create(32))));
+	ShPtr<VarDefStmt> varDefQ(VarDefStmt::create(varQ, AddressOpExpr::create(varB)));
+	ShPtr<VarDefStmt> varDefP(VarDefStmt::create(varP, AddressOpExpr::create(varA), varDefQ));
+	ShPtr<VarDefStmt> varDefB(VarDefStmt::create(varB, ShPtr<Expression>(), varDefP));
+	ShPtr<VarDefStmt> varDefA(VarDefStmt::create(varA, ShPtr<Expression>(), varDefB));
+	testFunc->setBody(varDefA);
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varP));
+	EXPECT_EQ(VarSet({varB}), analysis->mayPointTo(varQ));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+AssignmentBetweenPointersMergesWhatTheyMayPointTo) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;
+	//     int *q = &b;
+	//     p = q;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<Variable> varQ(addLocalVar("q", PointerType::create(IntType::create(32))));
+	ShPtr<AssignStmt> assignPQ(AssignStmt::create(varP, varQ));
+	ShPtr<VarDefStmt> varDefQ(VarDefStmt::create(varQ, AddressOpExpr::create(varB), assignPQ));
+	ShPtr<VarDefStmt> varDefP(VarDefStmt::create(varP, AddressOpExpr::create(varA), varDefQ));
+	testFunc->setBody(varDefP);
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA, varB}), analysis->mayPointTo(varP));
+	EXPECT_EQ(VarSet({varA, varB}), analysis->mayPointTo(varQ));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+AssignmentThroughDereferenceIsTracked) {
+	// void test() {
+	//     int a;
+	//     int *p;
+	//     int **pp = &p;
+	//     *pp = &a;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<Variable> varPP(addLocalVar("pp",
+		PointerType::create(PointerType::create(IntType::create(32)))));
+	ShPtr<AssignStmt> assignDerefPP(AssignStmt::create(
+		DerefOpExpr::create(varPP), AddressOpExpr::create(varA)));
+	ShPtr<VarDefStmt> varDefPP(VarDefStmt::create(varPP, AddressOpExpr::create(varP),
+		assignDerefPP));
+	testFunc->setBody(varDefPP);
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varP));
+	EXPECT_EQ(VarSet({varP}), analysis->mayPointTo(varPP));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+GlobalPointerMayPointToAnythingWithAddressTaken) {
+	// int *g;
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	//     g = &a;
+	//     int *q = &b;
+	// }
+	ShPtr<Variable> varG(Variable::create("g", PointerType::create(IntType::create(32))));
+	module->addGlobalVar(varG);
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varQ(addLocalVar("q", PointerType::create(IntType::create(32))));
+	ShPtr<VarDefStmt> varDefQ(VarDefStmt::create(varQ, AddressOpExpr::create(varB)));
+	ShPtr<AssignStmt> assignGA(AssignStmt::create(varG, AddressOpExpr::create(varA), varDefQ));
+	testFunc->setBody(assignGA);
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA, varB}), analysis->mayPointTo(varG));
+	EXPECT_EQ(VarSet({varB}), analysis->mayPointTo(varQ));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+ParameterOfDirectlyCalledFuncMayPointToPassedArguments) {
+	// void callee(int *x) {
+	// }
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	//     callee(&a);
+	//     int *q = &b;
+	// }
+	ShPtr<Variable> varX(Variable::create("x", PointerType::create(IntType::create(32))));
+	ShPtr<Function> callee(
+		FunctionBuilder("callee")
+			.definitionWithEmptyBody()
+			.withParam(varX)
+			.build()
+	);
+	module->addFunc(callee);
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varQ(addLocalVar("q", PointerType::create(IntType::create(32))));
+	ShPtr<VarDefStmt> varDefQ(VarDefStmt::create(varQ, AddressOpExpr::create(varB)));
+	ShPtr<CallStmt> callCallee(CallStmt::create(CallExpr::create(
+		callee->getAsVar(), ExprVector{AddressOpExpr::create(varA)}), varDefQ));
+	testFunc->setBody(callCallee);
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varX));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+ParameterOfFuncThatIsNotCalledDirectlyMayPointToAnythingWithAddressTaken) {
+	// void test(int *x) {
+	//     int a;
+	//     int *p = &a;
+	// }
+	ShPtr<Variable> varX(Variable::create("x", PointerType::create(IntType::create(32))));
+	testFunc->addParam(varX);
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA)));
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varX));
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varP));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+ReinitializationKeepsResultsOfRemovedStatementsAndAddsNewOnes) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;  // Replaced with `int *p = &b;` after the first init().
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<AddressOpExpr> addressOfA(AddressOpExpr::create(varA));
+	testFunc->setBody(VarDefStmt::create(varP, addressOfA));
+	analysis->init(module);
+	ASSERT_EQ(VarSet({varA}), analysis->mayPointTo(varP));
+
+	Expression::replaceExpression(addressOfA, AddressOpExpr::create(varB));
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA, varB}), analysis->mayPointTo(varP));
+	EXPECT_TRUE(analysis->mayBePointed(varB));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+VariableWithAddressTakenMayBePointed) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA)));
+
+	analysis->init(module);
+
+	EXPECT_TRUE(analysis->mayBePointed(varA));
+	EXPECT_FALSE(analysis->mayBePointed(varB));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+PointerThatMayPointOnlyToSingleVariablePointsToIt) {
+	// void test() {
+	//     int a;
+	//     int *p = &a;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA)));
+
+	analysis->init(module);
+
+	EXPECT_EQ(varA, analysis->pointsTo(varP));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+PointerThatMayPointToSeveralVariablesDoesNotPointToAnyOfThem) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;
+	//     p = &b;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<AssignStmt> assignPB(AssignStmt::create(varP, AddressOpExpr::create(varB)));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA), assignPB));
+
+	analysis->init(module);
+
+	EXPECT_EQ(ShPtr<Variable>(), analysis->pointsTo(varP));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+PointerIntoWhichOffsetMayBeAddedDoesNotPointToAnyVariable) {
+	// void test() {
+	//     int a;
+	//     int *p = &a;
+	//     int *q = p + 1;
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<Variable> varQ(addLocalVar("q", PointerType::create(IntType::create(32))));
+	ShPtr<VarDefStmt> varDefQ(VarDefStmt::create(varQ,
+		AddOpExpr::create(varP, ConstInt::create(1, 32))));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA), varDefQ));
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varQ));
+	EXPECT_EQ(ShPtr<Variable>(), analysis->pointsTo(varP));
+	EXPECT_EQ(ShPtr<Variable>(), analysis->pointsTo(varQ));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+PointerThatMayPointToStringLiteralDoesNotPointToAnyVariable) {
+	// void test() {
+	//     int a;
+	//     int *p = &a;
+	//     p = "string";
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<AssignStmt> assignPString(AssignStmt::create(varP,
+		ConstString::create("string")));
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA), assignPString));
+
+	analysis->init(module);
+
+	EXPECT_EQ(VarSet({varA}), analysis->mayPointTo(varP));
+	EXPECT_EQ(ShPtr<Variable>(), analysis->pointsTo(varP));
+}
+
+TEST_F(SteensgaardAliasAnalysisTests,
+ReinitializationChangesResultsOnlyWhenConstraintsChange) {
+	// void test() {
+	//     int a;
+	//     int b;
+	//     int *p = &a;  // Replaced with `int *p = &b;` after the second init().
+	// }
+	ShPtr<Variable> varA(addLocalVar("a", IntType::create(32)));
+	ShPtr<Variable> varB(addLocalVar("b", IntType::create(32)));
+	ShPtr<Variable> varP(addLocalVar("p", PointerType::create(IntType::create(32))));
+	ShPtr<AddressOpExpr> addressOfA(AddressOpExpr::create(varA));
+	ShPtr<VarDefStmt> varDefP(VarDefStmt::create(varP, addressOfA));
+	testFunc->setBody(varDefP);
+
+	analysis->init(module);
+	EXPECT_TRUE(analysis->resultsChangedByLastInit());
+
+	// The statement is re-created, so the function is re-analyzed, but the
+	// constraints stay the same.
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varA)));
+	analysis->init(module);
+	EXPECT_FALSE(analysis->resultsChangedByLastInit());
+
+	testFunc->setBody(VarDefStmt::create(varP, AddressOpExpr::create(varB)));
+	analysis->init(module);
+	EXPECT_TRUE(analysis->resultsChangedByLastInit());
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
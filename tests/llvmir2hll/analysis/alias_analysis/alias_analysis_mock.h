@@ -22,6 +22,7 @@ class AliasAnalysisMock: public AliasAnalysis {
 public:
 	MOCK_METHOD1(init, void (ShPtr<Module> module));
 	MOCK_CONST_METHOD0(isInitialized, bool ());
+	MOCK_CONST_METHOD0(resultsChangedByLastInit, bool ());
 	MOCK_CONST_METHOD1(mayPointTo, const VarSet & (ShPtr<Variable> var));
 	MOCK_CONST_METHOD1(pointsTo, ShPtr<Variable> (ShPtr<Variable> var));
 	MOCK_CONST_METHOD1(mayBePointed, bool (ShPtr<Variable> var));
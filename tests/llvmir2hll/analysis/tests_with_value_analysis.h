@@ -49,6 +49,8 @@
 		.WillByDefault(::testing::Return(false)); \
 	ON_CALL(*aliasAnalysisMock, isInitialized()) \
 		.WillByDefault(::testing::Return(true)); \
+	ON_CALL(*aliasAnalysisMock, resultsChangedByLastInit()) \
+		.WillByDefault(::testing::Return(true)); \
 	/* (3) */ \
 	ShPtr<ValueAnalysis> va(ValueAnalysis::create(aliasAnalysis, false))
 
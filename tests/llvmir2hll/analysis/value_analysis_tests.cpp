@@ -64,6 +64,8 @@
 		.WillByDefault(Return(false)); \
 	ON_CALL(*aliasAnalysisMock, isInitialized()) \
 		.WillByDefault(Return(true)); \
+	ON_CALL(*aliasAnalysisMock, resultsChangedByLastInit()) \
+		.WillByDefault(Return(true)); \
 	/* (4) */ \
 	ShPtr<ValueAnalysis> va(ValueAnalysis::create(aliasAnalysis, useCache))
 
@@ -700,6 +702,68 @@ AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 	EXPECT_EQ(varB, *newReadVarsInReturnA.begin());
 }
 
+TEST_F(ValueAnalysisTests,
+AfterChangeOfAliasAnalysisResultsOnlyValuesWithDereferencesAreRecomputed) {
+	// Set-up the module.
+	//
+	// a
+	// p
+	//
+	// void test() {
+	//     return a;
+	//     return *p;
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	module->addGlobalVar(varA);
+	ShPtr<Variable> varP(Variable::create("p",
+		PointerType::create(IntType::create(32))));
+	module->addGlobalVar(varP);
+	ShPtr<ReturnStmt> returnDerefP(ReturnStmt::create(DerefOpExpr::create(varP)));
+	ShPtr<ReturnStmt> returnA(ReturnStmt::create(varA, returnDerefP));
+	testFunc->setBody(returnA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> returnAData(va->getValueData(returnA));
+	ASSERT_EQ(VarSet(), va->getValueData(returnDerefP)->getMayBeReadVars());
+
+	// Now, make `p` point to `a` and re-initialize the alias analysis.
+	VarSet mayPointToVars{varA};
+	ON_CALL(*aliasAnalysisMock, mayPointTo(varP))
+		.WillByDefault(ReturnRef(mayPointToVars));
+	va->initAliasAnalysis(module);
+
+	EXPECT_EQ(returnAData, va->getValueData(returnA));
+	EXPECT_EQ(VarSet({varA}), va->getValueData(returnDerefP)->getMayBeReadVars());
+}
+
+TEST_F(ValueAnalysisTests,
+WhenAliasAnalysisResultsDoNotChangeCachedValuesWithDereferencesAreKept) {
+	// Set-up the module.
+	//
+	// p
+	//
+	// void test() {
+	//     return *p;
+	// }
+	//
+	ShPtr<Variable> varP(Variable::create("p",
+		PointerType::create(IntType::create(32))));
+	module->addGlobalVar(varP);
+	ShPtr<ReturnStmt> returnDerefP(ReturnStmt::create(DerefOpExpr::create(varP)));
+	testFunc->setBody(returnDerefP);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+	ON_CALL(*aliasAnalysisMock, resultsChangedByLastInit())
+		.WillByDefault(Return(false));
+
+	ShPtr<ValueData> returnDerefPData(va->getValueData(returnDerefP));
+	va->initAliasAnalysis(module);
+
+	EXPECT_EQ(returnDerefPData, va->getValueData(returnDerefP));
+}
+
 TEST_F(ValueAnalysisTests,
 MayBeReadNoCaching) {
 	// Set-up the module.
@@ -1224,6 +1288,103 @@ DelegationOfMethodsToAliasAnalysis) {
 	va->initAliasAnalysis(module);
 }
 
+TEST_F(ValueAnalysisTests,
+VarIndexesAreDenseWithinFunction) {
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	VarBitSet refA;
+	refA.insert(0);
+	VarBitSet refB;
+	refB.insert(1);
+	EXPECT_EQ(refA, va->getVarBitSet(VarSet{varA}, testFunc));
+	EXPECT_EQ(refB, va->getVarBitSet(VarSet{varB}, testFunc));
+	EXPECT_EQ(refA, va->getVarBitSet(VarSet{varA}, testFunc));
+
+	// Variables of another function are numbered from zero.
+	EXPECT_EQ(refA, va->getVarBitSet(VarSet{varB}, otherFunc));
+
+	// The numbering is restarted when the cache is cleared.
+	va->clearCache();
+	EXPECT_EQ(refA, va->getVarBitSet(VarSet{varB}, otherFunc));
+}
+
+TEST_F(ValueAnalysisTests,
+VarBitSetsCorrespondToVarSets) {
+	// Set-up the module.
+	//
+	// a
+	//
+	// void test() {
+	//     int b;
+	//     int *p = &a;
+	//     *p = b;
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	module->addGlobalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<Variable> varP(Variable::create("p",
+		PointerType::create(IntType::create(32))));
+	testFunc->addLocalVar(varP);
+	ShPtr<AssignStmt> assignP(AssignStmt::create(
+		DerefOpExpr::create(varP), varB));
+	ShPtr<VarDefStmt> varDefP(VarDefStmt::create(
+		varP, AddressOpExpr::create(varA), assignP));
+	testFunc->setBody(varDefP);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(false);
+
+	// Set-up default actions.
+	VarSet refPMayPointTo;
+	refPMayPointTo.insert(varA);
+	ON_CALL(*aliasAnalysisMock, mayPointTo(varP))
+		.WillByDefault(ReturnRef(refPMayPointTo));
+	ON_CALL(*aliasAnalysisMock, mayBePointed(varA))
+		.WillByDefault(Return(true));
+
+	ShPtr<ValueData> data(va->getValueData(assignP));
+	EXPECT_EQ(va->getVarBitSet(VarSet{varA}, testFunc),
+		va->getWrittenVarBits(data, testFunc));
+	EXPECT_TRUE(va->getSurelyWrittenVarBits(data, testFunc).empty());
+}
+
+TEST_F(ValueAnalysisTests,
+VarBitSetsAreRecomputedWhenVariablesOfAnotherFunctionAreNumbered) {
+	// Set-up the module.
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	//     b = 1;
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<AssignStmt> assignB(AssignStmt::create(varB, ConstInt::create(1, 32)));
+	testFunc->setBody(assignB);
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> data(va->getValueData(assignB));
+	va->getVarBitSet(VarSet{varA}, testFunc);
+	EXPECT_EQ(va->getVarBitSet(VarSet{varB}, testFunc),
+		va->getSurelyWrittenVarBits(data, testFunc));
+
+	va->getVarBitSet(VarSet{varA, varB}, otherFunc);
+	VarBitSet refB;
+	refB.insert(0);
+	EXPECT_EQ(refB, va->getSurelyWrittenVarBits(data, testFunc));
+	EXPECT_EQ(refB, va->getWrittenVarBits(data, testFunc));
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -0,0 +1,123 @@
+/**
+* @file tests/llvmir2hll/graphs/cfg/cfg_writers/json_cfg_writer_tests.cpp
+* @brief Tests for the @c json_cfg_writer module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <iostream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/graphs/cfg/cfg.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writers/json_cfg_writer.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c json_cfg_writer module.
+*/
+class JsonCFGWriterTests: public TestsWithModule {
+protected:
+	std::string emitCFG(ShPtr<CFG> cfg);
+};
+
+/**
+* @brief Emits @a cfg by JsonCFGWriter and returns the emitted JSON.
+*/
+std::string JsonCFGWriterTests::emitCFG(ShPtr<CFG> cfg) {
+	std::ostringstream out;
+	JsonCFGWriter::create(cfg, out)->emitCFG();
+	return out.str();
+}
+
+TEST_F(JsonCFGWriterTests,
+WriterHasNonEmptyID) {
+	ShPtr<CFG> cfg(new CFG(testFunc));
+
+	EXPECT_TRUE(!JsonCFGWriter::create(cfg, std::cout)->getId().empty()) <<
+		"the writer should have a non-empty ID";
+}
+
+TEST_F(JsonCFGWriterTests,
+NodesAreIdentifiedByTheirIndexesAndEdgesHaveConditions) {
+	// void test() {
+	//     a = 1;
+	//     (a < 2) ? return : <exit>
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, ConstInt::create(1, 32)));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create());
+
+	ShPtr<CFG> cfg(new CFG(testFunc));
+	cfg->addEntryNode(ShPtr<CFG::Node>(new CFG::Node("entry")));
+	ShPtr<CFG::Node> nodeA(new CFG::Node());
+	nodeA->addStmt(assignA);
+	cfg->addNode(nodeA);
+	ShPtr<CFG::Node> nodeRet(new CFG::Node());
+	nodeRet->addStmt(returnStmt);
+	cfg->addNode(nodeRet);
+	cfg->addExitNode(ShPtr<CFG::Node>(new CFG::Node("exit")));
+	cfg->addEdge(cfg->getEntryNode(), nodeA);
+	cfg->addEdge(nodeA, nodeRet,
+		LtOpExpr::create(varA, ConstInt::create(2, 32)));
+	cfg->addEdge(nodeA, cfg->getExitNode());
+	cfg->addEdge(nodeRet, cfg->getExitNode());
+
+	EXPECT_EQ(
+		R"({"function":"test","entry":0,"exit":3,)"
+		R"("nodes":[{"label":"entry","stmts":[]},)"
+			R"({"stmts":["a = 1"]},{"stmts":["return"]},)"
+			R"({"label":"exit","stmts":[]}],)"
+		R"json("edges":[{"src":0,"dst":1},{"src":1,"dst":2,"cond":"(a < 2)"},)json"
+			R"({"src":1,"dst":3},{"src":2,"dst":3}]})",
+		emitCFG(cfg)
+	);
+}
+
+TEST_F(JsonCFGWriterTests,
+NewlinesInTextOfStatementsAreEscaped) {
+	// void test() {
+	//     if (a < 2) {
+	//         a = 1;
+	//     } else {
+	//         a = 2;
+	//     }
+	// }
+	//
+	// The textual representation of the if statement is "if (a < 2):\nelse:".
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(
+		LtOpExpr::create(varA, ConstInt::create(2, 32)),
+		AssignStmt::create(varA, ConstInt::create(1, 32))));
+	ifStmt->setElseClause(AssignStmt::create(varA, ConstInt::create(2, 32)));
+	ShPtr<CFG> cfg(new CFG(testFunc));
+	cfg->addEntryNode(ShPtr<CFG::Node>(new CFG::Node("entry")));
+	ShPtr<CFG::Node> node(new CFG::Node());
+	node->addStmt(ifStmt);
+	cfg->addNode(node);
+	cfg->addEdge(cfg->getEntryNode(), node);
+	ASSERT_NE(std::string::npos, ifStmt->getTextRepr().find('\n'));
+
+	auto json = emitCFG(cfg);
+
+	EXPECT_EQ(std::string::npos, json.find('\n'));
+	EXPECT_NE(std::string::npos, json.find(R"json("if (a < 2):\nelse:")json"));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -206,6 +206,12 @@ TEST_F(JsonOutputManagerTests, token_comment)
 	EXPECT_EQ(R"({"kind":"cmnt","val":"// hello world"})", emitSingleToken());
 }
 
+TEST_F(JsonOutputManagerTests, token_comment_newlines_are_replaced_with_spaces)
+{
+	manager->comment("hello\nworld\n");
+	EXPECT_EQ(R"({"kind":"cmnt","val":"// hello world "})", emitSingleToken());
+}
+
 //
 // commentModifier()
 //
@@ -247,6 +253,52 @@ TEST_F(JsonOutputManagerTests, address_push_and_pop_do_nothing)
 		emitSingleToken());
 }
 
+//
+// flush()
+//
+
+TEST_F(JsonOutputManagerTests, flush_does_not_change_generated_json)
+{
+	manager->functionId("f");
+	manager->flush();
+	manager->functionId("g");
+
+	EXPECT_EQ(
+		R"({"kind":"i_fnc","val":"f"},{"kind":"i_fnc","val":"g"})",
+		emitSingleToken());
+}
+
+TEST_F(JsonOutputManagerTests, flush_in_lines_mode_generates_object_per_line)
+{
+	manager = UPtr<OutputManager>(new JsonOutputManagerPlain(codeStream, true));
+	manager->setOutputLanguage("C");
+
+	manager->addressPush(0x1000);
+	manager->functionId("f");
+	manager->flush();
+	manager->functionId("g");
+	manager->addressPop();
+
+	EXPECT_EQ(
+		R"({"tokens":[{"addr":""},{"addr":"0x1000"},{"kind":"i_fnc","val":"f"}],"language":"C"})" "\n"
+		R"({"tokens":[{"addr":"0x1000"},{"kind":"i_fnc","val":"g"}],"language":"C"})" "\n",
+		emitCode());
+}
+
+TEST_F(JsonOutputManagerTests, lines_mode_does_not_generate_trailing_empty_object)
+{
+	manager = UPtr<OutputManager>(new JsonOutputManagerPlain(codeStream, true));
+	manager->setOutputLanguage("C");
+
+	manager->functionId("f");
+	manager->flush();
+	manager->flush();
+
+	EXPECT_EQ(
+		R"({"tokens":[{"addr":""},{"kind":"i_fnc","val":"f"}],"language":"C"})" "\n",
+		emitCode());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
\ No newline at end of file
@@ -171,6 +171,12 @@ TEST_F(PlainOutputManagerTests, token_comment)
 	EXPECT_EQ("// hello world", emitCode());
 }
 
+TEST_F(PlainOutputManagerTests, token_comment_newlines_are_replaced_with_spaces)
+{
+	manager->comment("hello\nworld\n");
+	EXPECT_EQ("// hello world ", emitCode());
+}
+
 //
 // commentModifier()
 //
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/pointer_type.h"
 #include "retdec/llvmir2hll/ir/struct_type.h"
 
 using namespace ::testing;
@@ -68,6 +69,45 @@ getNameAfterCreateWithElementsReturnsCorrectName) {
 	EXPECT_EQ(refName, st->getName());
 }
 
+//
+// isEqualTo()
+//
+
+TEST_F(StructTypeTests,
+isEqualToForSameStructReturnsTrue) {
+	StructType::ElementTypes elementTypes;
+	elementTypes.push_back(IntType::create(32));
+	ShPtr<StructType> st(StructType::create(elementTypes, "MyStruct"));
+
+	EXPECT_TRUE(st->isEqualTo(st));
+}
+
+TEST_F(StructTypeTests,
+isEqualToForStructsWithDifferentNamesReturnsFalse) {
+	StructType::ElementTypes elementTypes;
+	elementTypes.push_back(IntType::create(32));
+	ShPtr<StructType> st1(StructType::create(elementTypes, "MyStruct1"));
+	ShPtr<StructType> st2(StructType::create(elementTypes, "MyStruct2"));
+
+	EXPECT_FALSE(st1->isEqualTo(st2));
+}
+
+TEST_F(StructTypeTests,
+isEqualToForPointerToRecursiveStructReturnsTrueForSamePointer) {
+	// struct MyStruct { struct MyStruct *next; };
+	ShPtr<PointerType> ptrType(PointerType::create(IntType::create(32)));
+	StructType::ElementTypes elementTypes;
+	elementTypes.push_back(ptrType);
+	ShPtr<StructType> st(StructType::create(elementTypes, "MyStruct"));
+	ptrType->setContainedType(st);
+
+	EXPECT_TRUE(ptrType->isEqualTo(ptrType));
+	EXPECT_FALSE(ptrType->isEqualTo(PointerType::create(IntType::create(32))));
+
+	// Break the reference cycle so the types can be freed.
+	ptrType->setContainedType(IntType::create(32));
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
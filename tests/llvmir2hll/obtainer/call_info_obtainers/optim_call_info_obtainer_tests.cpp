@@ -0,0 +1,235 @@
+/**
+* @file tests/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer_tests.cpp
+* @brief Tests for the @c optim_call_info_obtainer module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "llvmir2hll/analysis/tests_with_value_analysis.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c optim_call_info_obtainer module.
+*/
+class OptimCallInfoObtainerTests: public TestsWithModule {
+protected:
+	ShPtr<Variable> addGlobalVar(const std::string &name);
+	ShPtr<Function> addFuncDefWithBody(const std::string &funcName,
+		ShPtr<Statement> body);
+};
+
+/**
+* @brief Adds an <tt>int name;</tt> global variable to the module.
+*/
+ShPtr<Variable> OptimCallInfoObtainerTests::addGlobalVar(
+		const std::string &name) {
+	ShPtr<Variable> var(Variable::create(name, IntType::create(32)));
+	module->addGlobalVar(var);
+	return var;
+}
+
+/**
+* @brief Adds a <tt>void funcName() { body }</tt> function definition to the
+*        module.
+*/
+ShPtr<Function> OptimCallInfoObtainerTests::addFuncDefWithBody(
+		const std::string &funcName, ShPtr<Statement> body) {
+	ShPtr<Function> func(addFuncDef(funcName));
+	func->setBody(body);
+	return func;
+}
+
+TEST_F(OptimCallInfoObtainerTests,
+MutuallyRecursiveFunctionsGetVarsAccessedAnywhereInTheirCycle) {
+	// Set-up the module.
+	//
+	// int g1;
+	// int g2;
+	// int g3;
+	//
+	// void f1() {
+	//     g1 = 1;
+	//     f2();
+	// }
+	//
+	// void f2() {
+	//     f3();
+	// }
+	//
+	// void f3() {
+	//     a = g2;
+	//     f1();
+	// }
+	//
+	// void test() {
+	//     f1();
+	// }
+	//
+	ShPtr<Variable> varG1(addGlobalVar("g1"));
+	ShPtr<Variable> varG2(addGlobalVar("g2"));
+	ShPtr<Variable> varG3(addGlobalVar("g3"));
+	ShPtr<Function> f1(addFuncDefWithBody("f1",
+		AssignStmt::create(varG1, ConstInt::create(1, 32))));
+	ShPtr<Function> f2(addFuncDef("f2"));
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Function> f3(addFuncDefWithBody("f3",
+		AssignStmt::create(varA, varG2)));
+	f3->addLocalVar(varA);
+	addCall("f1", "f2");
+	addCall("f2", "f3");
+	addCall("f3", "f1");
+	addCall("test", "f1");
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<CallInfoObtainer> cio(OptimCallInfoObtainer::create());
+	cio->init(CGBuilder::getCG(module), va);
+
+	// Check the result.
+	for (const auto &func : {f1, f2, f3, testFunc}) {
+		ShPtr<FuncInfo> funcInfo(cio->getFuncInfo(func));
+		EXPECT_TRUE(funcInfo->mayBeModified(varG1)) << func->getName();
+		EXPECT_FALSE(funcInfo->isNeverModified(varG1)) << func->getName();
+		EXPECT_TRUE(funcInfo->mayBeRead(varG2)) << func->getName();
+		EXPECT_FALSE(funcInfo->isNeverRead(varG2)) << func->getName();
+		EXPECT_FALSE(funcInfo->mayBeModified(varG2)) << func->getName();
+		EXPECT_TRUE(funcInfo->isNeverRead(varG3)) << func->getName();
+		EXPECT_TRUE(funcInfo->isNeverModified(varG3)) << func->getName();
+		EXPECT_TRUE(funcInfo->valueIsNeverChanged(varG3)) << func->getName();
+	}
+	EXPECT_FALSE(cio->getFuncInfo(f1)->mayBeModified(varA));
+	EXPECT_FALSE(cio->getFuncInfo(f2)->mayBeModified(varA));
+	EXPECT_FALSE(cio->getFuncInfo(testFunc)->mayBeModified(varA));
+}
+
+TEST_F(OptimCallInfoObtainerTests,
+ChangedInfoOfCalleeOutsideCycleIsPropagatedToWholeCycle) {
+	// Set-up the module.
+	//
+	// int g1;
+	// int g2;
+	//
+	// void h() {
+	//     g2 = 2;
+	// }
+	//
+	// void f1() {
+	//     f2();
+	// }
+	//
+	// void f2() {
+	//     g1 = 1;
+	//     f1();
+	//     h();
+	// }
+	//
+	// void test() {
+	//     h();
+	// }
+	//
+	ShPtr<Variable> varG1(addGlobalVar("g1"));
+	ShPtr<Variable> varG2(addGlobalVar("g2"));
+	ShPtr<Function> h(addFuncDefWithBody("h",
+		AssignStmt::create(varG2, ConstInt::create(2, 32))));
+	ShPtr<Function> f1(addFuncDef("f1"));
+	ShPtr<Function> f2(addFuncDefWithBody("f2",
+		AssignStmt::create(varG1, ConstInt::create(1, 32))));
+	addCall("f1", "f2");
+	addCall("f2", "f1");
+	addCall("f2", "h");
+	addCall("test", "h");
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<CallInfoObtainer> cio(OptimCallInfoObtainer::create());
+	cio->init(CGBuilder::getCG(module), va);
+
+	// Check the result.
+	for (const auto &func : {f1, f2}) {
+		ShPtr<FuncInfo> funcInfo(cio->getFuncInfo(func));
+		EXPECT_TRUE(funcInfo->mayBeModified(varG1)) << func->getName();
+		EXPECT_TRUE(funcInfo->mayBeModified(varG2)) << func->getName();
+		EXPECT_FALSE(funcInfo->mayBeRead(varG1)) << func->getName();
+		EXPECT_FALSE(funcInfo->mayBeRead(varG2)) << func->getName();
+	}
+	for (const auto &func : {h, testFunc}) {
+		ShPtr<FuncInfo> funcInfo(cio->getFuncInfo(func));
+		EXPECT_TRUE(funcInfo->isNeverModified(varG1)) << func->getName();
+		EXPECT_TRUE(funcInfo->isNeverRead(varG1)) << func->getName();
+		EXPECT_TRUE(funcInfo->mayBeModified(varG2)) << func->getName();
+	}
+}
+
+TEST_F(OptimCallInfoObtainerTests,
+ModifiedVarsArePropagatedAroundLongCycle) {
+	// Set-up the module.
+	//
+	// int g0;
+	// ...
+	// int g5;
+	//
+	// void f0() {
+	//     g0 = 0;
+	//     f1();
+	// }
+	// ...
+	// void f5() {
+	//     g5 = 5;
+	//     f0();
+	// }
+	//
+	// The info of every function changes several times before a fixed point
+	// is reached, so functions in the cycle have to be recomputed whenever
+	// the info of their callee changes.
+	//
+	const std::size_t FUNC_COUNT = 6;
+	VarVector globalVars;
+	FuncVector funcs;
+	for (std::size_t i = 0; i < FUNC_COUNT; ++i) {
+		auto n = std::to_string(i);
+		globalVars.push_back(addGlobalVar("g" + n));
+		funcs.push_back(addFuncDefWithBody("f" + n,
+			AssignStmt::create(globalVars.back(), ConstInt::create(i, 32))));
+	}
+	for (std::size_t i = 0; i < FUNC_COUNT; ++i) {
+		addCall(funcs[i]->getName(), funcs[(i + 1) % FUNC_COUNT]->getName());
+	}
+	ShPtr<Variable> varUnused(addGlobalVar("unused"));
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	ShPtr<CallInfoObtainer> cio(OptimCallInfoObtainer::create());
+	cio->init(CGBuilder::getCG(module), va);
+
+	// Check the result.
+	for (const auto &func : funcs) {
+		ShPtr<FuncInfo> funcInfo(cio->getFuncInfo(func));
+		for (const auto &var : globalVars) {
+			EXPECT_TRUE(funcInfo->mayBeModified(var)) <<
+				func->getName() << ", " << var->getName();
+			EXPECT_FALSE(funcInfo->isNeverModified(var)) <<
+				func->getName() << ", " << var->getName();
+		}
+		EXPECT_TRUE(funcInfo->isNeverModified(varUnused)) << func->getName();
+		EXPECT_TRUE(funcInfo->isNeverRead(varUnused)) << func->getName();
+	}
+	ShPtr<FuncInfo> testFuncInfo(cio->getFuncInfo(testFunc));
+	for (const auto &var : globalVars) {
+		EXPECT_TRUE(testFuncInfo->isNeverModified(var)) << var->getName();
+	}
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
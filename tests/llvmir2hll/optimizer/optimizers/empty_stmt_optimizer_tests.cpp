@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 
 #include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/empty_stmt.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/empty_stmt_optimizer.h"
 
 using namespace ::testing;
@@ -29,6 +31,38 @@ OptimizerHasNonEmptyID) {
 		"the optimizer should have a non-empty ID";
 }
 
+TEST_F(EmptyStmtOptimizerTests,
+EmptyStmtIsRemoved) {
+	// void test() {
+	//     ;
+	//     return;
+	// }
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create());
+	testFunc->setBody(EmptyStmt::create(returnStmt));
+
+	Optimizer::optimize<EmptyStmtOptimizer>(module);
+
+	EXPECT_EQ(returnStmt, testFunc->getBody());
+}
+
+TEST_F(EmptyStmtOptimizerTests,
+FuncsToSkipAreNotOptimized) {
+	// void test() {
+	//     ;
+	//     return;
+	// }
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create());
+	ShPtr<EmptyStmt> emptyStmt(EmptyStmt::create(returnStmt));
+	testFunc->setBody(emptyStmt);
+
+	ShPtr<EmptyStmtOptimizer> optimizer(new EmptyStmtOptimizer(module));
+	ASSERT_TRUE(optimizer->canSkipUnchangedFuncs());
+	optimizer->setFuncsToSkip({testFunc});
+	optimizer->optimize();
+
+	EXPECT_EQ(emptyStmt, testFunc->getBody());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -9,6 +9,7 @@
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
 #include "retdec/llvmir2hll/ir/const_float.h"
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/eq_op_expr.h"
@@ -223,6 +224,86 @@ BiggerAddAndSubAndMulExpression) {
 		"got `" << outConstInt << "`";
 }
 
+TEST_F(SimplifyArithmExprOptimizerTests,
+NestedAddsOfConstantsToVarAreFoldedIntoSingleAdd) {
+	// return ((a + 2) + 3) + 4;
+	//
+	// Optimized to return 9 + a.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	ShPtr<AddOpExpr> returnExpr(
+		AddOpExpr::create(
+			AddOpExpr::create(
+				AddOpExpr::create(
+					varA,
+					ConstInt::create(2, 64)
+				),
+				ConstInt::create(3, 64)
+			),
+			ConstInt::create(4, 64)
+	));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(returnExpr));
+	testFunc->setBody(returnStmt);
+
+	optimize(module);
+
+	ShPtr<AddOpExpr> outAddOpExpr(cast<AddOpExpr>(returnStmt->getRetVal()));
+	ASSERT_TRUE(outAddOpExpr) <<
+		"expected `AddOpExpr`, "
+		"got `" << returnStmt->getRetVal() << "`";
+	ShPtr<ConstInt> outOp1(cast<ConstInt>(outAddOpExpr->getFirstOperand()));
+	ASSERT_TRUE(outOp1) <<
+		"expected `ConstInt`, "
+		"got `" << outAddOpExpr->getFirstOperand() << "`";
+	ShPtr<ConstInt> result(ConstInt::create(9, 64));
+	EXPECT_EQ(result->getValue(), outOp1->getValue()) <<
+		"expected `" << result << "`, "
+		"got `" << outOp1 << "`";
+	EXPECT_EQ(varA, outAddOpExpr->getSecondOperand()) <<
+		"expected `" << varA << "`, "
+		"got `" << outAddOpExpr->getSecondOperand() << "`";
+}
+
+TEST_F(SimplifyArithmExprOptimizerTests,
+ReplacedExpressionIsFurtherOptimized) {
+	// return ((2 + 3) == a) == true;
+	//
+	// Optimized to return 5 == a.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	ShPtr<EqOpExpr> returnExpr(
+		EqOpExpr::create(
+			EqOpExpr::create(
+				AddOpExpr::create(
+					ConstInt::create(2, 64),
+					ConstInt::create(3, 64)
+				),
+				varA
+			),
+			ConstBool::create(true)
+	));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(returnExpr));
+	testFunc->setBody(returnStmt);
+
+	optimize(module);
+
+	ShPtr<EqOpExpr> outEqOpExpr(cast<EqOpExpr>(returnStmt->getRetVal()));
+	ASSERT_TRUE(outEqOpExpr) <<
+		"expected `EqOpExpr`, "
+		"got `" << returnStmt->getRetVal() << "`";
+	ShPtr<ConstInt> outOp1(cast<ConstInt>(outEqOpExpr->getFirstOperand()));
+	ASSERT_TRUE(outOp1) <<
+		"expected `ConstInt`, "
+		"got `" << outEqOpExpr->getFirstOperand() << "`";
+	ShPtr<ConstInt> result(ConstInt::create(5, 64));
+	EXPECT_EQ(result->getValue(), outOp1->getValue()) <<
+		"expected `" << result << "`, "
+		"got `" << outOp1 << "`";
+	EXPECT_EQ(varA, outEqOpExpr->getSecondOperand()) <<
+		"expected `" << varA << "`, "
+		"got `" << outEqOpExpr->getSecondOperand() << "`";
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
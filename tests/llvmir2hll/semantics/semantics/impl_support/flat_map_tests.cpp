@@ -0,0 +1,97 @@
+/**
+* @file tests/llvmir2hll/semantics/semantics/impl_support/flat_map_tests.cpp
+* @brief Tests for the @c flat_map module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/flat_map.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+namespace tests {
+
+/**
+* @brief Tests for the @c flat_map module.
+*/
+class FlatMapTests: public Test {};
+
+TEST_F(FlatMapTests,
+NewMapIsEmpty) {
+	FlatMap<std::string_view, std::string_view> map;
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(0, map.size());
+	EXPECT_EQ(nullptr, map.find("printf"));
+}
+
+TEST_F(FlatMapTests,
+FindReturnsInsertedValue) {
+	FlatMap<std::string_view, std::string_view> map;
+	map["printf"] = "stdio.h";
+	map["malloc"] = "stdlib.h";
+
+	ASSERT_NE(nullptr, map.find("printf"));
+	EXPECT_EQ("stdio.h", *map.find("printf"));
+	ASSERT_NE(nullptr, map.find(std::string("malloc")));
+	EXPECT_EQ("stdlib.h", *map.find(std::string("malloc")));
+	EXPECT_EQ(nullptr, map.find("free"));
+	EXPECT_EQ(2, map.size());
+}
+
+TEST_F(FlatMapTests,
+InsertingExistingKeyOverwritesValue) {
+	FlatMap<std::string_view, std::string_view> map;
+	map["signal"] = "signal.h";
+	map["signal"] = "sys/signal.h";
+
+	ASSERT_NE(nullptr, map.find("signal"));
+	EXPECT_EQ("sys/signal.h", *map.find("signal"));
+	EXPECT_EQ(1, map.size());
+}
+
+TEST_F(FlatMapTests,
+AllEntriesAreFoundAfterManyInsertions) {
+	std::vector<std::string> keys;
+	for (int i = 0; i < 5000; ++i) {
+		keys.push_back("func" + std::to_string(i));
+	}
+
+	FlatMap<std::string_view, int> map;
+	for (int i = 0, e = keys.size(); i != e; ++i) {
+		map[keys[i]] = i;
+	}
+
+	ASSERT_EQ(keys.size(), map.size());
+	for (int i = 0, e = keys.size(); i != e; ++i) {
+		ASSERT_NE(nullptr, map.find(keys[i]));
+		EXPECT_EQ(i, *map.find(keys[i]));
+	}
+	EXPECT_EQ(nullptr, map.find("func5000"));
+}
+
+TEST_F(FlatMapTests,
+FuncParamNamesMapDistinguishesParamPositions) {
+	FuncParamNamesMap funcParamNamesMap;
+	ADD_PARAM_NAME("fopen", 1, "file_path");
+	ADD_PARAM_NAME("fopen", 2, "mode");
+
+	std::string funcName("fopen");
+	EXPECT_EQ("file_path", *funcParamNamesMap.find(FuncParamPosPair(funcName, 1)));
+	EXPECT_EQ("mode", *funcParamNamesMap.find(FuncParamPosPair(funcName, 2)));
+	EXPECT_EQ(nullptr, funcParamNamesMap.find(FuncParamPosPair(funcName, 3)));
+}
+
+} // namespace tests
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,117 @@
+/**
+* @file tests/llvmir2hll/support/func_fingerprinter_tests.cpp
+* @brief Tests for the @c func_fingerprinter module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/func_fingerprinter.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c func_fingerprinter module.
+*/
+class FuncFingerprinterTests: public TestsWithModule {};
+
+TEST_F(FuncFingerprinterTests,
+FingerprintOfUnchangedFuncIsSame) {
+	// void test() {
+	//     a = a + 1;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->setBody(AssignStmt::create(varA,
+		AddOpExpr::create(varA, ConstInt::create(1, 32))));
+
+	EXPECT_EQ(FuncFingerprinter::getFingerprint(testFunc),
+		FuncFingerprinter::getFingerprint(testFunc));
+}
+
+TEST_F(FuncFingerprinterTests,
+FingerprintChangesWhenExpressionIsReplaced) {
+	// void test() {
+	//     a = a + 1;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<AddOpExpr> addOpExpr(AddOpExpr::create(varA, ConstInt::create(1, 32)));
+	testFunc->setBody(AssignStmt::create(varA, addOpExpr));
+	auto origFingerprint = FuncFingerprinter::getFingerprint(testFunc);
+
+	Expression::replaceExpression(addOpExpr,
+		SubOpExpr::create(varA, ConstInt::create(1, 32)));
+
+	EXPECT_NE(origFingerprint, FuncFingerprinter::getFingerprint(testFunc));
+}
+
+TEST_F(FuncFingerprinterTests,
+FingerprintChangesWhenConstantIsChangedInPlace) {
+	// void test() {
+	//     a = a + 1;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<ConstInt> constInt(ConstInt::create(1, 32));
+	testFunc->setBody(AssignStmt::create(varA,
+		AddOpExpr::create(varA, constInt)));
+	auto origFingerprint = FuncFingerprinter::getFingerprint(testFunc);
+
+	constInt->flipSign();
+
+	EXPECT_NE(origFingerprint, FuncFingerprinter::getFingerprint(testFunc));
+}
+
+TEST_F(FuncFingerprinterTests,
+FingerprintChangesWhenVariableIsRenamed) {
+	// void test() {
+	//     a = 1;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->setBody(AssignStmt::create(varA, ConstInt::create(1, 32)));
+	auto origFingerprint = FuncFingerprinter::getFingerprint(testFunc);
+
+	varA->setName("b");
+
+	EXPECT_NE(origFingerprint, FuncFingerprinter::getFingerprint(testFunc));
+}
+
+TEST_F(FuncFingerprinterTests,
+FingerprintChangesWhenStatementIsAppended) {
+	// void test() {
+	//     a = 1;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<AssignStmt> assignStmt(AssignStmt::create(varA,
+		ConstInt::create(1, 32)));
+	testFunc->setBody(assignStmt);
+	auto origFingerprint = FuncFingerprinter::getFingerprint(testFunc);
+
+	assignStmt->appendStatement(ReturnStmt::create());
+
+	EXPECT_NE(origFingerprint, FuncFingerprinter::getFingerprint(testFunc));
+}
+
+TEST_F(FuncFingerprinterTests,
+GlobalVarsFingerprintChangesWhenGlobalVarIsAdded) {
+	auto origFingerprint = FuncFingerprinter::getGlobalVarsFingerprint(module);
+
+	module->addGlobalVar(Variable::create("g", IntType::create(32)),
+		ConstInt::create(1, 32));
+
+	EXPECT_NE(origFingerprint, FuncFingerprinter::getGlobalVarsFingerprint(module));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
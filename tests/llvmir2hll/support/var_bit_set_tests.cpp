@@ -0,0 +1,131 @@
+/**
+* @file tests/llvmir2hll/support/var_bit_set_tests.cpp
+* @brief Tests for the @c var_bit_set module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/support/var_bit_set.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c var_bit_set module.
+*/
+class VarBitSetTests: public Test {};
+
+TEST_F(VarBitSetTests,
+NewSetIsEmpty) {
+	VarBitSet set;
+
+	EXPECT_TRUE(set.empty());
+	EXPECT_EQ(0, set.size());
+	EXPECT_FALSE(set.contains(0));
+	EXPECT_FALSE(set.contains(1000));
+}
+
+TEST_F(VarBitSetTests,
+InsertedIndexesAreContained) {
+	VarBitSet set;
+	set.insert(0);
+	set.insert(63);
+	set.insert(64);
+	set.insert(1000);
+
+	EXPECT_FALSE(set.empty());
+	EXPECT_EQ(4, set.size());
+	EXPECT_TRUE(set.contains(0));
+	EXPECT_TRUE(set.contains(63));
+	EXPECT_TRUE(set.contains(64));
+	EXPECT_TRUE(set.contains(1000));
+	EXPECT_FALSE(set.contains(1));
+	EXPECT_FALSE(set.contains(999));
+	EXPECT_FALSE(set.contains(5000));
+}
+
+TEST_F(VarBitSetTests,
+ClearRemovesAllIndexes) {
+	VarBitSet set;
+	set.insert(3);
+	set.insert(300);
+
+	set.clear();
+
+	EXPECT_TRUE(set.empty());
+	EXPECT_EQ(VarBitSet(), set);
+}
+
+TEST_F(VarBitSetTests,
+SetsWithSameIndexesAreEqualRegardlessOfStoredWords) {
+	VarBitSet set1;
+	set1.insert(1);
+	VarBitSet set2;
+	set2.insert(1);
+	set2.insert(500);
+	VarBitSet set3;
+	set3.insert(2);
+
+	EXPECT_NE(set1, set2);
+	set2 &= set1;
+	EXPECT_EQ(set1, set2);
+	EXPECT_EQ(set2, set1);
+	EXPECT_NE(set1, set3);
+}
+
+TEST_F(VarBitSetTests,
+IntersectsChecksAllWords) {
+	VarBitSet set1;
+	set1.insert(1);
+	set1.insert(200);
+	VarBitSet set2;
+	set2.insert(2);
+	VarBitSet set3;
+	set3.insert(200);
+
+	EXPECT_FALSE(set1.intersects(set2));
+	EXPECT_FALSE(set2.intersects(set1));
+	EXPECT_TRUE(set1.intersects(set3));
+	EXPECT_TRUE(set3.intersects(set1));
+	EXPECT_FALSE(set1.intersects(VarBitSet()));
+}
+
+TEST_F(VarBitSetTests,
+UnionContainsIndexesFromBothSets) {
+	VarBitSet set1;
+	set1.insert(1);
+	VarBitSet set2;
+	set2.insert(2);
+	set2.insert(100);
+
+	set1 |= set2;
+
+	EXPECT_EQ(3, set1.size());
+	EXPECT_TRUE(set1.contains(1));
+	EXPECT_TRUE(set1.contains(2));
+	EXPECT_TRUE(set1.contains(100));
+}
+
+TEST_F(VarBitSetTests,
+IntersectionContainsOnlyCommonIndexes) {
+	VarBitSet set1;
+	set1.insert(1);
+	set1.insert(2);
+	set1.insert(100);
+	VarBitSet set2;
+	set2.insert(2);
+
+	set1 &= set2;
+
+	EXPECT_EQ(1, set1.size());
+	EXPECT_TRUE(set1.contains(2));
+	EXPECT_FALSE(set1.contains(100));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -1020,6 +1020,120 @@ VarStoringTheResultOfKnownFuncIsRenamedBeforeVarPassedAsArgument) {
 	EXPECT_EQ(expectedVarXNameAfterRename, varX->getName());
 }
 
+TEST_F(ReadableVarRenamerTests,
+RenamingFunctionsInParallelGivesSameNamesAsRenamingThemSerially) {
+	// Set-up the module.
+	//
+	// int g;
+	//
+	// void test() {
+	//     int a;
+	//     int b;
+	// }
+	//
+	// void test2(int p) {
+	//     int c;
+	//     for (int d = 0; d < 10; d++) {
+	//     }
+	// }
+	//
+	ShPtr<Variable> varG(Variable::create("g", IntType::create(32)));
+	module->addGlobalVar(varG);
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varB);
+	ShPtr<VarDefStmt> varDefB(VarDefStmt::create(varB));
+	testFunc->setBody(VarDefStmt::create(varA, ShPtr<Expression>(), varDefB));
+	ShPtr<Variable> varP(Variable::create("p", IntType::create(32)));
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+	ShPtr<Variable> varD(Variable::create("d", IntType::create(32)));
+	ShPtr<ForLoopStmt> forLoopD(ForLoopStmt::create(
+		varD, ConstInt::create(0, 32), LtOpExpr::create(varD, ConstInt::create(10, 32)),
+		ConstInt::create(1, 32), EmptyStmt::create()));
+	ShPtr<Function> testFunc2(
+		FunctionBuilder("test2")
+			.definitionWithBody(VarDefStmt::create(varC, ShPtr<Expression>(), forLoopD))
+			.withParam(varP)
+			.withLocalVar(varC)
+			.withLocalVar(varD)
+			.build()
+	);
+	module->addFunc(testFunc2);
+
+	// Setup the renamer.
+	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
+
+	// Do the renaming.
+	varRenamer->renameVars(module, 4);
+
+	// We expect the following output:
+	//
+	// int g1;
+	//
+	// void test() {
+	//     int v1;
+	//     int v2;
+	// }
+	//
+	// void test2(int a1) {
+	//     int v1;
+	//     for (int i = 0; i < 10; i++) {
+	//     }
+	// }
+	//
+	EXPECT_EQ("g1", varG->getName());
+	EXPECT_EQ("v1", varA->getName());
+	EXPECT_EQ("v2", varB->getName());
+	EXPECT_EQ("a1", varP->getName());
+	EXPECT_EQ("v1", varC->getName());
+	EXPECT_EQ("i", varD->getName());
+}
+
+TEST_F(ReadableVarRenamerTests,
+VarOfAnotherFunctionIsRenamedOnceWhenRenamingInParallel) {
+	// Set-up the module.
+	//
+	// void test() {
+	//     int a;
+	// }
+	//
+	// void test2() {
+	//     a = 1;
+	// }
+	//
+	// (`a` is not a local variable of test2(), so the functions cannot be
+	// renamed independently of each other.)
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	testFunc->setBody(VarDefStmt::create(varA));
+	ShPtr<Function> testFunc2(
+		FunctionBuilder("test2")
+			.definitionWithBody(AssignStmt::create(varA, ConstInt::create(1, 32)))
+			.build()
+	);
+	module->addFunc(testFunc2);
+
+	// Setup the renamer.
+	INSTANTIATE_VAR_NAME_GEN_AND_VAR_RENAMER(ReadableVarRenamer, true);
+
+	// Do the renaming.
+	varRenamer->renameVars(module, 4);
+
+	// We expect the following output:
+	//
+	// void test() {
+	//     int v1;
+	// }
+	//
+	// void test2() {
+	//     v1 = 1;
+	// }
+	//
+	EXPECT_EQ("v1", varA->getName());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
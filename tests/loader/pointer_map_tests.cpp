@@ -0,0 +1,153 @@
+/**
+ * @file tests/loader/pointer_map_tests.cpp
+ * @brief Tests for the @c pointer_map module.
+ * @copyright (c) 2026 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/fileformat/types/sec_seg/section.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/loader/loader/pointer_map.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+/**
+ * Image with manually inserted segments.
+ */
+class TestImage : public Image
+{
+public:
+	TestImage(const std::shared_ptr<FileFormat>& fileFormat) : Image(fileFormat) {}
+
+	virtual bool load() override { return true; }
+
+	void addSegment(const SecSeg* secSeg, std::uint64_t address, std::uint64_t size, const std::vector<std::uint8_t>& data)
+	{
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+		insertSegment(std::make_unique<Segment>(secSeg, address, size, std::make_unique<SegmentDataSource>(dataRef)));
+		sortSegments();
+	}
+};
+
+class PointerMapTests : public Test
+{
+public:
+	PointerMapTests()
+	{
+		auto format = std::make_shared<RawDataFormat>(code.data(), code.size());
+		format->setEndianness(retdec::utils::Endianness::LITTLE);
+		format->setBytesPerWord(4);
+		format->setBytesLength(8);
+		image = std::make_unique<TestImage>(format);
+
+		codeSec.setType(SecSeg::Type::CODE);
+		dataSec.setType(SecSeg::Type::DATA);
+
+		// code @ 0x1000, 0x100 bytes
+		image->addSegment(&codeSec, 0x1000, 0x100, code);
+		// data @ 0x2000, 0x20 bytes, only first 0x10 bytes initialized
+		image->addSegment(&dataSec, 0x2000, 0x20, data);
+	}
+
+protected:
+	Section codeSec;
+	Section dataSec;
+	std::vector<std::uint8_t> code = std::vector<std::uint8_t>(0x100, 0x90);
+	std::vector<std::uint8_t> data =
+	{
+		0x10, 0x10, 0x00, 0x00, // 0x2000: 0x1010 -> code
+		0x04, 0x20, 0x00, 0x00, // 0x2004: 0x2004 -> data
+		0x05, 0x00, 0x00, 0x00, // 0x2008: 0x5 -> nothing
+		0x00, 0x30, 0x00, 0x00  // 0x200c: 0x3000 -> nothing
+	};
+	std::unique_ptr<TestImage> image;
+};
+
+TEST_F(PointerMapTests,
+ClassifiesWordsInDataSegment) {
+	auto& pm = image->getPointerMap();
+	PointerMap::Kind kind;
+
+	ASSERT_TRUE(pm.getKind(0x2000, kind));
+	EXPECT_EQ(PointerMap::Kind::Code, kind);
+	ASSERT_TRUE(pm.getKind(0x2004, kind));
+	EXPECT_EQ(PointerMap::Kind::Data, kind);
+	ASSERT_TRUE(pm.getKind(0x2008, kind));
+	EXPECT_EQ(PointerMap::Kind::None, kind);
+	ASSERT_TRUE(pm.getKind(0x200c, kind));
+	EXPECT_EQ(PointerMap::Kind::None, kind);
+}
+
+TEST_F(PointerMapTests,
+DoesNotCoverCodeSegmentsAndUnalignedAddresses) {
+	auto& pm = image->getPointerMap();
+
+	EXPECT_FALSE(pm.isCovered(0x1000));
+	EXPECT_FALSE(pm.isCovered(0x2001));
+	EXPECT_FALSE(pm.isCovered(0x4000));
+	EXPECT_TRUE(pm.isCovered(0x2000));
+}
+
+TEST_F(PointerMapTests,
+ZeroFilledWordsAreReadAsZero) {
+	auto& pm = image->getPointerMap();
+	std::uint64_t word = 1;
+
+	ASSERT_TRUE(pm.getWord(0x2010, word));
+	EXPECT_EQ(0, word);
+	ASSERT_TRUE(pm.getWord(0x201c, word));
+	EXPECT_EQ(0, word);
+}
+
+TEST_F(PointerMapTests,
+WordsAreReadFromCurrentSegmentData) {
+	auto& pm = image->getPointerMap();
+	auto* seg = image->getSegmentFromAddress(0x2008);
+	ASSERT_NE(nullptr, seg);
+
+	// Changed directly in the segment -> map is not rebuilt.
+	ASSERT_TRUE(seg->setBytes({0x78, 0x56, 0x34, 0x12}, 0x8));
+
+	std::uint64_t word = 0;
+	ASSERT_TRUE(pm.getWord(0x2008, word));
+	EXPECT_EQ(0x12345678, word);
+}
+
+TEST_F(PointerMapTests,
+IsPointerGivesSameResultsAsImage) {
+	std::uint64_t ptr = 0;
+
+	EXPECT_TRUE(image->isPointer(0x2000, &ptr));
+	EXPECT_EQ(0x1010, ptr);
+	EXPECT_TRUE(image->isPointer(0x2004, &ptr));
+	EXPECT_EQ(0x2004, ptr);
+	EXPECT_FALSE(image->isPointer(0x2008));
+	EXPECT_FALSE(image->isPointer(0x200c));
+	EXPECT_FALSE(image->isPointer(0x2010));
+	// Not covered by the map -> generic check.
+	EXPECT_FALSE(image->isPointer(0x1000));
+	// Unaligned -> generic check, 0x04000010 is not a pointer.
+	EXPECT_FALSE(image->isPointer(0x2001));
+}
+
+TEST_F(PointerMapTests,
+MapIsRebuiltWhenImageChanges) {
+	EXPECT_FALSE(image->isPointer(0x2008));
+
+	ASSERT_TRUE(image->setWord(0x2008, 0x1004));
+
+	std::uint64_t ptr = 0;
+	EXPECT_TRUE(image->isPointer(0x2008, &ptr));
+	EXPECT_EQ(0x1004, ptr);
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
@@ -0,0 +1,498 @@
+/**
+* @file tests/pdbparser/pdb_file_tests.cpp
+* @brief Tests for the @c PDBFile module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+
+#include "retdec/pdbparser/pdb_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace pdbparser {
+namespace tests {
+
+namespace {
+
+using Bytes = std::vector<std::uint8_t>;
+
+const unsigned PageSize = 0x200;
+
+template <typename T>
+void put(Bytes &b, T v)
+{
+	auto *p = reinterpret_cast<const std::uint8_t *>(&v);
+	b.insert(b.end(), p, p + sizeof(T));
+}
+
+void putName(Bytes &b, const std::string &name)
+{
+	b.insert(b.end(), name.begin(), name.end());
+	b.push_back(0);
+}
+
+/**
+ * Appends record prefixed by its size, padded to 4 bytes like in PDB files.
+ */
+void putRecord(Bytes &stream, Bytes record)
+{
+	while ((record.size() + 2) % 4)
+		record.push_back(0xf0 | (4 - (record.size() + 2) % 4));
+	put<PDB_WORD>(stream, record.size());
+	stream.insert(stream.end(), record.begin(), record.end());
+}
+
+/**
+ * Stream with TPI layout: header followed by records from index 0x1000.
+ */
+Bytes tpiStream(const std::vector<Bytes> &records)
+{
+	Bytes data;
+	for (auto &r : records)
+		putRecord(data, r);
+
+	HDR hdr = {};
+	hdr.vers = 20040203;
+	hdr.cbHdr = sizeof(HDR);
+	hdr.tiMin = 0x1000;
+	hdr.tiMac = 0x1000 + records.size();
+	hdr.cbGprec = data.size();
+
+	Bytes stream;
+	put(stream, hdr);
+	stream.insert(stream.end(), data.begin(), data.end());
+	return stream;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Tests for the @c PDBFile module.
+ *
+ * A small PDB 7.00 file is generated for each test. Its types:
+ *   0x1000 arglist (int)
+ *   0x1001 int (int)
+ *   0x1002 fieldlist { int x; int y; }
+ *   0x1003 struct Point
+ *   0x1004 struct Point *
+ *   0x1005 const struct Point
+ * and symbols:
+ *   public _main (function) at .text+0x10
+ *   public _g_origin at .text+0x200
+ *   global struct Point g_origin at .text+0x200
+ */
+class PDBFileTests : public Test
+{
+	protected:
+		void TearDown() override
+		{
+			if (!path.empty())
+				llvm::sys::fs::remove(path);
+		}
+
+		Bytes typeStream()
+		{
+			Bytes arglist;
+			put<PDB_WORD>(arglist, LF_ARGLIST);
+			put<PDB_DWORD>(arglist, 1);
+			put<PDB_DWORD>(arglist, T_INT4);
+
+			Bytes proc;
+			put<PDB_WORD>(proc, LF_PROCEDURE);
+			put<PDB_DWORD>(proc, T_INT4);
+			put<PDB_BYTE>(proc, 0);
+			put<PDB_BYTE>(proc, 0);
+			put<PDB_WORD>(proc, 1);
+			put<PDB_DWORD>(proc, 0x1000);
+
+			Bytes fields;
+			put<PDB_WORD>(fields, LF_FIELDLIST);
+			for (auto &m : {std::make_pair("x", 0), std::make_pair("y", 4)})
+			{
+				put<PDB_WORD>(fields, LF_MEMBER);
+				put<PDB_WORD>(fields, 3);  // public
+				put<PDB_DWORD>(fields, T_INT4);
+				put<PDB_WORD>(fields, m.second);
+				putName(fields, m.first);
+			}
+
+			Bytes point;
+			put<PDB_WORD>(point, LF_STRUCTURE);
+			put<PDB_WORD>(point, 2);
+			put<PDB_WORD>(point, 0);
+			put<PDB_DWORD>(point, 0x1002);
+			put<PDB_DWORD>(point, 0);
+			put<PDB_DWORD>(point, 0);
+			put<PDB_WORD>(point, 8);
+			putName(point, "Point");
+
+			Bytes pointer;
+			put<PDB_WORD>(pointer, LF_POINTER);
+			put<PDB_DWORD>(pointer, 0x1003);
+			put<PDB_DWORD>(pointer, 0x1000a);
+
+			Bytes modifier;
+			put<PDB_WORD>(modifier, LF_MODIFIER);
+			put<PDB_DWORD>(modifier, 0x1003);
+			put<PDB_WORD>(modifier, 1);
+
+			return tpiStream({arglist, proc, fields, point, pointer, modifier});
+		}
+
+		Bytes idStream()
+		{
+			Bytes str;
+			put<PDB_WORD>(str, LF_STRING_ID);
+			put<PDB_DWORD>(str, 0);
+			putName(str, "C:\\src\\main.c");
+
+			return tpiStream({str});
+		}
+
+		Bytes dbiStream()
+		{
+			NewDBIHdr hdr = {};
+			hdr.verSignature = 0xffffffff;
+			hdr.verHdr = 19990903;
+			hdr.age = 1;
+			hdr.snGSSyms = 0xffff;
+			hdr.snPSSyms = 0xffff;
+			hdr.snSymRecs = 5;
+			hdr.cbDbgHdr = 11 * sizeof(PDB_SHORT);
+
+			Bytes stream;
+			put(stream, hdr);
+			for (int i = 0; i < 11; ++i)
+				put<PDB_SHORT>(stream, i == 5 ? 6 : -1);  // section headers
+			return stream;
+		}
+
+		Bytes symbolStream()
+		{
+			Bytes stream;
+
+			Bytes main;
+			put<PDB_WORD>(main, S_PUB32);
+			put<PDB_DWORD>(main, cvpsfFunction);
+			put<PDB_DWORD>(main, 0x10);
+			put<PDB_WORD>(main, 1);
+			putName(main, "_main");
+			putRecord(stream, main);
+
+			Bytes pub;
+			put<PDB_WORD>(pub, S_PUB32);
+			put<PDB_DWORD>(pub, cvpsfNone);
+			put<PDB_DWORD>(pub, 0x200);
+			put<PDB_WORD>(pub, 1);
+			putName(pub, "_g_origin");
+			putRecord(stream, pub);
+
+			Bytes data;
+			put<PDB_WORD>(data, S_GDATA32);
+			put<PDB_DWORD>(data, 0x1003);
+			put<PDB_DWORD>(data, 0x200);
+			put<PDB_WORD>(data, 1);
+			putName(data, "g_origin");
+			putRecord(stream, data);
+
+			return stream;
+		}
+
+		Bytes sectionStream()
+		{
+			PDB_IMAGE_SECTION_HEADER text = {};
+			std::memcpy(text.Name, ".text", 5);
+			text.VirtualAddress = 0x1000;
+			text.SizeOfRawData = 0x1000;
+
+			Bytes stream;
+			put(stream, text);
+			return stream;
+		}
+
+		/**
+		 * Lays out the given streams into MSF pages and writes the PDB file.
+		 */
+		void writePdb(const std::vector<Bytes> &streams)
+		{
+			auto pages = [](std::size_t size) {
+				return unsigned((size + PageSize - 1) / PageSize);
+			};
+
+			// Page 0 is header, page 1 lists pages of root directory.
+			unsigned nextPage = 2;
+			unsigned rootSize = 4 + 4 * streams.size();
+			for (auto &s : streams)
+				rootSize += 4 * pages(s.size());
+			unsigned rootPage = nextPage;
+			nextPage += pages(rootSize);
+
+			Bytes root;
+			put<PDB_DWORD>(root, streams.size());
+			for (auto &s : streams)
+				put<PDB_DWORD>(root, s.size());
+			std::vector<unsigned> streamPages;
+			for (auto &s : streams)
+			{
+				streamPages.push_back(nextPage);
+				for (unsigned i = 0; i < pages(s.size()); ++i)
+					put<PDB_DWORD>(root, nextPage++);
+			}
+
+			Bytes file(nextPage * PageSize, 0);
+			PDB_HEADER_700 hdr = {};
+			std::memcpy(hdr.abSignature, PDB_SIGNATURE_700, PDB_SIGNATURE_700_SIZE);
+			hdr.dBytesPerPage = PageSize;
+			hdr.dFlagPage = 1;
+			hdr.dNumPages = nextPage;
+			hdr.dRootSize = rootSize;
+			hdr.dRootIndexesPage = 1;
+			std::memcpy(file.data(), &hdr, sizeof(hdr));
+			for (unsigned i = 0; i < pages(rootSize); ++i)
+			{
+				PDB_DWORD p = rootPage + i;
+				std::memcpy(file.data() + PageSize + 4 * i, &p, 4);
+			}
+			std::memcpy(file.data() + rootPage * PageSize, root.data(), root.size());
+			for (std::size_t i = 0; i < streams.size(); ++i)
+			{
+				if (!streams[i].empty())
+				{
+					std::memcpy(
+							file.data() + streamPages[i] * PageSize,
+							streams[i].data(),
+							streams[i].size());
+				}
+			}
+
+			writeFile(file);
+		}
+
+		void writeFile(const Bytes &content)
+		{
+			llvm::SmallString<128> p;
+			llvm::sys::fs::createTemporaryFile("retdec-pdbparser-test", "pdb", p);
+			path = p.str().str();
+			std::ofstream out(path, std::ios::binary);
+			out.write(reinterpret_cast<const char *>(content.data()), content.size());
+		}
+
+		void loadPdb()
+		{
+			writePdb({
+				Bytes(),  // old directory
+				Bytes(sizeof(PDBInfo70), 0),
+				typeStream(),
+				dbiStream(),
+				idStream(),
+				symbolStream(),
+				sectionStream()
+			});
+			ASSERT_EQ(PDB_STATE_OK, pdb.load_pdb_file(path.c_str()));
+			pdb.initialize(0x400000);
+		}
+
+	protected:
+		std::string path;
+		PDBFile pdb;
+};
+
+//
+// Loading
+//
+
+TEST_F(PDBFileTests, smallPdbIsLoaded)
+{
+	loadPdb();
+
+	EXPECT_EQ(PDB_VERSION_700, pdb.get_version());
+	ASSERT_NE(nullptr, pdb.get_stream(PDB_STREAM_TPI));
+	EXPECT_EQ(int(typeStream().size()), pdb.get_stream(PDB_STREAM_TPI)->size);
+	EXPECT_EQ(nullptr, pdb.get_stream(7));
+}
+
+TEST_F(PDBFileTests, fileWithoutSignatureIsRejected)
+{
+	writeFile(Bytes(4 * PageSize, 0));
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, pdb.load_pdb_file(path.c_str()));
+}
+
+TEST_F(PDBFileTests, fileSmallerThanHeaderIsRejected)
+{
+	writeFile(Bytes(0x10, 0));
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, pdb.load_pdb_file(path.c_str()));
+}
+
+//
+// Type records
+//
+
+TEST_F(PDBFileTests, typeRecordsAreFoundByIndex)
+{
+	loadPdb();
+	PDBTypeRecords records(pdb.get_stream(PDB_STREAM_TPI));
+
+	EXPECT_EQ(0x1000u, records.get_min_index());
+	EXPECT_EQ(0x1006u, records.get_max_index());
+	EXPECT_EQ(6u, records.get_records_count());
+	unsigned int size = 0;
+	lfRecord *r = records.get_record(0x1003, &size);
+	ASSERT_NE(nullptr, r);
+	EXPECT_EQ(LF_STRUCTURE, r->leaf);
+	EXPECT_EQ(0x1002u, r->Structure.field);
+	EXPECT_EQ(26u, size);
+	EXPECT_EQ(LF_MODIFIER, records.get_record(0x1005)->leaf);
+	EXPECT_EQ(nullptr, records.get_record(0x0fff));
+	EXPECT_EQ(nullptr, records.get_record(0x1006));
+}
+
+TEST_F(PDBFileTests, idRecordsAreFoundByIndex)
+{
+	loadPdb();
+
+	PDBTypeRecords *ids = pdb.get_ipi_records();
+
+	ASSERT_NE(nullptr, ids);
+	EXPECT_EQ(1u, ids->get_records_count());
+	lfRecord *r = ids->get_record(0x1000);
+	ASSERT_NE(nullptr, r);
+	EXPECT_EQ(LF_STRING_ID, r->leaf);
+	EXPECT_STREQ("C:\\src\\main.c", reinterpret_cast<char *>(r) + 6);
+}
+
+//
+// Types parsed on demand
+//
+
+TEST_F(PDBFileTests, typeIsParsedWithTypesItRefersToOnly)
+{
+	loadPdb();
+	PDBTypes types(pdb.get_stream(PDB_STREAM_TPI));
+
+	PDBTypeDef *t = types.get_type_by_index(0x1004);
+
+	ASSERT_NE(nullptr, t);
+	ASSERT_EQ(PDBTYPE_POINTER, t->type_class);
+	auto *s = static_cast<PDBTypePointer *>(t)->ptr_utype_def;
+	ASSERT_NE(nullptr, s);
+	ASSERT_EQ(PDBTYPE_STRUCT, s->type_class);
+	auto *point = static_cast<PDBTypeStruct *>(s);
+	EXPECT_EQ("Point", point->struct_name);
+	EXPECT_EQ(8, point->size_bytes);
+	ASSERT_EQ(2u, point->struct_members.size());
+	EXPECT_STREQ("y", point->struct_members[1]->name);
+	EXPECT_EQ(4, point->struct_members[1]->offset);
+	EXPECT_EQ(types.get_type_by_index(T_INT4), point->struct_members[1]->type_def);
+	// Unrelated types are not parsed.
+	EXPECT_FALSE(types.parsed);
+	EXPECT_EQ(0u, types.types.count(0x1000));
+	EXPECT_EQ(0u, types.types.count(0x1001));
+	EXPECT_EQ(0u, types.types.count(0x1005));
+}
+
+TEST_F(PDBFileTests, functionTypeIsParsedWithItsArguments)
+{
+	loadPdb();
+
+	PDBTypeDef *t = pdb.get_type(0x1001);
+
+	ASSERT_NE(nullptr, t);
+	ASSERT_EQ(PDBTYPE_FUNCTION, t->type_class);
+	auto *f = static_cast<PDBTypeFunction *>(t);
+	EXPECT_EQ(pdb.get_type(T_INT4), f->func_rettype_def);
+	ASSERT_EQ(1, f->func_args_count);
+	EXPECT_EQ(pdb.get_type(T_INT4), f->func_args[0].type_def);
+}
+
+TEST_F(PDBFileTests, missingTypeIsNotFound)
+{
+	loadPdb();
+
+	EXPECT_EQ(nullptr, pdb.get_type(0x1006));
+	EXPECT_EQ(nullptr, pdb.get_type(0x0fff));
+}
+
+TEST_F(PDBFileTests, parsingAllTypesKeepsTypesParsedOnDemand)
+{
+	loadPdb();
+	PDBTypeDef *point = pdb.get_type(0x1003);
+
+	PDBTypes *types = pdb.get_types_container();
+
+	ASSERT_NE(nullptr, types);
+	EXPECT_TRUE(types->parsed);
+	EXPECT_EQ(point, types->get_type_by_index(0x1003));
+	EXPECT_EQ(point, types->types_fully_defined[0x1003]);
+	EXPECT_EQ(point, static_cast<PDBTypeConst *>(types->get_type_by_index(0x1005))->const_utype_def);
+	EXPECT_NE(nullptr, types->get_type_by_index(0x1001));
+}
+
+//
+// Symbols found on demand
+//
+
+TEST_F(PDBFileTests, publicSymbolIsFoundByName)
+{
+	loadPdb();
+	PDBPublicSymbol pub;
+
+	ASSERT_TRUE(pdb.find_public_symbol("_main", pub));
+	EXPECT_STREQ("_main", pub.name);
+	EXPECT_EQ(0x401010u, pub.address);
+	EXPECT_EQ(1, pub.section);
+	EXPECT_EQ(0x10, pub.offset);
+	EXPECT_TRUE(pub.is_function);
+
+	ASSERT_TRUE(pdb.find_public_symbol("_g_origin", pub));
+	EXPECT_EQ(0x401200u, pub.address);
+	EXPECT_FALSE(pub.is_function);
+
+	EXPECT_FALSE(pdb.find_public_symbol("g_origin", pub));
+	EXPECT_FALSE(pdb.find_public_symbol("_mai", pub));
+}
+
+TEST_F(PDBFileTests, globalVariableIsFoundByNameWithItsType)
+{
+	loadPdb();
+	PDBGlobalVariable var;
+
+	ASSERT_TRUE(pdb.find_global_variable("g_origin", var));
+
+	EXPECT_STREQ("g_origin", var.name);
+	EXPECT_EQ(0x401200u, var.address);
+	EXPECT_EQ(0x1003u, var.type_index);
+	ASSERT_NE(nullptr, var.type_def);
+	EXPECT_EQ(PDBTYPE_STRUCT, var.type_def->type_class);
+	EXPECT_FALSE(pdb.find_global_variable("_g_origin", var));
+}
+
+TEST_F(PDBFileTests, allGlobalVariablesMatchVariableFoundByName)
+{
+	loadPdb();
+	PDBGlobalVariable var;
+	ASSERT_TRUE(pdb.find_global_variable("g_origin", var));
+
+	PDBGlobalVarAddressMap *vars = pdb.get_global_variables();
+
+	ASSERT_NE(nullptr, vars);
+	ASSERT_EQ(1u, vars->size());
+	EXPECT_EQ(var.address, vars->begin()->first);
+	EXPECT_EQ(var.type_def, vars->begin()->second.type_def);
+	EXPECT_TRUE(pdb.get_functions()->empty());
+}
+
+} // namespace tests
+} // namespace pdbparser
+} // namespace retdec
@@ -0,0 +1,277 @@
+/**
+* @file tests/unpacker/decompression_tests.cpp
+* @brief Tests for the NRV and LZMA decompression.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/unpacker/decompression/lzma/lzma_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2b_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2d_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2e_data.h"
+#include "retdec/utils/dynamic_buffer.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+namespace {
+
+/**
+ * Bit parser which is not known to NrvData, so the generic loop is used.
+ */
+class ForwardingBitParser : public BitParser
+{
+public:
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _parser.getBit(bit, data, pos);
+	}
+
+private:
+	BitParser8 _parser;
+};
+
+} // anonymous namespace
+
+class DecompressionTests : public Test
+{
+protected:
+	template <typename Data, typename Parser>
+	bool decompress(const std::vector<uint8_t>& packed, DynamicBuffer& output)
+	{
+		DynamicBuffer input(packed);
+		Parser parser;
+		Data data(input, &parser);
+		return data.decompress(output);
+	}
+
+	template <typename Data, typename Parser>
+	void checkNrvStream(const std::vector<uint8_t>& packed)
+	{
+		auto plain = nrvPlain();
+		DynamicBuffer output(plain.size());
+
+		ASSERT_TRUE((decompress<Data, Parser>(packed, output)));
+		EXPECT_EQ(plain, output.getBuffer());
+	}
+
+	template <typename Data>
+	void checkNrvCapacity(const std::vector<uint8_t>& packed)
+	{
+		auto plain = nrvPlain();
+		DynamicBuffer output(1000);
+
+		ASSERT_FALSE((decompress<Data, BitParser8>(packed, output)));
+		EXPECT_EQ(std::vector<uint8_t>(plain.begin(), plain.begin() + 1000), output.getBuffer());
+		EXPECT_EQ(1000, output.getCapacity());
+	}
+
+	template <typename Data>
+	void checkNrvTruncated(const std::vector<uint8_t>& packed)
+	{
+		auto plain = nrvPlain();
+		DynamicBuffer output(plain.size());
+
+		std::vector<uint8_t> truncated(packed.begin(), packed.begin() + packed.size() / 2);
+		ASSERT_FALSE((decompress<Data, BitParser8>(truncated, output)));
+		ASSERT_LT(0, output.getRealDataSize());
+		ASSERT_GT(plain.size(), output.getRealDataSize());
+		EXPECT_EQ(std::vector<uint8_t>(plain.begin(), plain.begin() + output.getRealDataSize()), output.getBuffer());
+	}
+
+	template <typename Data>
+	void checkNrvPreviousData(const std::vector<uint8_t>& packed)
+	{
+		auto plain = nrvPlain();
+		DynamicBuffer output(std::vector<uint8_t>(plain.size() + 10, 0xCC));
+		output.setCapacity(plain.size() + 100);
+
+		auto expected = plain;
+		expected.insert(expected.end(), 10, 0xCC);
+
+		ASSERT_TRUE((decompress<Data, BitParser8>(packed, output)));
+		EXPECT_EQ(expected, output.getBuffer());
+		EXPECT_EQ(plain.size() + 100, output.getCapacity());
+	}
+
+	/// Text packed in the NRV streams. The repeated sentence at its end
+	/// is a match with a distance over the thresholds of all NRV variants.
+	std::vector<uint8_t> nrvPlain()
+	{
+		std::string result = "The quick brown fox jumps over the lazy dog. ";
+		for (int i = 0; i < 200; ++i)
+			result += "retdec unpacker " + std::to_string(i % 7) + " ";
+		result += "The quick brown fox jumps over the lazy dog.";
+		return std::vector<uint8_t>(result.begin(), result.end());
+	}
+
+	/// NRV2B stream of nrvPlain() for BitParser8.
+	std::vector<uint8_t> nrv2bPacked8 =
+	{
+		0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0xff, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77,
+		0x6e, 0x20, 0xff, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0xff, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0x77, 0x1e, 0x6c, 0x61, 0x7a, 0xff, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e,
+		0x20, 0x72, 0xff, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0xf7, 0x70, 0x61, 0x63, 0x6b,
+		0x1d, 0x59, 0x30, 0x11, 0x4c, 0x31, 0x94, 0xc9, 0x32, 0x4c, 0x33, 0x94, 0xc9, 0x34, 0x4c, 0x35,
+		0x94, 0xd8, 0x36, 0x7d, 0x11, 0x06, 0x40, 0x88, 0x32, 0x04, 0x41, 0x90, 0x22, 0x0c, 0x81, 0x10,
+		0x64, 0x08, 0x83, 0x20, 0x44, 0x19, 0x02, 0x20, 0xc8, 0x11, 0x06, 0x40, 0x88, 0x32, 0x04, 0x41,
+		0x90, 0x8a, 0x10, 0x18, 0x3c, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff
+	};
+
+	/// NRV2B stream of nrvPlain() for BitParserLe32.
+	std::vector<uint8_t> nrv2bPacked32 =
+	{
+		0xff, 0xff, 0xff, 0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72,
+		0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0xf7, 0xff, 0xff, 0x77, 0x1e, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f,
+		0x67, 0x2e, 0x20, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+		0x1d, 0xc9, 0x94, 0x4c, 0x59, 0x30, 0x11, 0x31, 0x32, 0x4c, 0xc9, 0x94, 0x4c, 0x33, 0x34, 0x35,
+		0x06, 0x11, 0xd8, 0x94, 0x36, 0x7d, 0x04, 0x32, 0x88, 0x40, 0x0c, 0x22, 0x90, 0x41, 0x08, 0x64,
+		0x10, 0x81, 0x19, 0x44, 0x20, 0x83, 0x11, 0xc8, 0x20, 0x02, 0x32, 0x88, 0x40, 0x06, 0x8a, 0x90,
+		0x41, 0x04, 0x80, 0x40, 0x18, 0x10, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xff
+	};
+
+	/// NRV2D stream of nrvPlain() for BitParser8.
+	std::vector<uint8_t> nrv2dPacked8 =
+	{
+		0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0xff, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77,
+		0x6e, 0x20, 0xff, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0xff, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0x6f, 0x3c, 0x6c, 0x61, 0x7a, 0x79, 0xff, 0x20, 0x64, 0x6f, 0x67, 0x2e,
+		0x20, 0x72, 0x65, 0xff, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0x70, 0xed, 0x61, 0x63, 0x6b,
+		0x3a, 0x30, 0x6a, 0x23, 0x64, 0x31, 0xa6, 0x32, 0x4a, 0x64, 0x33, 0xa6, 0x34, 0x4a, 0x64, 0x35,
+		0xa6, 0x36, 0xc1, 0xfb, 0x10, 0x64, 0x08, 0x83, 0x20, 0x44, 0x19, 0x02, 0x20, 0xc8, 0x11, 0x06,
+		0x40, 0x88, 0x32, 0x04, 0x41, 0x90, 0x22, 0x0c, 0x81, 0x10, 0x64, 0x08, 0x83, 0x20, 0x44, 0x19,
+		0x08, 0xa1, 0x43, 0x88, 0x79, 0x10, 0x92, 0x49, 0x24, 0x92, 0xa0, 0xff
+	};
+
+	/// NRV2D stream of nrvPlain() for BitParserLe32.
+	std::vector<uint8_t> nrv2dPacked32 =
+	{
+		0xff, 0xff, 0xff, 0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72,
+		0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0xed, 0xff, 0xff, 0x6f, 0x3c, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f,
+		0x67, 0x2e, 0x20, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+		0x3a, 0x30, 0x4a, 0xa6, 0x64, 0x6a, 0x23, 0x31, 0x32, 0x64, 0x4a, 0xa6, 0x64, 0x33, 0x34, 0x35,
+		0x64, 0x10, 0xc1, 0xa6, 0x36, 0xfb, 0x44, 0x20, 0x83, 0x08, 0xc8, 0x20, 0x02, 0x19, 0x88, 0x40,
+		0x06, 0x11, 0x90, 0x41, 0x04, 0x32, 0x10, 0x81, 0x0c, 0x22, 0x20, 0x83, 0x08, 0x64, 0xa1, 0x08,
+		0x19, 0x44, 0x92, 0x10, 0x88, 0x43, 0x79, 0xa0, 0x92, 0x24, 0x49, 0xff
+	};
+
+	/// NRV2E stream of nrvPlain() for BitParser8.
+	std::vector<uint8_t> nrv2ePacked8 =
+	{
+		0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0xff, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77,
+		0x6e, 0x20, 0xff, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0xff, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0x7f, 0x3c, 0x6c, 0x61, 0x7a, 0x79, 0xff, 0x20, 0x64, 0x6f, 0x67, 0x2e,
+		0x20, 0x72, 0x65, 0xff, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0x70, 0xef, 0x61, 0x63, 0x6b,
+		0x3a, 0x30, 0x68, 0x23, 0xe4, 0x31, 0x8e, 0x32, 0x48, 0xe4, 0x33, 0x8e, 0x34, 0x48, 0xe4, 0x35,
+		0x8e, 0x36, 0xc1, 0xfb, 0x10, 0x24, 0x08, 0x81, 0x20, 0x44, 0x09, 0x02, 0x20, 0x48, 0x11, 0x02,
+		0x40, 0x88, 0x12, 0x04, 0x40, 0x90, 0x22, 0x04, 0x81, 0x10, 0x24, 0x08, 0x81, 0x20, 0x44, 0x09,
+		0x08, 0x8b, 0x43, 0x82, 0x79, 0xb0, 0x92, 0x49, 0x24, 0x92, 0xa0, 0xff
+	};
+
+	/// NRV2E stream of nrvPlain() for BitParserLe32.
+	std::vector<uint8_t> nrv2ePacked32 =
+	{
+		0xff, 0xff, 0xff, 0xff, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72,
+		0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76,
+		0x65, 0x72, 0x20, 0x74, 0xef, 0xff, 0xff, 0x7f, 0x3c, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f,
+		0x67, 0x2e, 0x20, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x75, 0x6e, 0x70, 0x61, 0x63, 0x6b,
+		0x3a, 0x30, 0x48, 0x8e, 0xe4, 0x68, 0x23, 0x31, 0x32, 0xe4, 0x48, 0x8e, 0xe4, 0x33, 0x34, 0x35,
+		0x24, 0x10, 0xc1, 0x8e, 0x36, 0xfb, 0x44, 0x20, 0x81, 0x08, 0x48, 0x20, 0x02, 0x09, 0x88, 0x40,
+		0x02, 0x11, 0x90, 0x40, 0x04, 0x12, 0x10, 0x81, 0x04, 0x22, 0x20, 0x81, 0x08, 0x24, 0x8b, 0x08,
+		0x09, 0x44, 0x92, 0xb0, 0x82, 0x43, 0x79, 0xa0, 0x92, 0x24, 0x49, 0xff
+	};
+
+	/// Raw LZMA stream (lc=3, lp=0, pb=2) of lzmaPlain().
+	std::vector<uint8_t> lzmaPacked =
+	{
+		0x00, 0x39, 0x19, 0x4a, 0xee, 0xd4, 0xd4, 0x4e, 0xa5, 0x0f, 0x49, 0x8c, 0xe0, 0xad, 0x21, 0xfa,
+		0xa3, 0x77, 0x37, 0xf2, 0x38, 0x82, 0x3c, 0xdb, 0x3b, 0x47, 0x6e, 0xbb, 0x3b, 0x52, 0x3b, 0x2a,
+		0x5f, 0x30, 0xd8, 0x07, 0x88, 0xe8, 0xd0, 0x37, 0x91, 0xdc, 0xef, 0x97, 0xff, 0xfe, 0x14, 0x20,
+		0x00
+	};
+
+	std::vector<uint8_t> lzmaPlain()
+	{
+		std::string result;
+		for (int i = 0; i < 40; ++i)
+			result += "retdec unpacker " + std::to_string(i % 7) + " ";
+		return std::vector<uint8_t>(result.begin(), result.end());
+	}
+};
+
+TEST_F(DecompressionTests,
+Nrv2bDecompressesStream) {
+	checkNrvStream<Nrv2bData, BitParser8>(nrv2bPacked8);
+	checkNrvStream<Nrv2bData, BitParserLe32>(nrv2bPacked32);
+	checkNrvStream<Nrv2bData, ForwardingBitParser>(nrv2bPacked8);
+}
+
+TEST_F(DecompressionTests,
+Nrv2dDecompressesStream) {
+	checkNrvStream<Nrv2dData, BitParser8>(nrv2dPacked8);
+	checkNrvStream<Nrv2dData, BitParserLe32>(nrv2dPacked32);
+	checkNrvStream<Nrv2dData, ForwardingBitParser>(nrv2dPacked8);
+}
+
+TEST_F(DecompressionTests,
+Nrv2eDecompressesStream) {
+	checkNrvStream<Nrv2eData, BitParser8>(nrv2ePacked8);
+	checkNrvStream<Nrv2eData, BitParserLe32>(nrv2ePacked32);
+	checkNrvStream<Nrv2eData, ForwardingBitParser>(nrv2ePacked8);
+}
+
+TEST_F(DecompressionTests,
+NrvStopsAtCapacity) {
+	checkNrvCapacity<Nrv2bData>(nrv2bPacked8);
+	checkNrvCapacity<Nrv2dData>(nrv2dPacked8);
+	checkNrvCapacity<Nrv2eData>(nrv2ePacked8);
+}
+
+TEST_F(DecompressionTests,
+NrvKeepsDataOfTruncatedStream) {
+	checkNrvTruncated<Nrv2bData>(nrv2bPacked8);
+	checkNrvTruncated<Nrv2dData>(nrv2dPacked8);
+	checkNrvTruncated<Nrv2eData>(nrv2ePacked8);
+}
+
+TEST_F(DecompressionTests,
+NrvOverwritesPreviousData) {
+	checkNrvPreviousData<Nrv2bData>(nrv2bPacked8);
+	checkNrvPreviousData<Nrv2dData>(nrv2dPacked8);
+	checkNrvPreviousData<Nrv2eData>(nrv2ePacked8);
+}
+
+TEST_F(DecompressionTests,
+LzmaDecompressesStream) {
+	auto plain = lzmaPlain();
+	DynamicBuffer output(plain.size());
+	LzmaData data(DynamicBuffer(lzmaPacked), 2, 0, 3);
+
+	ASSERT_TRUE(data.decompress(output));
+	EXPECT_EQ(plain, output.getBuffer());
+}
+
+TEST_F(DecompressionTests,
+LzmaStopsAtCapacity) {
+	auto plain = lzmaPlain();
+	DynamicBuffer output(100);
+	LzmaData data(DynamicBuffer(lzmaPacked), 2, 0, 3);
+
+	ASSERT_TRUE(data.decompress(output));
+	EXPECT_EQ(std::vector<uint8_t>(plain.begin(), plain.begin() + 100), output.getBuffer());
+	EXPECT_EQ(100, output.getCapacity());
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
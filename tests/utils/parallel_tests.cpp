@@ -0,0 +1,87 @@
+/**
+* @file tests/utils/parallel_tests.cpp
+* @brief Tests for the @c parallel module.
+* @copyright (c) 2026 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/parallel.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c parallel module.
+*/
+class ParallelTests: public Test {};
+
+//
+// getThreadCount()
+//
+
+TEST_F(ParallelTests,
+GetThreadCountReturnsRequestedCountWhenNonZero) {
+	ASSERT_EQ(4, getThreadCount(4));
+}
+
+TEST_F(ParallelTests,
+GetThreadCountReturnsAtLeastOneForZero) {
+	ASSERT_LE(1, getThreadCount(0));
+}
+
+//
+// parallelFor()
+//
+
+TEST_F(ParallelTests,
+ParallelForDoesNothingForZeroItems) {
+	std::atomic<int> calls(0);
+
+	parallelFor(0, 4, [&](std::size_t) { ++calls; });
+
+	ASSERT_EQ(0, calls);
+}
+
+TEST_F(ParallelTests,
+ParallelForProcessesItemsInOrderWhenSingleThreaded) {
+	std::vector<std::size_t> order;
+
+	parallelFor(5, 1, [&](std::size_t i) { order.push_back(i); });
+
+	ASSERT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), order);
+}
+
+TEST_F(ParallelTests,
+ParallelForProcessesEveryItemExactlyOnceWhenMultiThreaded) {
+	std::vector<std::atomic<int>> counts(1000);
+
+	parallelFor(counts.size(), 8, [&](std::size_t i) { ++counts[i]; });
+
+	for (auto& c : counts) {
+		ASSERT_EQ(1, c);
+	}
+}
+
+TEST_F(ParallelTests,
+ParallelForRethrowsExceptionFromWorker) {
+	ASSERT_THROW(
+		parallelFor(100, 4, [](std::size_t i) {
+			if (i == 42) {
+				throw std::runtime_error("failure");
+			}
+		}),
+		std::runtime_error
+	);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -560,6 +560,79 @@ JoinStringsThreeItemsSetEmptySeparator) {
 	EXPECT_EQ("abcXXXefgXXXijK ", joinStrings(strings, "XXX"));
 }
 
+//
+// quotePosixShellArgument()
+//
+
+TEST_F(StringTests,
+QuotePosixShellArgumentPutsArgumentIntoSingleQuotes) {
+	EXPECT_EQ("''", quotePosixShellArgument(""));
+	EXPECT_EQ("'abc'", quotePosixShellArgument("abc"));
+	EXPECT_EQ("'a b'", quotePosixShellArgument("a b"));
+	EXPECT_EQ(R"('a"b $x `y` \z')", quotePosixShellArgument(R"(a"b $x `y` \z)"));
+}
+
+TEST_F(StringTests,
+QuotePosixShellArgumentEscapesSingleQuotes) {
+	EXPECT_EQ(R"('it'\''s')", quotePosixShellArgument("it's"));
+	EXPECT_EQ(R"(''\'''\''')", quotePosixShellArgument("''"));
+}
+
+TEST_F(StringTests,
+QuotePosixShellArgumentQuotesArchiveMemberPath) {
+	EXPECT_EQ(
+		R"('out-members/0-a'\''b.o.c'\''; rm -rf x; '\''.log')",
+		quotePosixShellArgument(R"(out-members/0-a'b.o.c'; rm -rf x; '.log)"));
+}
+
+//
+// quoteWindowsShellArgument()
+//
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentPutsArgumentIntoDoubleQuotes) {
+	EXPECT_EQ(R"(^"^")", quoteWindowsShellArgument(""));
+	EXPECT_EQ(R"(^"abc^")", quoteWindowsShellArgument("abc"));
+	EXPECT_EQ(R"(^"a b^")", quoteWindowsShellArgument("a b"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentEscapesDoubleQuotes) {
+	EXPECT_EQ(R"(^"a\^"b^")", quoteWindowsShellArgument(R"(a"b)"));
+	EXPECT_EQ(R"(^"\^"\^"^")", quoteWindowsShellArgument(R"("")"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentKeepsBackslashesNotFollowedByQuote) {
+	EXPECT_EQ(R"(^"C:\dir\file^")", quoteWindowsShellArgument(R"(C:\dir\file)"));
+	EXPECT_EQ(R"(^"\\server\share^")", quoteWindowsShellArgument(R"(\\server\share)"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentDoublesBackslashesFollowedByQuote) {
+	EXPECT_EQ(R"(^"a\\\^"b^")", quoteWindowsShellArgument(R"(a\"b)"));
+	EXPECT_EQ(R"(^"a\\\\\^"b^")", quoteWindowsShellArgument(R"(a\\"b)"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentDoublesTrailingBackslashes) {
+	EXPECT_EQ(R"(^"C:\dir\\^")", quoteWindowsShellArgument(R"(C:\dir\)"));
+	EXPECT_EQ(R"(^"a\\\\^")", quoteWindowsShellArgument(R"(a\\)"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentEscapesCmdSpecialChars) {
+	EXPECT_EQ(R"(^"a^&b^|c^<d^>e^")", quoteWindowsShellArgument("a&b|c<d>e"));
+	EXPECT_EQ(R"(^"^%PATH^%^!x^!^^^(y^)^")", quoteWindowsShellArgument("%PATH%!x!^(y)"));
+}
+
+TEST_F(StringTests,
+QuoteWindowsShellArgumentQuotesArchiveMemberPath) {
+	EXPECT_EQ(
+		R"(^"out-members\0-a\^" ^& del x ^& \^"b.o.c^")",
+		quoteWindowsShellArgument(R"(out-members\0-a" & del x & "b.o.c)"));
+}
+
 //
 // startsWith()
 //